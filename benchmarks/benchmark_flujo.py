@@ -0,0 +1,98 @@
+"""
+benchmark_flujo.py
+Benchmark del flujo máximo / corte mínimo (Dinic) de NeuroNet
+
+Si no se indica un dataset se genera un grafo aleatorio dirigido con el
+número de aristas pedido (por defecto 10 millones) en un archivo
+temporal. Se eligen dos regiones disjuntas de nodos como fuentes y
+sumideros y se mide el cálculo completo del flujo y del corte.
+
+Uso:
+    python benchmarks/benchmark_flujo.py --aristas 10000000
+    python benchmarks/benchmark_flujo.py data/test_1000.txt --region 10
+"""
+
+import argparse
+import os
+import sys
+import tempfile
+import time
+
+import numpy as np
+
+# Añadir el directorio raíz al path para encontrar el módulo compilado
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+import neuronet_core
+
+
+def generar_dataset(ruta, num_nodos, num_aristas, semilla):
+    """Escribe una Edge List aleatoria (uniforme) en bloques"""
+    rng = np.random.default_rng(semilla)
+    bloque = 1_000_000
+    with open(ruta, "w") as archivo:
+        archivo.write("# Grafo aleatorio para benchmark_flujo.py\n")
+        for inicio in range(0, num_aristas, bloque):
+            cantidad = min(bloque, num_aristas - inicio)
+            aristas = rng.integers(0, num_nodos, size=(cantidad, 2))
+            np.savetxt(archivo, aristas, fmt="%d")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Benchmark del flujo máximo")
+    parser.add_argument("dataset", nargs="?", help="Edge List (si se omite, se genera una)")
+    parser.add_argument("--aristas", type=int, default=10_000_000,
+                        help="Aristas del grafo generado")
+    parser.add_argument("--nodos", type=int, default=1_000_000,
+                        help="Nodos del grafo generado")
+    parser.add_argument("--region", type=int, default=1000,
+                        help="Nodos en cada región (fuentes y sumideros)")
+    parser.add_argument("--pesos", action="store_true",
+                        help="Usar los pesos de las aristas como capacidades")
+    parser.add_argument("--semilla", type=int, default=42)
+    args = parser.parse_args()
+
+    ruta = args.dataset
+    temporal = None
+    if ruta is None:
+        temporal = tempfile.NamedTemporaryFile(suffix=".txt", delete=False)
+        temporal.close()
+        ruta = temporal.name
+        inicio = time.perf_counter()
+        generar_dataset(ruta, args.nodos, args.aristas, args.semilla)
+        print(f"Dataset generado en {time.perf_counter() - inicio:.1f} s")
+
+    try:
+        grafo = neuronet_core.PyGrafoDisperso()
+        if not grafo.cargar_datos(ruta):
+            sys.exit(1)
+
+        n = grafo.get_num_nodos()
+        rng = np.random.default_rng(args.semilla)
+        nodos = rng.permutation(n)
+        region = min(args.region, n // 2)
+        fuentes = nodos[:region]
+        sumideros = nodos[region:2 * region]
+
+        inicio = time.perf_counter()
+        resultado = grafo.flujo_maximo(fuentes, sumideros, usar_pesos=args.pesos)
+        duracion = time.perf_counter() - inicio
+    finally:
+        if temporal is not None:
+            os.unlink(ruta)
+
+    print("\n" + "=" * 60)
+    print("NeuroNet - Benchmark de flujo máximo (Dinic)")
+    print("=" * 60)
+    print(f"Nodos / aristas:      {n:,} / {grafo.get_num_aristas():,}")
+    print(f"Fuentes / sumideros:  {region:,} / {region:,}")
+    print(f"Flujo máximo:         {resultado['valor']:,}")
+    print(f"Aristas de corte:     {len(resultado['corte']):,}")
+    print(f"Lado fuente:          {resultado['nodos_lado_fuente']:,} nodos")
+    print(f"Fases de Dinic:       {resultado['fases']}")
+    print(f"Tiempo total:         {duracion:.3f} s (incluye la red residual)")
+    print("=" * 60)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,79 @@
+"""
+benchmark_pll.py
+Benchmark del índice PLL (Pruned Landmark Labeling) de NeuroNet
+
+Construye el índice sobre un dataset, reporta su tamaño y mide el tiempo
+por consulta resolviendo un lote aleatorio completamente en C++. Como
+referencia se mide también un BFS completo desde algunos orígenes.
+
+Uso:
+    python benchmarks/benchmark_pll.py data/test_1000.txt --consultas 1000000
+"""
+
+import argparse
+import os
+import sys
+import time
+
+import numpy as np
+
+# Añadir el directorio raíz al path para encontrar el módulo compilado
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+import neuronet_core
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Benchmark del índice PLL")
+    parser.add_argument("dataset", help="Archivo Edge List a indexar")
+    parser.add_argument("--consultas", type=int, default=1_000_000,
+                        help="Número de pares aleatorios a consultar")
+    parser.add_argument("--raices-bp", type=int, default=16,
+                        help="Raíces bit-paralelas del índice")
+    parser.add_argument("--bfs", type=int, default=5,
+                        help="BFS completos de referencia")
+    parser.add_argument("--semilla", type=int, default=42)
+    args = parser.parse_args()
+
+    grafo = neuronet_core.PyGrafoDisperso()
+    if not grafo.cargar_datos(args.dataset):
+        sys.exit(1)
+
+    if not grafo.construir_indice_pll(num_raices_bp=args.raices_bp):
+        sys.exit(1)
+    stats = grafo.estadisticas_indice_pll()
+
+    rng = np.random.default_rng(args.semilla)
+    n = grafo.get_num_nodos()
+    origenes = rng.integers(0, n, size=args.consultas, dtype=np.int32)
+    destinos = rng.integers(0, n, size=args.consultas, dtype=np.int32)
+
+    inicio = time.perf_counter()
+    distancias = grafo.distancias_pll(origenes, destinos)
+    duracion_lote = time.perf_counter() - inicio
+
+    inicio = time.perf_counter()
+    for origen in origenes[:args.bfs]:
+        grafo.bfs(int(origen), n)
+    duracion_bfs = (time.perf_counter() - inicio) / max(1, args.bfs)
+
+    conectados = int(np.count_nonzero(distancias >= 0))
+
+    print("\n" + "=" * 60)
+    print("NeuroNet - Benchmark del índice PLL")
+    print("=" * 60)
+    print(f"Dataset:              {args.dataset}")
+    print(f"Nodos / aristas:      {n:,} / {grafo.get_num_aristas():,}")
+    print(f"Raíces bit-paralelas: {stats['num_raices_bp']}")
+    print(f"Construcción:         {stats['segundos_construccion']:.3f} s")
+    print(f"Etiqueta promedio:    {stats['promedio_etiqueta']:.2f} entradas")
+    print(f"Tamaño del índice:    {stats['bytes_indice'] / 2**20:.2f} MB "
+          f"({stats['bytes_indice'] / max(1, n):.1f} bytes/nodo)")
+    print(f"Consultas:            {args.consultas:,} ({conectados:,} conectadas)")
+    print(f"Tiempo por consulta:  {duracion_lote / max(1, args.consultas) * 1e6:.3f} µs")
+    print(f"BFS de referencia:    {duracion_bfs * 1e3:.3f} ms por origen")
+    print("=" * 60)
+
+
+if __name__ == "__main__":
+    main()
@@ -37,8 +37,16 @@ if is_windows:
     extra_compile_args = ["/std:c++17", "/O2", "/EHsc"]
     extra_link_args = []
 else:
-    extra_compile_args = ["-std=c++17", "-O3", "-fPIC"]
-    extra_link_args = ["-std=c++17"]
+    extra_compile_args = ["-std=c++17", "-O3", "-fPIC", "-pthread"]
+    extra_link_args = ["-std=c++17", "-pthread"]
+    if platform.system() == "Linux":
+        # shm_open vive en librt en glibc anteriores a 2.34
+        extra_link_args.append("-lrt")
+
+# Contadores de instrumentación (Metricas.h): NEURONET_METRICAS=0 los elimina del binario
+define_macros = []
+if os.environ.get("NEURONET_METRICAS") == "0":
+    define_macros.append(("NEURONET_METRICAS", "0"))
 
 # Definir la extensión
 extensions = [
@@ -47,8 +55,31 @@ extensions = [
         sources=[
             os.path.join(CYTHON_DIR, "grafo_wrapper.pyx"),
             os.path.join(CPP_DIR, "GrafoDisperso.cpp"),
+            os.path.join(CPP_DIR, "LecturaAristas.cpp"),
+            os.path.join(CPP_DIR, "GrafoExterno.cpp"),
+            os.path.join(CPP_DIR, "GrafoParticionado.cpp"),
+            os.path.join(CPP_DIR, "ParticionGrafo.cpp"),
+            os.path.join(CPP_DIR, "CaminatasAleatorias.cpp"),
+            os.path.join(CPP_DIR, "RecorridoBFS.cpp"),
+            os.path.join(CPP_DIR, "RecorridoIncremental.cpp"),
+            os.path.join(CPP_DIR, "Diametro.cpp"),
+            os.path.join(CPP_DIR, "OraculoLandmarks.cpp"),
+            os.path.join(CPP_DIR, "EtiquetadoPodado.cpp"),
+            os.path.join(CPP_DIR, "Motivos.cpp"),
+            os.path.join(CPP_DIR, "Patrones.cpp"),
+            os.path.join(CPP_DIR, "CaminosK.cpp"),
+            os.path.join(CPP_DIR, "FlujoMaximo.cpp"),
+            os.path.join(CPP_DIR, "DisposicionFuerzas.cpp"),
+            os.path.join(CPP_DIR, "MuestreoSubgrafo.cpp"),
+            os.path.join(CPP_DIR, "Trabajos.cpp"),
+            os.path.join(CPP_DIR, "PoolHilos.cpp"),
+            os.path.join(CPP_DIR, "MemoriaCompartida.cpp"),
+            os.path.join(CPP_DIR, "Metricas.cpp"),
+            os.path.join(CPP_DIR, "ContabilidadMemoria.cpp"),
+            os.path.join(CPP_DIR, "ArenaMemoria.cpp"),
         ],
         include_dirs=[CPP_DIR],
+        define_macros=define_macros,
         language="c++",
         extra_compile_args=extra_compile_args,
         extra_link_args=extra_link_args,
@@ -73,6 +104,7 @@ setup(
     python_requires=">=3.7",
     install_requires=[
         "cython>=0.29",
+        "numpy>=1.19",
         "networkx>=2.5",
         "matplotlib>=3.3",
     ],
@@ -0,0 +1,82 @@
+/**
+ * @file Aleatorio.h
+ * @brief Generador pseudoaleatorio rápido y reproducible (xoshiro256**)
+ * @author NeuroNet Team
+ *
+ * Cada flujo se deriva de una semilla global y un identificador de flujo
+ * mediante splitmix64, de modo que los resultados no dependen del número
+ * de hilos ni del orden en que se reparten las tareas.
+ */
+
+#ifndef ALEATORIO_H
+#define ALEATORIO_H
+
+#include <cstdint>
+
+/**
+ * @brief Paso del generador splitmix64, usado para sembrar y mezclar
+ */
+inline uint64_t splitmix64(uint64_t& estado) {
+    uint64_t z = (estado += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @class GeneradorAleatorio
+ * @brief Implementación de xoshiro256** con utilidades de muestreo
+ */
+class GeneradorAleatorio {
+public:
+    /**
+     * @brief Crea el flujo identificado por (semilla, flujo)
+     * @param semilla Semilla global elegida por el usuario
+     * @param flujo Identificador del flujo (caminata, hilo, tarea...)
+     */
+    explicit GeneradorAleatorio(uint64_t semilla, uint64_t flujo = 0) {
+        uint64_t sm = semilla ^ (flujo * 0xD1342543DE82EF95ULL);
+        splitmix64(sm);
+        for (auto& palabra : s) {
+            palabra = splitmix64(sm);
+        }
+    }
+
+    /**
+     * @brief Siguiente valor de 64 bits
+     */
+    uint64_t siguiente() {
+        const uint64_t resultado = rotar(s[1] * 5, 7) * 9;
+        const uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotar(s[3], 45);
+        return resultado;
+    }
+
+    /**
+     * @brief Real uniforme en [0, 1)
+     */
+    double uniforme() {
+        return (siguiente() >> 11) * 0x1.0p-53;
+    }
+
+    /**
+     * @brief Entero uniforme en [0, n) sin sesgo apreciable (método de Lemire)
+     */
+    uint32_t acotado(uint32_t n) {
+        return static_cast<uint32_t>(((siguiente() >> 32) * static_cast<uint64_t>(n)) >> 32);
+    }
+
+private:
+    static uint64_t rotar(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    uint64_t s[4];
+};
+
+#endif // ALEATORIO_H
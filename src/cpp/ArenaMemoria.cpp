@@ -0,0 +1,419 @@
+/**
+ * @file ArenaMemoria.cpp
+ * @brief Bloques mapeados con páginas grandes, arena por hilo y reserva de vectores
+ * @author NeuroNet Team
+ */
+
+#include "ArenaMemoria.h"
+#include "ContabilidadMemoria.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const size_t PAGINA_GRANDE = size_t(2) << 20;
+const size_t TAMANO_BLOQUE_ARENA = size_t(4) << 20;
+const int CLASES_VECTOR = 48;
+const size_t VECTORES_POR_CLASE = 4;
+
+size_t redondear(size_t bytes, size_t multiplo) {
+    return (bytes + multiplo - 1) / multiplo * multiplo;
+}
+
+ModoPaginasGrandes modoInicial() {
+#ifdef _WIN32
+    return ModoPaginasGrandes::Desactivadas;
+#else
+    const char* valor = std::getenv("NEURONET_PAGINAS_GRANDES");
+    if (valor != nullptr && std::strcmp(valor, "0") == 0) {
+        return ModoPaginasGrandes::Desactivadas;
+    }
+    if (valor != nullptr && std::strcmp(valor, "hugetlb") == 0) {
+        return ModoPaginasGrandes::Explicitas;
+    }
+    return ModoPaginasGrandes::Transparentes;
+#endif
+}
+
+std::atomic<int> modoActual{static_cast<int>(modoInicial())};
+
+// Cada llamada a liberarMemoriaRetenida avanza la época; cada hilo
+// suelta lo suyo cuando ve una época nueva
+std::atomic<uint64_t> epocaLiberacion{0};
+
+/**
+ * Cómo se mapeó un bloque grande. Al liberarlo hace falta saberlo (el
+ * modo puede haber cambiado entretanto). Hay pocos bloques grandes, así
+ * que basta un mutex. El registro no se destruye nunca: un hilo puede
+ * liberar durante la salida del proceso.
+ */
+struct MapeoGrande {
+    size_t longitud = 0;
+    bool explicita = false;
+    bool transparente = false;
+};
+
+struct RegistroMapeos {
+    std::mutex mutex;
+    std::unordered_map<void*, MapeoGrande> mapeos;
+    int64_t bytesExplicitas = 0;
+    int64_t bytesTransparentes = 0;
+    int64_t fallosExplicitas = 0;
+};
+
+RegistroMapeos& registroMapeos() {
+    static RegistroMapeos* instancia = new RegistroMapeos();
+    return *instancia;
+}
+
+#ifndef _WIN32
+/**
+ * Mapea un bloque anónimo según el modo actual (nulo si no hay memoria)
+ */
+void* mapearGrande(size_t bytes, MapeoGrande& mapeo, bool& falloExplicita) {
+    ModoPaginasGrandes modo = static_cast<ModoPaginasGrandes>(modoActual.load(std::memory_order_relaxed));
+#ifdef MAP_HUGETLB
+    if (modo == ModoPaginasGrandes::Explicitas) {
+        size_t longitud = redondear(bytes, PAGINA_GRANDE);
+        void* datos = mmap(nullptr, longitud, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (datos != MAP_FAILED) {
+            mapeo.longitud = longitud;
+            mapeo.explicita = true;
+            return datos;
+        }
+        falloExplicita = true;
+    }
+#endif
+    // Se mapean 2 MiB de más y se recortan los extremos: THP solo usa
+    // páginas grandes en tramos alineados a su tamaño
+    size_t longitud = redondear(bytes, static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+    size_t total = longitud + PAGINA_GRANDE;
+    void* base = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        return nullptr;
+    }
+    uintptr_t principio = reinterpret_cast<uintptr_t>(base);
+    uintptr_t inicio = redondear(principio, PAGINA_GRANDE);
+    if (inicio > principio) {
+        munmap(base, inicio - principio);
+    }
+    size_t cola = principio + total - (inicio + longitud);
+    if (cola > 0) {
+        munmap(reinterpret_cast<void*>(inicio + longitud), cola);
+    }
+    void* datos = reinterpret_cast<void*>(inicio);
+    mapeo.longitud = longitud;
+#if defined(MADV_HUGEPAGE) && defined(MADV_NOHUGEPAGE)
+    if (modo == ModoPaginasGrandes::Desactivadas) {
+        madvise(datos, longitud, MADV_NOHUGEPAGE);
+    } else {
+        mapeo.transparente = madvise(datos, longitud, MADV_HUGEPAGE) == 0;
+    }
+#endif
+    return datos;
+}
+#endif
+
+/** floor(log2(capacidad)), capacidad > 0 */
+int claseDe(size_t capacidad) {
+    int clase = 0;
+    while ((capacidad >> (clase + 1)) != 0) {
+        clase++;
+    }
+    return clase;
+}
+
+} // namespace
+
+/**
+ * Vectores devueltos a la reserva de un hilo, agrupados por la potencia
+ * de dos de su capacidad. Casi siempre la usa solo su hilo, pero los
+ * espacios creados por los hilos del pool se destruyen en el que lanzó
+ * el bucle y devuelven aquí sus vectores: el mutex no suele tener
+ * competencia.
+ */
+class ReservaVectores {
+public:
+    std::mutex mutex;
+    std::vector<std::vector<int>> clases[CLASES_VECTOR];
+    int64_t retenidos = 0;
+    uint64_t epoca = 0;
+
+    ~ReservaVectores() {
+        vaciar();
+    }
+
+    void vaciar() {
+        for (auto& clase : clases) {
+            for (const auto& vector : clase) {
+                registrarLiberacion(CategoriaMemoria::Cache,
+                                    static_cast<int64_t>(vector.capacity() * sizeof(int)));
+            }
+            clase.clear();
+        }
+        retenidos = 0;
+    }
+
+    void atenderLiberacion() {
+        uint64_t pedida = epocaLiberacion.load(std::memory_order_relaxed);
+        if (pedida != epoca) {
+            vaciar();
+            epoca = pedida;
+        }
+    }
+};
+
+void* reservarBloque(size_t bytes) {
+#ifndef _WIN32
+    if (bytes >= UMBRAL_BLOQUE_GRANDE) {
+        MapeoGrande mapeo;
+        bool falloExplicita = false;
+        void* datos = mapearGrande(bytes, mapeo, falloExplicita);
+        if (datos == nullptr) {
+            throw std::bad_alloc();
+        }
+        RegistroMapeos& r = registroMapeos();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.mapeos[datos] = mapeo;
+        r.bytesExplicitas += mapeo.explicita ? static_cast<int64_t>(mapeo.longitud) : 0;
+        r.bytesTransparentes += mapeo.transparente ? static_cast<int64_t>(mapeo.longitud) : 0;
+        r.fallosExplicitas += falloExplicita;
+        return datos;
+    }
+#endif
+    return ::operator new(bytes);
+}
+
+void liberarBloque(void* datos, size_t bytes) noexcept {
+    if (datos == nullptr) {
+        return;
+    }
+#ifndef _WIN32
+    if (bytes >= UMBRAL_BLOQUE_GRANDE) {
+        RegistroMapeos& r = registroMapeos();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        auto it = r.mapeos.find(datos);
+        if (it != r.mapeos.end()) {
+            const MapeoGrande& mapeo = it->second;
+            r.bytesExplicitas -= mapeo.explicita ? static_cast<int64_t>(mapeo.longitud) : 0;
+            r.bytesTransparentes -= mapeo.transparente ? static_cast<int64_t>(mapeo.longitud) : 0;
+            munmap(datos, mapeo.longitud);
+            r.mapeos.erase(it);
+        }
+        return;
+    }
+#else
+    (void)bytes;
+#endif
+    ::operator delete(datos);
+}
+
+bool configurarPaginasGrandes(ModoPaginasGrandes modo) {
+#ifdef _WIN32
+    if (modo != ModoPaginasGrandes::Desactivadas) {
+        return false;
+    }
+#else
+#ifndef MAP_HUGETLB
+    if (modo == ModoPaginasGrandes::Explicitas) {
+        return false;
+    }
+#endif
+#ifndef MADV_HUGEPAGE
+    if (modo == ModoPaginasGrandes::Transparentes) {
+        return false;
+    }
+#endif
+#endif
+    modoActual.store(static_cast<int>(modo), std::memory_order_relaxed);
+    return true;
+}
+
+EstadoPaginasGrandes obtenerEstadoPaginasGrandes() {
+    EstadoPaginasGrandes estado;
+    estado.modo = static_cast<ModoPaginasGrandes>(modoActual.load(std::memory_order_relaxed));
+    RegistroMapeos& r = registroMapeos();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    estado.bytesExplicitas = r.bytesExplicitas;
+    estado.bytesTransparentes = r.bytesTransparentes;
+    estado.fallosExplicitas = r.fallosExplicitas;
+    return estado;
+}
+
+const char* nombreModoPaginasGrandes(ModoPaginasGrandes modo) {
+    switch (modo) {
+        case ModoPaginasGrandes::Desactivadas: return "no";
+        case ModoPaginasGrandes::Transparentes: return "thp";
+        case ModoPaginasGrandes::Explicitas: return "explicitas";
+    }
+    return "";
+}
+
+void liberarMemoriaRetenida() {
+    epocaLiberacion.fetch_add(1, std::memory_order_relaxed);
+    ArenaTrabajo& arena = arenaHilo();
+    arena.restaurar(arena.marca());
+    std::shared_ptr<ReservaVectores> reserva = reservaVectoresHilo();
+    std::lock_guard<std::mutex> lock(reserva->mutex);
+    reserva->atenderLiberacion();
+}
+
+ArenaTrabajo::~ArenaTrabajo() {
+    registrarTraspaso(CategoriaMemoria::Temporal, CategoriaMemoria::Cache, enUso);
+    soltarBloques();
+}
+
+void ArenaTrabajo::soltarBloques() {
+    for (const Bloque& bloque : bloques) {
+        registrarLiberacion(CategoriaMemoria::Cache, static_cast<int64_t>(bloque.capacidad));
+        liberarBloque(bloque.datos, bloque.capacidad);
+    }
+    bloques.clear();
+    actual = 0;
+    enUso = 0;
+}
+
+void* ArenaTrabajo::reservar(size_t bytes, size_t alineacion) {
+    while (true) {
+        if (actual < bloques.size()) {
+            Bloque& bloque = bloques[actual];
+            uintptr_t base = reinterpret_cast<uintptr_t>(bloque.datos);
+            uintptr_t inicio = (base + bloque.usado + alineacion - 1) & ~uintptr_t(alineacion - 1);
+            size_t desplazamiento = inicio - base;
+            if (desplazamiento <= bloque.capacidad && bytes <= bloque.capacidad - desplazamiento) {
+                int64_t nuevos = static_cast<int64_t>(desplazamiento + bytes - bloque.usado);
+                bloque.usado = desplazamiento + bytes;
+                enUso += nuevos;
+                registrarTraspaso(CategoriaMemoria::Cache, CategoriaMemoria::Temporal, nuevos);
+                return reinterpret_cast<void*>(inicio);
+            }
+            if (actual + 1 < bloques.size()) {
+                actual++;
+                continue;
+            }
+        }
+
+        // Ningún bloque tiene sitio: uno nuevo, al final
+        size_t capacidad = std::max({TAMANO_BLOQUE_ARENA, capacidadDeseada,
+                                     redondear(bytes + alineacion, PAGINA_GRANDE)});
+        bloques.reserve(bloques.size() + 1);
+        bloques.push_back({static_cast<char*>(reservarBloque(capacidad)), capacidad, 0});
+        registrarReserva(CategoriaMemoria::Cache, static_cast<int64_t>(capacidad));
+        capacidadDeseada = 0;
+        actual = bloques.size() - 1;
+    }
+}
+
+ArenaTrabajo::Marca ArenaTrabajo::marca() const {
+    Marca marca;
+    if (!bloques.empty()) {
+        marca.bloque = actual;
+        marca.usado = bloques[actual].usado;
+    }
+    return marca;
+}
+
+void ArenaTrabajo::restaurar(const Marca& marca) {
+    int64_t devueltos = 0;
+    for (size_t b = marca.bloque + 1; b <= actual && b < bloques.size(); b++) {
+        devueltos += static_cast<int64_t>(bloques[b].usado);
+        bloques[b].usado = 0;
+    }
+    if (marca.bloque < bloques.size()) {
+        devueltos += static_cast<int64_t>(bloques[marca.bloque].usado - marca.usado);
+        bloques[marca.bloque].usado = marca.usado;
+    }
+    actual = marca.bloque;
+    enUso -= devueltos;
+    registrarTraspaso(CategoriaMemoria::Temporal, CategoriaMemoria::Cache, devueltos);
+
+    if (enUso != 0 || bloques.empty()) {
+        return;
+    }
+    // Arena vacía: si hizo falta más de un bloque, la próxima vez se
+    // pide uno solo de la capacidad total; por encima del límite, o si
+    // se pidió liberar, no se retiene nada
+    size_t capacidadTotal = 0;
+    for (const Bloque& bloque : bloques) {
+        capacidadTotal += bloque.capacidad;
+    }
+    uint64_t pedida = epocaLiberacion.load(std::memory_order_relaxed);
+    if (pedida != epoca || capacidadTotal > LIMITE_RETENCION_HILO) {
+        soltarBloques();
+        epoca = pedida;
+    } else if (bloques.size() > 1) {
+        soltarBloques();
+        capacidadDeseada = capacidadTotal;
+    }
+}
+
+ArenaTrabajo& arenaHilo() {
+    thread_local ArenaTrabajo arena;
+    return arena;
+}
+
+std::shared_ptr<ReservaVectores> reservaVectoresHilo() {
+    // La reserva sobrevive al hilo mientras un espacio conserve vectores suyos
+    thread_local std::shared_ptr<ReservaVectores> reserva = std::make_shared<ReservaVectores>();
+    return reserva;
+}
+
+std::vector<int> tomarVectorTrabajo(ReservaVectores& reserva, size_t capacidadMinima) {
+    std::vector<int> vector;
+    if (capacidadMinima == 0) {
+        return vector;
+    }
+    std::lock_guard<std::mutex> lock(reserva.mutex);
+    reserva.atenderLiberacion();
+    // En la clase de capacidadMinima puede haber vectores más pequeños; en
+    // la siguiente todos sirven y ninguno pasa de cuatro veces lo pedido
+    int primera = claseDe(capacidadMinima);
+    for (int clase = primera; clase <= primera + 1 && clase < CLASES_VECTOR; clase++) {
+        auto& candidatos = reserva.clases[clase];
+        for (size_t i = 0; i < candidatos.size(); i++) {
+            if (candidatos[i].capacity() >= capacidadMinima) {
+                std::swap(candidatos[i], candidatos.back());
+                vector.swap(candidatos.back());
+                candidatos.pop_back();
+                int64_t bytes = static_cast<int64_t>(vector.capacity() * sizeof(int));
+                reserva.retenidos -= bytes;
+                registrarTraspaso(CategoriaMemoria::Cache, CategoriaMemoria::Temporal, bytes);
+                vector.clear();
+                return vector;
+            }
+        }
+    }
+    vector.reserve(capacidadMinima);
+    registrarReserva(CategoriaMemoria::Temporal, static_cast<int64_t>(vector.capacity() * sizeof(int)));
+    return vector;
+}
+
+void devolverVectorTrabajo(ReservaVectores& reserva, std::vector<int>&& vector) {
+    if (vector.capacity() == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(reserva.mutex);
+    reserva.atenderLiberacion();
+    int64_t bytes = static_cast<int64_t>(vector.capacity() * sizeof(int));
+    int clase = claseDe(vector.capacity());
+    if (clase >= CLASES_VECTOR || reserva.clases[clase].size() >= VECTORES_POR_CLASE ||
+        reserva.retenidos + bytes > static_cast<int64_t>(LIMITE_RETENCION_HILO)) {
+        registrarLiberacion(CategoriaMemoria::Temporal, bytes);
+        std::vector<int>().swap(vector);
+        return;
+    }
+    reserva.clases[clase].push_back(std::move(vector));
+    reserva.retenidos += bytes;
+    registrarTraspaso(CategoriaMemoria::Temporal, CategoriaMemoria::Cache, bytes);
+}
@@ -0,0 +1,196 @@
+/**
+ * @file ArenaMemoria.h
+ * @brief Memoria de trabajo reutilizable y bloques grandes en páginas grandes
+ * @author NeuroNet Team
+ *
+ * Tres piezas:
+ * - reservarBloque/liberarBloque: los bloques de 2 MiB o más se mapean
+ *   directamente, alineados a 2 MiB y con páginas grandes (THP con
+ *   madvise, o MAP_HUGETLB si se piden explícitas y hay páginas
+ *   reservadas). Los arreglos CSR y los índices reservan así.
+ * - ArenaTrabajo: arena monótona por hilo. Un AmbitoArena toma arreglos
+ *   de trabajo y los devuelve todos al salir del ámbito; los bloques de
+ *   la arena se conservan para la siguiente llamada, así que los
+ *   recorridos repetidos no vuelven a pedir memoria ni a provocar fallos
+ *   de página.
+ * - tomarVectorTrabajo/devolverVectorTrabajo: reserva por clases de
+ *   tamaño (potencias de dos) de std::vector<int>, por hilo, para
+ *   búferes que deben ser vectores (EspacioBFS). Los vectores vuelven a
+ *   la reserva que los prestó aunque se devuelvan desde otro hilo.
+ *
+ * La memoria retenida para reutilizar cuenta como categoría Cache y la
+ * que está en uso como Temporal. Cada hilo retiene como mucho
+ * LIMITE_RETENCION_HILO bytes en su arena y otros tantos en su reserva
+ * de vectores.
+ */
+
+#ifndef ARENA_MEMORIA_H
+#define ARENA_MEMORIA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @enum ModoPaginasGrandes
+ * @brief Respaldo de los bloques grandes
+ */
+enum class ModoPaginasGrandes {
+    Desactivadas = 0,   ///< Páginas normales (MADV_NOHUGEPAGE)
+    Transparentes,      ///< THP con madvise(MADV_HUGEPAGE) (por defecto)
+    Explicitas          ///< MAP_HUGETLB; sin páginas reservadas se usa THP
+};
+
+/**
+ * @struct EstadoPaginasGrandes
+ * @brief Bloques grandes mapeados en este momento
+ */
+struct EstadoPaginasGrandes {
+    ModoPaginasGrandes modo = ModoPaginasGrandes::Desactivadas;
+    int64_t bytesExplicitas = 0;      ///< Mapeados con MAP_HUGETLB
+    int64_t bytesTransparentes = 0;   ///< Mapeados con MADV_HUGEPAGE
+    int64_t fallosExplicitas = 0;     ///< Peticiones MAP_HUGETLB que acabaron en THP
+};
+
+/** Tamaño desde el que un bloque se mapea directamente */
+const size_t UMBRAL_BLOQUE_GRANDE = size_t(2) << 20;
+
+/** Memoria de trabajo que cada hilo puede retener entre llamadas */
+const size_t LIMITE_RETENCION_HILO = size_t(256) << 20;
+
+/**
+ * @brief Reserva un bloque (alineado al menos a 16 bytes)
+ * @throws std::bad_alloc si el sistema no tiene memoria
+ */
+void* reservarBloque(size_t bytes);
+
+/** Libera un bloque de reservarBloque; `bytes` debe ser el mismo tamaño */
+void liberarBloque(void* datos, size_t bytes) noexcept;
+
+/**
+ * @brief Elige el respaldo de los bloques grandes que se reserven a partir de ahora
+ * @return false si la plataforma no admite páginas grandes (el modo no cambia)
+ *
+ * El modo inicial sale de la variable de entorno NEURONET_PAGINAS_GRANDES
+ * ("0", "thp" o "hugetlb"); por defecto, Transparentes.
+ */
+bool configurarPaginasGrandes(ModoPaginasGrandes modo);
+
+EstadoPaginasGrandes obtenerEstadoPaginasGrandes();
+
+const char* nombreModoPaginasGrandes(ModoPaginasGrandes modo);
+
+/**
+ * @brief Pide a todos los hilos que suelten la memoria de trabajo retenida
+ *
+ * El hilo que llama la suelta enseguida; los demás, la próxima vez que
+ * terminen de usar su arena o su reserva de vectores.
+ */
+void liberarMemoriaRetenida();
+
+/**
+ * @class ArenaTrabajo
+ * @brief Arena monótona de un hilo (ver arenaHilo)
+ */
+class ArenaTrabajo {
+public:
+    /** Posición de la arena para volver a ella */
+    struct Marca {
+        size_t bloque = 0;
+        size_t usado = 0;
+    };
+
+    ArenaTrabajo() = default;
+    ~ArenaTrabajo();
+
+    ArenaTrabajo(const ArenaTrabajo&) = delete;
+    ArenaTrabajo& operator=(const ArenaTrabajo&) = delete;
+
+    /**
+     * @brief Memoria sin inicializar, alineada a `alineacion` (potencia de dos)
+     * @throws std::bad_alloc si no se puede ampliar la arena
+     */
+    void* reservar(size_t bytes, size_t alineacion);
+
+    Marca marca() const;
+
+    /** Devuelve todo lo reservado desde `marca` */
+    void restaurar(const Marca& marca);
+
+private:
+    struct Bloque {
+        char* datos;
+        size_t capacidad;
+        size_t usado;
+    };
+
+    std::vector<Bloque> bloques;
+    size_t actual = 0;              ///< Bloque donde se reserva ahora
+    int64_t enUso = 0;              ///< Bytes entregados (con relleno de alineación)
+    size_t capacidadDeseada = 0;    ///< Capacidad del próximo bloque tras consolidar
+    uint64_t epoca = 0;             ///< Última petición de liberarMemoriaRetenida atendida
+
+    void soltarBloques();
+};
+
+/** Arena del hilo actual (se destruye con el hilo) */
+ArenaTrabajo& arenaHilo();
+
+/**
+ * @class AmbitoArena
+ * @brief Toma arreglos de la arena del hilo y los devuelve al destruirse
+ *
+ * Los ámbitos de un hilo deben anidarse (pila); los arreglos no deben
+ * sobrevivir a su ámbito. Otros hilos sí pueden leer y escribir los
+ * arreglos mientras el ámbito vive.
+ */
+class AmbitoArena {
+public:
+    AmbitoArena() : arena(arenaHilo()), inicio(arena.marca()) {}
+    ~AmbitoArena() { arena.restaurar(inicio); }
+
+    AmbitoArena(const AmbitoArena&) = delete;
+    AmbitoArena& operator=(const AmbitoArena&) = delete;
+
+    /** Arreglo sin inicializar de `cantidad` elementos (alineado a 64 bytes) */
+    template <typename T>
+    T* arreglo(size_t cantidad) {
+        const size_t alineacion = alignof(T) > 64 ? alignof(T) : 64;
+        return static_cast<T*>(arena.reservar(cantidad * sizeof(T), alineacion));
+    }
+
+private:
+    ArenaTrabajo& arena;
+    ArenaTrabajo::Marca inicio;
+};
+
+class ReservaVectores;
+
+/**
+ * @brief Reserva de vectores del hilo actual
+ *
+ * Quien toma vectores la conserva para devolvérselos: un espacio que un
+ * hilo del pool crea y el hilo que lanzó el bucle destruye debe volver
+ * a la reserva del primero. La reserva sobrevive a su hilo mientras
+ * alguien la conserve.
+ */
+std::shared_ptr<ReservaVectores> reservaVectoresHilo();
+
+/**
+ * @brief Vector vacío con capacidad para al menos `capacidadMinima` enteros,
+ *        reutilizado de `reserva` si hay uno adecuado
+ *
+ * Su capacidad cuenta como Temporal hasta que se devuelve con
+ * devolverVectorTrabajo, así que no debe crecer por encima de ella.
+ */
+std::vector<int> tomarVectorTrabajo(ReservaVectores& reserva, size_t capacidadMinima);
+
+/**
+ * @brief Devuelve un vector a la reserva que lo prestó (o lo libera si está llena)
+ *
+ * Se puede llamar desde cualquier hilo.
+ */
+void devolverVectorTrabajo(ReservaVectores& reserva, std::vector<int>&& vector);
+
+#endif // ARENA_MEMORIA_H
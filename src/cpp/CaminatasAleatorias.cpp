@@ -0,0 +1,208 @@
+/**
+ * @file CaminatasAleatorias.cpp
+ * @brief Implementación del generador de caminatas aleatorias
+ * @author NeuroNet Team
+ */
+
+#include "CaminatasAleatorias.h"
+#include "Paralelo.h"
+
+GeneradorCaminatas::GeneradorCaminatas(const GrafoDisperso& grafo)
+    : csr(grafo.vistaCSR()), ponderado(false) {
+    for (int i = 0; i < csr.numAristas; i++) {
+        if (csr.valores[i] != 1) {
+            ponderado = true;
+            break;
+        }
+    }
+    if (ponderado) {
+        construirTablasAlias();
+    }
+}
+
+void GeneradorCaminatas::construirTablasAlias() {
+    probAlias.assign(csr.numAristas, 1.0f);
+    indiceAlias.assign(csr.numAristas, 0);
+
+    int hilos = numHilosDisponibles();
+    std::vector<std::vector<int>> pequenosPorHilo(hilos);
+    std::vector<std::vector<int>> grandesPorHilo(hilos);
+    std::vector<std::vector<double>> escaladosPorHilo(hilos);
+
+    // Método de Vose: cada fila obtiene su propia tabla en O(grado)
+    paraleloPara(csr.numNodos, 1024, [&](int64_t desde, int64_t hasta, int hilo) {
+        auto& pequenos = pequenosPorHilo[hilo];
+        auto& grandes = grandesPorHilo[hilo];
+        auto& escalados = escaladosPorHilo[hilo];
+
+        for (int64_t nodo = desde; nodo < hasta; nodo++) {
+            int inicio = csr.rowPtr[nodo];
+            int grado = csr.rowPtr[nodo + 1] - inicio;
+            if (grado == 0) {
+                continue;
+            }
+
+            double suma = 0.0;
+            for (int i = 0; i < grado; i++) {
+                suma += std::max(0, csr.valores[inicio + i]);
+            }
+            if (suma <= 0.0) {
+                continue; // Sin pesos positivos: se muestrea uniforme (prob = 1)
+            }
+
+            escalados.resize(grado);
+            pequenos.clear();
+            grandes.clear();
+            for (int i = 0; i < grado; i++) {
+                escalados[i] = std::max(0, csr.valores[inicio + i]) * grado / suma;
+                (escalados[i] < 1.0 ? pequenos : grandes).push_back(i);
+            }
+
+            while (!pequenos.empty() && !grandes.empty()) {
+                int menor = pequenos.back();
+                pequenos.pop_back();
+                int mayor = grandes.back();
+
+                probAlias[inicio + menor] = static_cast<float>(escalados[menor]);
+                indiceAlias[inicio + menor] = mayor;
+
+                escalados[mayor] -= 1.0 - escalados[menor];
+                if (escalados[mayor] < 1.0) {
+                    grandes.pop_back();
+                    pequenos.push_back(mayor);
+                }
+            }
+            // Los restantes quedan con probabilidad 1 por redondeo
+            for (int i : grandes) probAlias[inicio + i] = 1.0f;
+            for (int i : pequenos) probAlias[inicio + i] = 1.0f;
+        }
+    }, "GeneradorCaminatas::construirTablasAlias", hilos);
+}
+
+bool GeneradorCaminatas::existeArista(int origen, int destino) const {
+    const int* inicio = csr.columnas + csr.rowPtr[origen];
+    const int* fin = csr.columnas + csr.rowPtr[origen + 1];
+    return std::binary_search(inicio, fin, destino);
+}
+
+int GeneradorCaminatas::pasoPrimerOrden(int nodo, GeneradorAleatorio& rng) const {
+    int inicio = csr.rowPtr[nodo];
+    int grado = csr.rowPtr[nodo + 1] - inicio;
+    if (grado == 0) {
+        return -1;
+    }
+
+    int k = static_cast<int>(rng.acotado(static_cast<uint32_t>(grado)));
+    if (ponderado && rng.uniforme() >= probAlias[inicio + k]) {
+        k = indiceAlias[inicio + k];
+    }
+    return csr.columnas[inicio + k];
+}
+
+int GeneradorCaminatas::pasoNode2Vec(int previo, int actual, double pesoRetorno,
+                                     double pesoSalida, double pesoMaximo,
+                                     GeneradorAleatorio& rng) const {
+    // Muestreo de rechazo: se propone con la distribución de primer orden y
+    // se acepta con probabilidad sesgo(x) / sesgoMaximo.
+    while (true) {
+        int candidato = pasoPrimerOrden(actual, rng);
+        if (candidato < 0) {
+            return -1;
+        }
+
+        double sesgo;
+        if (candidato == previo) {
+            sesgo = pesoRetorno;
+        } else if (existeArista(previo, candidato)) {
+            sesgo = 1.0;
+        } else {
+            sesgo = pesoSalida;
+        }
+
+        if (rng.uniforme() * pesoMaximo < sesgo) {
+            return candidato;
+        }
+    }
+}
+
+int64_t GeneradorCaminatas::generar(const std::vector<int>& nodosInicio,
+                                    const ParametrosCaminata& parametros,
+                                    std::vector<int>& salida) const {
+    salida.clear();
+
+    if (parametros.longitud <= 0 || parametros.caminatasPorNodo <= 0 ||
+        parametros.p <= 0.0 || parametros.q <= 0.0) {
+        std::cerr << "[C++ Core] Error: Parametros de caminata invalidos." << std::endl;
+        return 0;
+    }
+
+    std::vector<int> inicios;
+    if (nodosInicio.empty()) {
+        for (int nodo = 0; nodo < csr.numNodos; nodo++) {
+            if (csr.grado(nodo) > 0 || csr.gradoEntrada[nodo] > 0) {
+                inicios.push_back(nodo);
+            }
+        }
+    } else {
+        for (int nodo : nodosInicio) {
+            if (nodo < 0 || nodo >= csr.numNodos) {
+                std::cerr << "[C++ Core] Error: Nodo de inicio invalido (" << nodo << ")." << std::endl;
+                return 0;
+            }
+        }
+        inicios = nodosInicio;
+    }
+
+    std::cout << "[C++ Core] Generando caminatas aleatorias: " << inicios.size()
+              << " nodos x " << parametros.caminatasPorNodo << " repeticiones, longitud "
+              << parametros.longitud << " (p=" << parametros.p << ", q=" << parametros.q
+              << ")..." << std::endl;
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    const int64_t numInicios = static_cast<int64_t>(inicios.size());
+    const int64_t numCaminatas = numInicios * parametros.caminatasPorNodo;
+    const int longitud = parametros.longitud;
+    salida.resize(numCaminatas * longitud);
+
+    const bool sesgado = parametros.p != 1.0 || parametros.q != 1.0;
+    const double pesoRetorno = 1.0 / parametros.p;
+    const double pesoSalida = 1.0 / parametros.q;
+    const double pesoMaximo = std::max(1.0, std::max(pesoRetorno, pesoSalida));
+
+    paraleloPara(numCaminatas, 256, [&](int64_t desde, int64_t hasta, int) {
+        for (int64_t c = desde; c < hasta; c++) {
+            GeneradorAleatorio rng(parametros.semilla, static_cast<uint64_t>(c));
+            int* fila = salida.data() + c * longitud;
+
+            // Las repeticiones recorren la lista completa de inicios en rondas
+            int previo = -1;
+            int actual = inicios[c % numInicios];
+            fila[0] = actual;
+
+            int paso = 1;
+            for (; paso < longitud; paso++) {
+                int siguiente = (sesgado && previo >= 0)
+                    ? pasoNode2Vec(previo, actual, pesoRetorno, pesoSalida, pesoMaximo, rng)
+                    : pasoPrimerOrden(actual, rng);
+                if (siguiente < 0) {
+                    break;
+                }
+                fila[paso] = siguiente;
+                previo = actual;
+                actual = siguiente;
+            }
+            for (; paso < longitud; paso++) {
+                fila[paso] = -1;
+            }
+        }
+    }, "GeneradorCaminatas::generar");
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+
+    std::cout << "[C++ Core] Caminatas generadas: " << numCaminatas
+              << ". Tiempo ejecucion: " << duration.count() << " ms." << std::endl;
+
+    return numCaminatas;
+}
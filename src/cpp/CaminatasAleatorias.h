@@ -0,0 +1,77 @@
+/**
+ * @file CaminatasAleatorias.h
+ * @brief Generador paralelo de caminatas aleatorias (uniformes y node2vec)
+ * @author NeuroNet Team
+ *
+ * Produce millones de caminatas directamente sobre la estructura CSR de
+ * un GrafoDisperso. Las caminatas de primer orden usan tablas alias
+ * cuando el grafo es ponderado; el sesgo de segundo orden de node2vec
+ * (parámetros p, q) se aplica por muestreo de rechazo, que no requiere
+ * tablas por arista previa.
+ */
+
+#ifndef CAMINATAS_ALEATORIAS_H
+#define CAMINATAS_ALEATORIAS_H
+
+#include "GrafoDisperso.h"
+#include "Aleatorio.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct ParametrosCaminata
+ * @brief Configuración de una generación de caminatas
+ */
+struct ParametrosCaminata {
+    int longitud = 80;          ///< Nodos por caminata (incluye el inicial)
+    int caminatasPorNodo = 10;  ///< Caminatas que parten de cada nodo inicial
+    double p = 1.0;             ///< Parámetro de retorno de node2vec
+    double q = 1.0;             ///< Parámetro de entrada/salida de node2vec
+    uint64_t semilla = 42;      ///< Semilla global de reproducibilidad
+};
+
+/**
+ * @class GeneradorCaminatas
+ * @brief Motor de caminatas aleatorias sobre una VistaCSR
+ *
+ * El resultado es una matriz contigua de filas de tamaño `longitud`.
+ * Cuando una caminata llega a un nodo sin aristas salientes, el resto de
+ * la fila se rellena con -1.
+ */
+class GeneradorCaminatas {
+public:
+    /**
+     * @brief Prepara el generador (y las tablas alias si hay pesos)
+     * @param grafo Grafo cuya estructura CSR se recorrerá
+     */
+    explicit GeneradorCaminatas(const GrafoDisperso& grafo);
+
+    /**
+     * @brief Genera las caminatas en paralelo
+     * @param nodosInicio Nodos de partida; vacío significa todos los nodos con aristas
+     * @param parametros Configuración de longitud, repeticiones y sesgo
+     * @param salida Matriz fila-mayor de (caminatas x longitud)
+     * @return Número de caminatas generadas (filas de la matriz)
+     *
+     * La caminata i utiliza su propio flujo aleatorio derivado de
+     * (semilla, i), por lo que el resultado es idéntico sin importar
+     * cuántos hilos participen.
+     */
+    int64_t generar(const std::vector<int>& nodosInicio,
+                    const ParametrosCaminata& parametros,
+                    std::vector<int>& salida) const;
+
+private:
+    VistaCSR csr;                     ///< Estructura recorrida
+    bool ponderado;                   ///< true si algún peso es distinto de 1
+    std::vector<float> probAlias;     ///< Probabilidad de quedarse en cada arista
+    std::vector<int> indiceAlias;     ///< Arista alternativa (índice local en la fila)
+
+    void construirTablasAlias();
+    int pasoPrimerOrden(int nodo, GeneradorAleatorio& rng) const;
+    int pasoNode2Vec(int previo, int actual, double pesoRetorno, double pesoSalida,
+                     double pesoMaximo, GeneradorAleatorio& rng) const;
+    bool existeArista(int origen, int destino) const;
+};
+
+#endif // CAMINATAS_ALEATORIAS_H
@@ -0,0 +1,263 @@
+/**
+ * @file CaminosK.cpp
+ * @brief Implementación del algoritmo de Yen con búsquedas BFS reutilizables
+ * @author NeuroNet Team
+ */
+
+#include "CaminosK.h"
+#include <set>
+
+namespace {
+
+/**
+ * Orden de los candidatos: longitud y luego lexicográfico, para que el
+ * resultado sea determinista ante empates
+ */
+struct MenorCamino {
+    bool operator()(const std::vector<int>& a, const std::vector<int>& b) const {
+        return a.size() != b.size() ? a.size() < b.size() : a < b;
+    }
+};
+
+bool contiene(const std::vector<int>& lista, int valor) {
+    return std::find(lista.begin(), lista.end(), valor) != lista.end();
+}
+
+} // namespace
+
+BuscadorCaminosK::BuscadorCaminosK(const GrafoDisperso& g)
+    : grafo(g), csr(g.vistaCSR()),
+      adelante(csr.numNodos), atras(0),
+      padreAdelante(csr.numNodos), bloqueado(csr.numNodos, 0) {
+}
+
+bool BuscadorCaminosK::caminoBFS(int desde, int hasta, const std::vector<int>& aristasBloqueadas,
+                                 std::vector<int>& camino) {
+    adelante.reiniciar();
+    int* distancia = adelante.distancia.data();
+    std::vector<int>& cola = adelante.visitados;
+
+    distancia[desde] = 0;
+    cola.push_back(desde);
+
+    size_t cabeza = 0;
+    while (cabeza < cola.size() && distancia[hasta] < 0) {
+        int u = cola[cabeza++];
+        for (int i = csr.rowPtr[u]; i < csr.rowPtr[u + 1]; i++) {
+            int v = csr.columnas[i];
+            if (distancia[v] >= 0 || bloqueado[v]) {
+                continue;
+            }
+            if (u == desde && contiene(aristasBloqueadas, v)) {
+                continue;
+            }
+            distancia[v] = distancia[u] + 1;
+            padreAdelante[v] = u;
+            cola.push_back(v);
+            if (v == hasta) {
+                break;
+            }
+        }
+    }
+
+    if (distancia[hasta] < 0) {
+        return false;
+    }
+    camino.resize(distancia[hasta] + 1);
+    for (int v = hasta, pos = distancia[hasta]; pos >= 0; pos--) {
+        camino[pos] = v;
+        v = padreAdelante[v];
+    }
+    return true;
+}
+
+bool BuscadorCaminosK::caminoBidireccional(int desde, int hasta,
+                                           const std::vector<int>& aristasBloqueadas,
+                                           std::vector<int>& camino) {
+    if (desde == hasta) {
+        camino.assign(1, desde);
+        return true;
+    }
+
+    adelante.reiniciar();
+    atras.reiniciar();
+    int* distAdelante = adelante.distancia.data();
+    int* distAtras = atras.distancia.data();
+
+    distAdelante[desde] = 0;
+    adelante.visitados.push_back(desde);
+    distAtras[hasta] = 0;
+    atras.visitados.push_back(hasta);
+
+    // [inicio, fin) delimita el nivel actual dentro de cada cola
+    size_t inicioAdelante = 0, inicioAtras = 0;
+    int encuentro = -1;
+    int mejor = 0;
+
+    while (encuentro < 0 && inicioAdelante < adelante.visitados.size() &&
+           inicioAtras < atras.visitados.size()) {
+        size_t finAdelante = adelante.visitados.size();
+        size_t finAtras = atras.visitados.size();
+
+        // Se expande por niveles completos el lado con la frontera menor
+        if (finAdelante - inicioAdelante <= finAtras - inicioAtras) {
+            for (size_t c = inicioAdelante; c < finAdelante; c++) {
+                int u = adelante.visitados[c];
+                for (int i = csr.rowPtr[u]; i < csr.rowPtr[u + 1]; i++) {
+                    int v = csr.columnas[i];
+                    if (distAdelante[v] >= 0 || bloqueado[v]) {
+                        continue;
+                    }
+                    if (u == desde && contiene(aristasBloqueadas, v)) {
+                        continue;
+                    }
+                    distAdelante[v] = distAdelante[u] + 1;
+                    padreAdelante[v] = u;
+                    adelante.visitados.push_back(v);
+                    if (distAtras[v] >= 0 && (encuentro < 0 || distAdelante[v] + distAtras[v] < mejor)) {
+                        encuentro = v;
+                        mejor = distAdelante[v] + distAtras[v];
+                    }
+                }
+            }
+            inicioAdelante = finAdelante;
+        } else {
+            for (size_t c = inicioAtras; c < finAtras; c++) {
+                int u = atras.visitados[c];
+                for (int i = transpuesta.rowPtr[u]; i < transpuesta.rowPtr[u + 1]; i++) {
+                    int v = transpuesta.columnas[i];
+                    if (distAtras[v] >= 0 || bloqueado[v]) {
+                        continue;
+                    }
+                    if (v == desde && contiene(aristasBloqueadas, u)) {
+                        continue;
+                    }
+                    distAtras[v] = distAtras[u] + 1;
+                    padreAtras[v] = u;
+                    atras.visitados.push_back(v);
+                    if (distAdelante[v] >= 0 && (encuentro < 0 || distAdelante[v] + distAtras[v] < mejor)) {
+                        encuentro = v;
+                        mejor = distAdelante[v] + distAtras[v];
+                    }
+                }
+            }
+            inicioAtras = finAtras;
+        }
+    }
+
+    if (encuentro < 0) {
+        return false;
+    }
+
+    // Mitad hacia el origen por los padres de adelante, mitad hacia el
+    // destino por los padres de atrás
+    camino.resize(mejor + 1);
+    int v = encuentro;
+    for (int pos = distAdelante[encuentro]; pos >= 0; pos--) {
+        camino[pos] = v;
+        v = padreAdelante[v];
+    }
+    v = encuentro;
+    for (int pos = distAdelante[encuentro]; pos <= mejor; pos++) {
+        camino[pos] = v;
+        v = padreAtras[v];
+    }
+    return true;
+}
+
+int BuscadorCaminosK::calcular(int origen, int destino, int k, bool bidireccional,
+                               std::vector<int>& offsets, std::vector<int>& nodos) {
+    offsets.assign(1, 0);
+    nodos.clear();
+
+    if (origen < 0 || origen >= csr.numNodos || destino < 0 || destino >= csr.numNodos) {
+        std::cerr << "[C++ Core] Error: Nodo de origen o destino invalido." << std::endl;
+        return -1;
+    }
+    if (k < 1) {
+        std::cerr << "[C++ Core] Error: k debe ser positivo." << std::endl;
+        return -1;
+    }
+
+    std::cout << "[C++ Core] Buscando " << k << " caminos mas cortos de " << origen
+              << " a " << destino << (bidireccional ? " (BFS bidireccional)" : "")
+              << "..." << std::endl;
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    if (bidireccional && transpuesta.rowPtr == nullptr) {
+        transpuesta = grafo.vistaTranspuesta(rowPtrT, columnasT);
+        atras = EspacioBFS(csr.numNodos);
+        padreAtras.assign(csr.numNodos, -1);
+    }
+    auto buscar = [&](int desde, const std::vector<int>& aristasBloqueadas, std::vector<int>& camino) {
+        return bidireccional ? caminoBidireccional(desde, destino, aristasBloqueadas, camino)
+                             : caminoBFS(desde, destino, aristasBloqueadas, camino);
+    };
+
+    std::vector<std::vector<int>> aceptados;
+    std::set<std::vector<int>, MenorCamino> candidatos;
+    std::set<std::vector<int>> yaAceptados;
+    std::vector<int> camino;
+    std::vector<int> aristasBloqueadas;
+    int busquedas = 1;
+
+    if (buscar(origen, aristasBloqueadas, camino)) {
+        aceptados.push_back(camino);
+        yaAceptados.insert(camino);
+    }
+
+    while (!aceptados.empty() && static_cast<int>(aceptados.size()) < k) {
+        const std::vector<int> previo = aceptados.back();
+
+        for (size_t i = 0; i + 1 < previo.size(); i++) {
+            int desvio = previo[i];
+
+            // Aristas de salida del desvío ya usadas por caminos con el mismo prefijo
+            aristasBloqueadas.clear();
+            for (const auto& otro : aceptados) {
+                if (otro.size() > i + 1 && std::equal(previo.begin(), previo.begin() + i + 1, otro.begin())) {
+                    aristasBloqueadas.push_back(otro[i + 1]);
+                }
+            }
+            // El prefijo no puede repetirse: el camino debe ser simple
+            for (size_t j = 0; j < i; j++) {
+                bloqueado[previo[j]] = 1;
+            }
+
+            busquedas++;
+            bool encontrado = buscar(desvio, aristasBloqueadas, camino);
+
+            for (size_t j = 0; j < i; j++) {
+                bloqueado[previo[j]] = 0;
+            }
+
+            if (encontrado) {
+                std::vector<int> candidato(previo.begin(), previo.begin() + i);
+                candidato.insert(candidato.end(), camino.begin(), camino.end());
+                if (yaAceptados.find(candidato) == yaAceptados.end()) {
+                    candidatos.insert(std::move(candidato));
+                }
+            }
+        }
+
+        if (candidatos.empty()) {
+            break;
+        }
+        aceptados.push_back(*candidatos.begin());
+        yaAceptados.insert(aceptados.back());
+        candidatos.erase(candidatos.begin());
+    }
+
+    for (const auto& c : aceptados) {
+        nodos.insert(nodos.end(), c.begin(), c.end());
+        offsets.push_back(static_cast<int>(nodos.size()));
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+    std::cout << "[C++ Core] Caminos encontrados: " << aceptados.size() << " (" << busquedas
+              << " busquedas de desvio). Tiempo ejecucion: " << duration.count() / 1000.0
+              << " ms." << std::endl;
+
+    return static_cast<int>(aceptados.size());
+}
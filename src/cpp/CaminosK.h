@@ -0,0 +1,62 @@
+/**
+ * @file CaminosK.h
+ * @brief k caminos simples más cortos entre dos nodos (algoritmo de Yen)
+ * @author NeuroNet Team
+ *
+ * Cada camino nuevo se obtiene desviándose de uno ya aceptado en alguno
+ * de sus nodos ("spur"): se bloquean los nodos del prefijo y las aristas
+ * que ya usaron los caminos con ese mismo prefijo, y se busca el camino
+ * mínimo restante. Las búsquedas de desvío son BFS (longitud en saltos),
+ * opcionalmente bidireccionales, y reutilizan los mismos espacios de
+ * trabajo durante toda la consulta.
+ */
+
+#ifndef CAMINOS_K_H
+#define CAMINOS_K_H
+
+#include "GrafoDisperso.h"
+#include "RecorridoBFS.h"
+#include <vector>
+
+/**
+ * @class BuscadorCaminosK
+ * @brief Consultas de k caminos simples más cortos sobre un grafo dirigido
+ */
+class BuscadorCaminosK {
+public:
+    explicit BuscadorCaminosK(const GrafoDisperso& grafo);
+
+    /**
+     * @brief Calcula hasta k caminos simples de origen a destino
+     * @param origen Nodo inicial
+     * @param destino Nodo final
+     * @param k Número máximo de caminos
+     * @param bidireccional Usar BFS bidireccional en las búsquedas de desvío
+     * @param offsets Salida: el camino i ocupa nodos[offsets[i]:offsets[i+1]]
+     * @param nodos Salida: caminos concatenados, de origen a destino
+     * @return Caminos encontrados (en orden de longitud creciente), o -1
+     *         si los parámetros son inválidos
+     */
+    int calcular(int origen, int destino, int k, bool bidireccional,
+                 std::vector<int>& offsets, std::vector<int>& nodos);
+
+private:
+    const GrafoDisperso& grafo;
+    VistaCSR csr;
+    VectorIndice<int> rowPtrT, columnasT;
+    VistaCSR transpuesta;   ///< Solo se construye si se pide la variante bidireccional
+
+    // Espacios reutilizados entre búsquedas de desvío
+    EspacioBFS adelante;
+    EspacioBFS atras;
+    std::vector<int> padreAdelante;
+    std::vector<int> padreAtras;
+    std::vector<char> bloqueado;
+
+    bool caminoBFS(int desde, int hasta, const std::vector<int>& aristasBloqueadas,
+                   std::vector<int>& camino);
+    bool caminoBidireccional(int desde, int hasta, const std::vector<int>& aristasBloqueadas,
+                             std::vector<int>& camino);
+};
+
+#endif // CAMINOS_K_H
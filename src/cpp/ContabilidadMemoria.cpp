@@ -0,0 +1,130 @@
+/**
+ * @file ContabilidadMemoria.cpp
+ * @brief Contadores globales de memoria y muestreo del RSS
+ * @author NeuroNet Team
+ */
+
+#include "ContabilidadMemoria.h"
+#include <atomic>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <cstdio>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const int CATEGORIAS = static_cast<int>(CategoriaMemoria::Cantidad);
+
+// Atómicos compartidos por todos los hilos. Los arreglos contables son
+// grandes y poco frecuentes; la arena y la reserva de vectores, en cambio,
+// actualizan los contadores en cada recorrido, pero solo unas pocas veces
+// por llamada (no por nodo), y sus traspasos entre Cache y Temporal no
+// tocan el total
+std::atomic<int64_t> actuales[CATEGORIAS] = {};
+std::atomic<int64_t> picos[CATEGORIAS] = {};
+std::atomic<int64_t> total{0};
+std::atomic<int64_t> totalPico{0};
+
+void elevar(std::atomic<int64_t>& pico, int64_t valor) {
+    int64_t anterior = pico.load(std::memory_order_relaxed);
+    while (valor > anterior &&
+           !pico.compare_exchange_weak(anterior, valor, std::memory_order_relaxed)) {
+    }
+}
+
+/**
+ * Muestrea el RSS actual y el pico del proceso en bytes (-1 si no se puede)
+ */
+void muestrearRSS(int64_t& rss, int64_t& rssPico) {
+    rss = -1;
+    rssPico = -1;
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS contadores;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &contadores, sizeof(contadores))) {
+        rss = static_cast<int64_t>(contadores.WorkingSetSize);
+        rssPico = static_cast<int64_t>(contadores.PeakWorkingSetSize);
+    }
+#else
+    // Linux: segundo campo de /proc/self/statm, en páginas
+    if (FILE* statm = std::fopen("/proc/self/statm", "r")) {
+        long long paginas = 0;
+        long long residentes = 0;
+        if (std::fscanf(statm, "%lld %lld", &paginas, &residentes) == 2) {
+            rss = residentes * static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+        }
+        std::fclose(statm);
+    }
+    struct rusage uso;
+    if (getrusage(RUSAGE_SELF, &uso) == 0) {
+#ifdef __APPLE__
+        rssPico = static_cast<int64_t>(uso.ru_maxrss);         // bytes
+#else
+        rssPico = static_cast<int64_t>(uso.ru_maxrss) * 1024;  // KiB
+#endif
+    }
+    if (rss > rssPico && rssPico >= 0) {
+        rssPico = rss;
+    }
+#endif
+}
+
+} // namespace
+
+void registrarReserva(CategoriaMemoria categoria, int64_t bytes) {
+    int c = static_cast<int>(categoria);
+    elevar(picos[c], actuales[c].fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    elevar(totalPico, total.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+}
+
+void registrarLiberacion(CategoriaMemoria categoria, int64_t bytes) {
+    actuales[static_cast<int>(categoria)].fetch_sub(bytes, std::memory_order_relaxed);
+    total.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void registrarTraspaso(CategoriaMemoria origen, CategoriaMemoria destino, int64_t bytes) {
+    if (bytes == 0) {
+        return;
+    }
+    int d = static_cast<int>(destino);
+    actuales[static_cast<int>(origen)].fetch_sub(bytes, std::memory_order_relaxed);
+    elevar(picos[d], actuales[d].fetch_add(bytes, std::memory_order_relaxed) + bytes);
+}
+
+EstadoMemoria obtenerEstadoMemoria() {
+    EstadoMemoria estado;
+    for (int c = 0; c < CATEGORIAS; c++) {
+        estado.actual[c] = actuales[c].load(std::memory_order_relaxed);
+        estado.pico[c] = picos[c].load(std::memory_order_relaxed);
+    }
+    estado.total = total.load(std::memory_order_relaxed);
+    estado.totalPico = totalPico.load(std::memory_order_relaxed);
+    muestrearRSS(estado.rss, estado.rssPico);
+    return estado;
+}
+
+void reiniciarPicosMemoria() {
+    for (int c = 0; c < CATEGORIAS; c++) {
+        picos[c].store(actuales[c].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    totalPico.store(total.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+const char* nombreCategoriaMemoria(CategoriaMemoria categoria) {
+    switch (categoria) {
+        case CategoriaMemoria::Grafo: return "grafo";
+        case CategoriaMemoria::Temporal: return "temporal";
+        case CategoriaMemoria::Cache: return "cache";
+        case CategoriaMemoria::Indice: return "indice";
+        case CategoriaMemoria::Cantidad: break;
+    }
+    return "";
+}
@@ -0,0 +1,183 @@
+/**
+ * @file ContabilidadMemoria.h
+ * @brief Contabilidad de memoria por categoría: bytes actuales, picos y RSS
+ * @author NeuroNet Team
+ *
+ * Los arreglos grandes del núcleo reservan con AsignadorContable, que
+ * suma y resta sus bytes en la categoría de su tipo:
+ * - Grafo: arreglos CSR (filas, columnas, pesos, IDs originales).
+ * - Temporal: memoria que solo vive durante una operación (las aristas
+ *   leídas antes de construir el CSR, los búferes de los recorridos).
+ * - Cache: datos derivados que se podrían recalcular (grado de entrada)
+ *   y memoria de trabajo retenida para reutilizarla (ArenaMemoria.h).
+ * - Indice: estructuras de consulta construidas sobre el grafo
+ *   (landmarks, etiquetado podado, vistas no dirigidas).
+ *
+ * Las categorías Grafo e Indice reservan con reservarBloque, que respalda
+ * los arreglos grandes con páginas grandes.
+ *
+ * El pico del total es el de la suma, no la suma de los picos. El RSS se
+ * muestrea del sistema operativo e incluye todo lo que no pasa por aquí
+ * (el intérprete, NumPy, páginas mapeadas).
+ */
+
+#ifndef CONTABILIDAD_MEMORIA_H
+#define CONTABILIDAD_MEMORIA_H
+
+#include "ArenaMemoria.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @enum CategoriaMemoria
+ * @brief A qué se dedica una reserva
+ */
+enum class CategoriaMemoria {
+    Grafo = 0,
+    Temporal,
+    Cache,
+    Indice,
+    Cantidad      ///< Número de categorías (no es una categoría)
+};
+
+/**
+ * @struct EstadoMemoria
+ * @brief Instantánea de los contadores y del RSS del proceso
+ */
+struct EstadoMemoria {
+    int64_t actual[static_cast<int>(CategoriaMemoria::Cantidad)] = {};
+    int64_t pico[static_cast<int>(CategoriaMemoria::Cantidad)] = {};
+    int64_t total = 0;       ///< Suma de las categorías
+    int64_t totalPico = 0;   ///< Mayor valor alcanzado por la suma
+    int64_t rss = -1;        ///< Memoria residente del proceso (-1 si no se puede leer)
+    int64_t rssPico = -1;    ///< Pico de RSS según el sistema (no se reinicia)
+};
+
+/** Suma bytes a una categoría y actualiza los picos */
+void registrarReserva(CategoriaMemoria categoria, int64_t bytes);
+
+/** Resta bytes de una categoría */
+void registrarLiberacion(CategoriaMemoria categoria, int64_t bytes);
+
+/**
+ * @brief Pasa bytes de una categoría a otra sin cambiar el total
+ *
+ * Para la memoria retenida que vuelve a usarse (Cache a Temporal) y la
+ * que se devuelve para reutilizarla (Temporal a Cache).
+ */
+void registrarTraspaso(CategoriaMemoria origen, CategoriaMemoria destino, int64_t bytes);
+
+/**
+ * @brief Lee los contadores y muestrea el RSS
+ */
+EstadoMemoria obtenerEstadoMemoria();
+
+/**
+ * @brief Lleva los picos contabilizados a los valores actuales
+ *
+ * Para medir el pico de una operación: reiniciar, ejecutarla y leer
+ * obtenerEstadoMemoria().totalPico. El pico de RSS lo mantiene el
+ * sistema y no se reinicia.
+ */
+void reiniciarPicosMemoria();
+
+/** Nombre de una categoría ("grafo", "temporal", "cache", "indice") */
+const char* nombreCategoriaMemoria(CategoriaMemoria categoria);
+
+/**
+ * @class AsignadorContable
+ * @brief std::allocator que contabiliza sus bytes en la categoría C
+ */
+template <typename T, CategoriaMemoria C>
+class AsignadorContable {
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AsignadorContable<U, C>;
+    };
+
+    AsignadorContable() noexcept = default;
+
+    template <typename U>
+    AsignadorContable(const AsignadorContable<U, C>&) noexcept {}
+
+    T* allocate(std::size_t cantidad) {
+        T* datos = enBloques() ? static_cast<T*>(reservarBloque(cantidad * sizeof(T)))
+                               : std::allocator<T>().allocate(cantidad);
+        registrarReserva(C, static_cast<int64_t>(cantidad * sizeof(T)));
+        return datos;
+    }
+
+    void deallocate(T* datos, std::size_t cantidad) noexcept {
+        registrarLiberacion(C, static_cast<int64_t>(cantidad * sizeof(T)));
+        if (enBloques()) {
+            liberarBloque(datos, cantidad * sizeof(T));
+        } else {
+            std::allocator<T>().deallocate(datos, cantidad);
+        }
+    }
+
+    template <typename U>
+    bool operator==(const AsignadorContable<U, C>&) const noexcept { return true; }
+
+    template <typename U>
+    bool operator!=(const AsignadorContable<U, C>&) const noexcept { return false; }
+
+private:
+    /** Los arreglos duraderos y grandes van a bloques con páginas grandes */
+    static constexpr bool enBloques() {
+        return (C == CategoriaMemoria::Grafo || C == CategoriaMemoria::Indice) && alignof(T) <= 16;
+    }
+};
+
+/** Vector cuya memoria se contabiliza en la categoría C */
+template <typename T, CategoriaMemoria C>
+using VectorContable = std::vector<T, AsignadorContable<T, C>>;
+
+template <typename T>
+using VectorGrafo = VectorContable<T, CategoriaMemoria::Grafo>;
+
+template <typename T>
+using VectorTemporal = VectorContable<T, CategoriaMemoria::Temporal>;
+
+template <typename T>
+using VectorCache = VectorContable<T, CategoriaMemoria::Cache>;
+
+template <typename T>
+using VectorIndice = VectorContable<T, CategoriaMemoria::Indice>;
+
+/**
+ * @class ReservaContable
+ * @brief Contabiliza bytes reservados por otros medios (new[], reserve
+ *        de un tamaño fijo) mientras el objeto vive
+ */
+class ReservaContable {
+public:
+    ReservaContable(CategoriaMemoria categoria, int64_t bytes) : categoria(categoria), bytes(bytes) {
+        registrarReserva(categoria, bytes);
+    }
+
+    ~ReservaContable() {
+        registrarLiberacion(categoria, bytes);
+    }
+
+    ReservaContable(const ReservaContable& otra) : ReservaContable(otra.categoria, otra.bytes) {}
+
+    ReservaContable& operator=(const ReservaContable& otra) {
+        registrarLiberacion(categoria, bytes);
+        categoria = otra.categoria;
+        bytes = otra.bytes;
+        registrarReserva(categoria, bytes);
+        return *this;
+    }
+
+private:
+    CategoriaMemoria categoria;
+    int64_t bytes;
+};
+
+#endif // CONTABILIDAD_MEMORIA_H
@@ -0,0 +1,227 @@
+/**
+ * @file Diametro.cpp
+ * @brief Implementación de iFUB y del acotamiento de excentricidades
+ * @author NeuroNet Team
+ */
+
+#include "Diametro.h"
+
+AnalizadorDiametro::AnalizadorDiametro(const GrafoDisperso& grafo)
+    : csr(grafo.vistaNoDirigida(rowPtr, columnas)), espacio(csr.numNodos) {
+}
+
+int AnalizadorDiametro::bfs(int origen) {
+    return bfsDistancias(csr, origen, espacio);
+}
+
+int AnalizadorDiametro::nodoMasLejano() const {
+    // El último nodo de la cola BFS está en el nivel más profundo
+    return espacio.visitados.back();
+}
+
+int AnalizadorDiametro::nodoIntermedio(int destino, int pasos) const {
+    // Retrocede por el árbol BFS implícito: un vecino con distancia - 1
+    int actual = destino;
+    for (int k = 0; k < pasos; k++) {
+        int nivel = espacio.distancia[actual];
+        for (int i = csr.rowPtr[actual]; i < csr.rowPtr[actual + 1]; i++) {
+            if (espacio.distancia[csr.columnas[i]] == nivel - 1) {
+                actual = csr.columnas[i];
+                break;
+            }
+        }
+    }
+    return actual;
+}
+
+std::vector<int> AnalizadorDiametro::mayorComponente() {
+    std::vector<bool> asignado(csr.numNodos, false);
+    std::vector<int> mejor;
+
+    for (int nodo = 0; nodo < csr.numNodos; nodo++) {
+        if (asignado[nodo] || csr.grado(nodo) == 0) {
+            continue;
+        }
+        bfs(nodo);
+        for (int v : espacio.visitados) {
+            asignado[v] = true;
+        }
+        if (espacio.visitados.size() > mejor.size()) {
+            mejor = espacio.visitados;
+        }
+    }
+    return mejor;
+}
+
+ResultadoDiametro AnalizadorDiametro::calcularDiametro(CallbackProgreso callback, void* contexto) {
+    std::cout << "[C++ Core] Calculando diametro (iFUB) sobre la vista no dirigida..." << std::endl;
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    ResultadoDiametro resultado;
+    std::vector<int> componente = mayorComponente();
+    resultado.nodosComponente = static_cast<int>(componente.size());
+    if (componente.size() <= 1) {
+        resultado.exacto = true;
+        return resultado;
+    }
+
+    int cotaInferior = 0;
+    int cotaSuperior = INT_MAX;
+    int bfsRealizados = 0;
+
+    auto reportar = [&]() {
+        bfsRealizados++;
+        if (callback == nullptr) {
+            return true;
+        }
+        ProgresoDiametro progreso;
+        progreso.bfsRealizados = bfsRealizados;
+        progreso.cotaInferior = cotaInferior;
+        progreso.cotaSuperior = cotaSuperior;
+        return callback(contexto, progreso);
+    };
+
+    auto terminar = [&](bool exacto) {
+        resultado.cotaInferior = cotaInferior;
+        resultado.cotaSuperior = exacto ? cotaInferior : cotaSuperior;
+        resultado.diametro = cotaInferior;
+        resultado.bfsRealizados = bfsRealizados;
+        resultado.exacto = exacto;
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+        std::cout << "[C++ Core] Diametro " << (exacto ? "exacto" : "acotado") << ": "
+                  << cotaInferior << " (BFS: " << bfsRealizados << "). Tiempo ejecucion: "
+                  << duration.count() << " ms." << std::endl;
+        return resultado;
+    };
+
+    // 4-Sweep: dos barridos dobles desde nodos cada vez más centrales
+    int centro = componente[0];
+    for (int v : componente) {
+        if (csr.grado(v) > csr.grado(centro)) {
+            centro = v;
+        }
+    }
+    for (int barrido = 0; barrido < 2; barrido++) {
+        bfs(centro);
+        int a = nodoMasLejano();
+        if (!reportar()) return terminar(false);
+
+        int excA = bfs(a);
+        int b = nodoMasLejano();
+        cotaInferior = std::max(cotaInferior, excA);
+        centro = nodoIntermedio(b, excA / 2);
+        if (!reportar()) return terminar(false);
+    }
+
+    // iFUB: se recorren las capas del centro de la más lejana hacia adentro
+    int excCentro = bfs(centro);
+    std::vector<int> ordenCentro = espacio.visitados;
+    std::vector<int> inicioCapa(excCentro + 2, 0);
+    for (int v : ordenCentro) {
+        inicioCapa[espacio.distancia[v] + 1]++;
+    }
+    for (int i = 1; i <= excCentro + 1; i++) {
+        inicioCapa[i] += inicioCapa[i - 1];
+    }
+
+    cotaInferior = std::max(cotaInferior, excCentro);
+    cotaSuperior = 2 * excCentro;
+    if (!reportar()) return terminar(false);
+
+    for (int capa = excCentro; capa > 0 && cotaSuperior > cotaInferior; capa--) {
+        int maxCapa = 0;
+        for (int k = inicioCapa[capa]; k < inicioCapa[capa + 1]; k++) {
+            maxCapa = std::max(maxCapa, bfs(ordenCentro[k]));
+            cotaInferior = std::max(cotaInferior, maxCapa);
+            if (!reportar()) return terminar(false);
+        }
+        // Cualquier par más lejano tendría un extremo en una capa < capa
+        if (cotaInferior > 2 * (capa - 1)) {
+            break;
+        }
+        cotaSuperior = 2 * (capa - 1);
+    }
+
+    return terminar(true);
+}
+
+int AnalizadorDiametro::calcularExcentricidades(std::vector<int>& inferior, std::vector<int>& superior,
+                                                int maxBFS, CallbackProgreso callback, void* contexto) {
+    std::cout << "[C++ Core] Acotando excentricidades (Takes-Kosters)..." << std::endl;
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    const int n = csr.numNodos;
+    inferior.assign(n, 0);
+    superior.assign(n, INT_MAX);
+
+    // Nodos aislados: excentricidad 0 resuelta de inmediato
+    std::vector<int> candidatos;
+    for (int v = 0; v < n; v++) {
+        if (csr.grado(v) == 0) {
+            superior[v] = 0;
+        } else {
+            candidatos.push_back(v);
+        }
+    }
+
+    int bfsRealizados = 0;
+    bool elegirSuperior = true;
+    while (!candidatos.empty() && (maxBFS <= 0 || bfsRealizados < maxBFS)) {
+        // Alterna entre la mayor cota superior y la menor cota inferior
+        int elegido = candidatos[0];
+        for (int v : candidatos) {
+            bool mejor = elegirSuperior
+                ? (superior[v] > superior[elegido] ||
+                   (superior[v] == superior[elegido] && csr.grado(v) > csr.grado(elegido)))
+                : (inferior[v] < inferior[elegido] ||
+                   (inferior[v] == inferior[elegido] && csr.grado(v) > csr.grado(elegido)));
+            if (mejor) {
+                elegido = v;
+            }
+        }
+        elegirSuperior = !elegirSuperior;
+
+        int excentricidad = bfs(elegido);
+        bfsRealizados++;
+        for (int w : espacio.visitados) {
+            int d = espacio.distancia[w];
+            inferior[w] = std::max(inferior[w], std::max(excentricidad - d, d));
+            superior[w] = std::min(superior[w], excentricidad + d);
+        }
+
+        size_t restantes = 0;
+        int cotaInferior = 0;
+        int cotaSuperior = 0;
+        for (int v : candidatos) {
+            if (inferior[v] != superior[v]) {
+                candidatos[restantes++] = v;
+            }
+        }
+        candidatos.resize(restantes);
+
+        if (callback != nullptr) {
+            for (int v = 0; v < n; v++) {
+                cotaInferior = std::max(cotaInferior, inferior[v]);
+                cotaSuperior = std::max(cotaSuperior, superior[v]);
+            }
+            ProgresoDiametro progreso;
+            progreso.bfsRealizados = bfsRealizados;
+            progreso.cotaInferior = cotaInferior;
+            progreso.cotaSuperior = cotaSuperior;
+            progreso.pendientes = static_cast<int>(candidatos.size());
+            if (!callback(contexto, progreso)) {
+                break;
+            }
+        }
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+    std::cout << "[C++ Core] Excentricidades: " << (n - candidatos.size()) << " de " << n
+              << " nodos resueltos con " << bfsRealizados << " BFS. Tiempo ejecucion: "
+              << duration.count() << " ms." << std::endl;
+
+    return bfsRealizados;
+}
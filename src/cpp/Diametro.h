@@ -0,0 +1,99 @@
+/**
+ * @file Diametro.h
+ * @brief Diámetro exacto (iFUB) y cotas de excentricidad (Takes-Kosters)
+ * @author NeuroNet Team
+ *
+ * Ambos cálculos se definen sobre la vista no dirigida del grafo y evitan
+ * el BFS desde todos los nodos: iFUB acota el diámetro con unos pocos BFS
+ * desde las capas más lejanas de un nodo central, y el algoritmo de
+ * Takes-Kosters refina cotas inferiores y superiores de la excentricidad
+ * de todos los nodos hasta que coinciden.
+ */
+
+#ifndef DIAMETRO_H
+#define DIAMETRO_H
+
+#include "GrafoDisperso.h"
+#include "RecorridoBFS.h"
+#include <vector>
+
+/**
+ * @struct ProgresoDiametro
+ * @brief Estado intermedio reportado después de cada BFS
+ */
+struct ProgresoDiametro {
+    int bfsRealizados = 0;  ///< BFS ejecutados hasta el momento
+    int cotaInferior = 0;   ///< Mejor cota inferior del diámetro
+    int cotaSuperior = 0;   ///< Mejor cota superior del diámetro
+    int pendientes = 0;     ///< Nodos con excentricidad aún no resuelta
+};
+
+/**
+ * @brief Callback de progreso; devolver false cancela el cálculo
+ */
+using CallbackProgreso = bool (*)(void* contexto, const ProgresoDiametro& progreso);
+
+/**
+ * @struct ResultadoDiametro
+ * @brief Resultado del cálculo de diámetro
+ */
+struct ResultadoDiametro {
+    int diametro = 0;       ///< Diámetro (o mejor cota inferior si no es exacto)
+    int cotaInferior = 0;   ///< Cota inferior final
+    int cotaSuperior = 0;   ///< Cota superior final
+    int bfsRealizados = 0;  ///< BFS ejecutados
+    int nodosComponente = 0;///< Tamaño de la componente analizada
+    bool exacto = false;    ///< false si se canceló antes de cerrar las cotas
+};
+
+/**
+ * @class AnalizadorDiametro
+ * @brief Cálculos basados en distancias sobre la vista no dirigida
+ */
+class AnalizadorDiametro {
+public:
+    /**
+     * @brief Construye la vista no dirigida del grafo
+     */
+    explicit AnalizadorDiametro(const GrafoDisperso& grafo);
+
+    /**
+     * @brief Diámetro exacto de la mayor componente conexa mediante iFUB
+     * @param callback Función de progreso (opcional)
+     * @param contexto Puntero opaco entregado al callback
+     * @return Diámetro y cotas; exacto = false si el callback canceló
+     *
+     * El nodo central se elige con la heurística 4-Sweep, que además
+     * aporta la cota inferior inicial.
+     */
+    ResultadoDiametro calcularDiametro(CallbackProgreso callback = nullptr, void* contexto = nullptr);
+
+    /**
+     * @brief Cotas de excentricidad de todos los nodos (Takes-Kosters)
+     * @param inferior Salida: cota inferior por nodo
+     * @param superior Salida: cota superior por nodo
+     * @param maxBFS Límite de BFS (0 = hasta resolver todos los nodos)
+     * @param callback Función de progreso (opcional)
+     * @param contexto Puntero opaco entregado al callback
+     * @return BFS realizados
+     *
+     * La excentricidad se mide dentro de la componente de cada nodo.
+     * Al terminar sin límite ni cancelación, inferior == superior.
+     */
+    int calcularExcentricidades(std::vector<int>& inferior, std::vector<int>& superior,
+                                int maxBFS = 0, CallbackProgreso callback = nullptr,
+                                void* contexto = nullptr);
+
+private:
+    VectorIndice<int> rowPtr;    ///< Punteros de fila de la vista simétrica
+    VectorIndice<int> columnas;  ///< Vecinos de la vista simétrica
+    VistaCSR csr;               ///< Vista sobre los dos vectores anteriores
+    EspacioBFS espacio;         ///< Espacio reutilizado por todos los BFS
+
+    int bfs(int origen);
+    int nodoMasLejano() const;
+    int nodoIntermedio(int destino, int pasos) const;
+    std::vector<int> mayorComponente();
+};
+
+#endif // DIAMETRO_H
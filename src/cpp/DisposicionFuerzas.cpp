@@ -0,0 +1,443 @@
+/**
+ * @file DisposicionFuerzas.cpp
+ * @brief Implementación de la disposición Fruchterman-Reingold con Barnes-Hut
+ * @author NeuroNet Team
+ */
+
+#include "DisposicionFuerzas.h"
+#include "Aleatorio.h"
+#include "Paralelo.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+namespace {
+
+// Celdas más profundas agrupan puntos (casi) coincidentes en una hoja
+const int PROFUNDIDAD_MAXIMA_QUADTREE = 48;
+// El engrosamiento se detiene al llegar a este tamaño
+const int NODOS_NIVEL_MINIMO = 32;
+// Los niveles refinados parten de una posición buena: menos temperatura
+// y la mitad de iteraciones
+const double FACTOR_REFINAMIENTO = 0.5;
+
+/**
+ * @brief Celda del quadtree: un cuadrado con la masa y el centro de masa
+ *        de los cuerpos que contiene
+ *
+ * Durante la construcción (centroX, centroY) acumulan la suma de las
+ * posiciones; al terminar se dividen por la masa.
+ */
+struct Celda {
+    double x0, y0, lado;
+    double centroX = 0.0, centroY = 0.0;
+    int masa = 0;
+    int cuerpo = -1;     ///< Único cuerpo de una hoja (-1 si vacía o agregada)
+    int hijos = -1;      ///< Índice del primero de los cuatro hijos (-1 = hoja)
+};
+
+class Quadtree {
+public:
+    /**
+     * @brief Reconstruye el árbol insertando los cuerpos en el orden dado
+     *
+     * Insertar en el orden espacial de la iteración anterior deja las
+     * celdas vecinas contiguas en memoria, lo que abarata mucho los
+     * recorridos de repulsión.
+     */
+    void construir(const std::vector<double>& posiciones, const std::vector<int>& orden) {
+        const int n = static_cast<int>(orden.size());
+        double minX = posiciones[0], maxX = posiciones[0];
+        double minY = posiciones[1], maxY = posiciones[1];
+        for (int i = 1; i < n; i++) {
+            minX = std::min(minX, posiciones[2 * i]);
+            maxX = std::max(maxX, posiciones[2 * i]);
+            minY = std::min(minY, posiciones[2 * i + 1]);
+            maxY = std::max(maxY, posiciones[2 * i + 1]);
+        }
+        double lado = std::max(maxX - minX, maxY - minY) * 1.0001 + 1e-9;
+
+        celdas.clear();
+        celdas.push_back(Celda{minX, minY, lado});
+        for (int i : orden) {
+            insertar(i, posiciones[2 * i], posiciones[2 * i + 1]);
+        }
+        for (Celda& celda : celdas) {
+            if (celda.masa > 1) {
+                celda.centroX /= celda.masa;
+                celda.centroY /= celda.masa;
+            }
+        }
+    }
+
+    /**
+     * @brief Cuerpos en el orden de las hojas del árbol
+     *
+     * Recorrer los cuerpos en este orden hace que cuerpos consecutivos
+     * visiten casi las mismas celdas, que así siguen en caché.
+     */
+    void ordenEspacial(std::vector<int>& orden) const {
+        orden.clear();
+        std::vector<int> pila(1, 0);
+        while (!pila.empty()) {
+            const Celda& celda = celdas[pila.back()];
+            pila.pop_back();
+            if (celda.hijos >= 0) {
+                for (int h = 3; h >= 0; h--) {
+                    pila.push_back(celda.hijos + h);
+                }
+            } else if (celda.masa > 0) {
+                // Una hoja agregada no guarda sus cuerpos; se completan al final
+                if (celda.cuerpo >= 0) {
+                    orden.push_back(celda.cuerpo);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Fuerza de repulsión k²/d (con k = 1) que recibe el cuerpo i
+     */
+    void repulsion(int i, double x, double y, double theta2, double& fx, double& fy) const {
+        // Cada celda abierta cambia una entrada por cuatro: la pila está acotada
+        int pila[3 * PROFUNDIDAD_MAXIMA_QUADTREE + 4];
+        int tope = 0;
+        pila[tope++] = 0;
+        while (tope > 0) {
+            const Celda& celda = celdas[pila[--tope]];
+            if (celda.masa == 0 || celda.cuerpo == i) {
+                continue;
+            }
+            double dx = x - celda.centroX;
+            double dy = y - celda.centroY;
+            double d2 = dx * dx + dy * dy;
+            bool contiene = x >= celda.x0 && x < celda.x0 + celda.lado &&
+                            y >= celda.y0 && y < celda.y0 + celda.lado;
+            if (celda.hijos >= 0 && (contiene || celda.lado * celda.lado >= theta2 * d2)) {
+                for (int h = 0; h < 4; h++) {
+                    pila[tope++] = celda.hijos + h;
+                }
+                continue;
+            }
+            if (d2 < 1e-18) {
+                continue;   // Puntos coincidentes: los separa la atracción o el azar inicial
+            }
+            // Dirección dx/d y magnitud masa/d: masa * dx / d²
+            double factor = celda.masa / d2;
+            fx += dx * factor;
+            fy += dy * factor;
+        }
+    }
+
+private:
+    std::vector<Celda> celdas;
+
+    static int cuadrante(const Celda& celda, double x, double y) {
+        double mitad = celda.lado * 0.5;
+        return (x >= celda.x0 + mitad ? 1 : 0) + (y >= celda.y0 + mitad ? 2 : 0);
+    }
+
+    void insertar(int i, double x, double y) {
+        int c = 0;
+        for (int profundidad = 0;; profundidad++) {
+            if (celdas[c].hijos < 0) {
+                if (celdas[c].masa == 0) {
+                    Celda& hoja = celdas[c];
+                    hoja.cuerpo = i;
+                    hoja.masa = 1;
+                    hoja.centroX = x;
+                    hoja.centroY = y;
+                    return;
+                }
+                if (profundidad >= PROFUNDIDAD_MAXIMA_QUADTREE) {
+                    Celda& hoja = celdas[c];
+                    hoja.cuerpo = -1;
+                    hoja.masa++;
+                    hoja.centroX += x;
+                    hoja.centroY += y;
+                    return;
+                }
+                // Dividir la hoja y bajar su cuerpo a un hijo
+                int primero = static_cast<int>(celdas.size());
+                Celda padre = celdas[c];
+                double mitad = padre.lado * 0.5;
+                for (int h = 0; h < 4; h++) {
+                    celdas.push_back(Celda{padre.x0 + (h & 1) * mitad,
+                                           padre.y0 + (h >> 1) * mitad, mitad});
+                }
+                Celda& destino = celdas[primero + cuadrante(padre, padre.centroX, padre.centroY)];
+                destino.cuerpo = padre.cuerpo;
+                destino.masa = 1;
+                destino.centroX = padre.centroX;
+                destino.centroY = padre.centroY;
+                celdas[c].cuerpo = -1;
+                celdas[c].hijos = primero;
+            }
+            Celda& interna = celdas[c];
+            interna.masa++;
+            interna.centroX += x;
+            interna.centroY += y;
+            c = interna.hijos + cuadrante(interna, x, y);
+        }
+    }
+};
+
+/**
+ * @brief Adyacencia simétrica sin lazos ni duplicados
+ * @param enumerar Llama a f(u, v) por cada arista; se invoca dos veces
+ *        (conteo y llenado), así que debe ser determinista
+ */
+template <typename Enumerar>
+void construirSimetrica(int n, Enumerar enumerar, std::vector<int>& rowPtr,
+                        std::vector<int>& vecinos) {
+    rowPtr.assign(n + 1, 0);
+    enumerar([&](int u, int v) {
+        if (u != v) {
+            rowPtr[u + 1]++;
+            rowPtr[v + 1]++;
+        }
+    });
+    for (int u = 0; u < n; u++) {
+        rowPtr[u + 1] += rowPtr[u];
+    }
+    vecinos.resize(rowPtr[n]);
+    std::vector<int> cursor(rowPtr.begin(), rowPtr.end() - 1);
+    enumerar([&](int u, int v) {
+        if (u != v) {
+            vecinos[cursor[u]++] = v;
+            vecinos[cursor[v]++] = u;
+        }
+    });
+
+    // Ordenar y quitar duplicados (u->v junto a v->u, o multiaristas)
+    std::vector<int> unicos(n, 0);
+    paraleloPara(n, 1024, [&](int64_t desde, int64_t hasta, int) {
+        for (int64_t u = desde; u < hasta; u++) {
+            auto inicio = vecinos.begin() + rowPtr[u];
+            auto fin = vecinos.begin() + rowPtr[u + 1];
+            std::sort(inicio, fin);
+            unicos[u] = static_cast<int>(std::unique(inicio, fin) - inicio);
+        }
+    }, "DisposicionFuerzas::adyacencia");
+    int escritos = 0;
+    for (int u = 0; u < n; u++) {
+        int inicio = rowPtr[u];
+        std::copy(vecinos.begin() + inicio, vecinos.begin() + inicio + unicos[u],
+                  vecinos.begin() + escritos);
+        rowPtr[u] = escritos;
+        escritos += unicos[u];
+    }
+    rowPtr[n] = escritos;
+    vecinos.resize(escritos);
+    vecinos.shrink_to_fit();
+}
+
+} // namespace
+
+DisposicionFuerzas::DisposicionFuerzas(const GrafoDisperso& grafo) {
+    VistaCSR csr = grafo.vistaCSR();
+    niveles.emplace_back();
+    NivelDisposicion& base = niveles.back();
+    base.numNodos = csr.numNodos;
+    construirSimetrica(csr.numNodos, [&](auto&& f) {
+        for (int u = 0; u < csr.numNodos; u++) {
+            for (int e = csr.rowPtr[u]; e < csr.rowPtr[u + 1]; e++) {
+                f(u, csr.columnas[e]);
+            }
+        }
+    }, base.rowPtr, base.vecinos);
+
+    // Jerarquía de engrosamiento: cada nivel empareja nodos adyacentes del
+    // anterior (los de menor grado primero, con el vecino libre más ligero)
+    std::vector<int> masa(csr.numNodos, 1);
+    while (niveles.back().numNodos > NODOS_NIVEL_MINIMO) {
+        const NivelDisposicion& fino = niveles.back();
+        const int n = fino.numNodos;
+
+        std::vector<int> porGrado(n);
+        for (int v = 0; v < n; v++) {
+            porGrado[v] = v;
+        }
+        std::stable_sort(porGrado.begin(), porGrado.end(), [&](int a, int b) {
+            return fino.rowPtr[a + 1] - fino.rowPtr[a] < fino.rowPtr[b + 1] - fino.rowPtr[b];
+        });
+
+        std::vector<int> padre(n, -1);
+        std::vector<int> masaGruesa;
+        int gruesos = 0;
+        for (int u : porGrado) {
+            if (padre[u] >= 0) {
+                continue;
+            }
+            int pareja = -1;
+            for (int e = fino.rowPtr[u]; e < fino.rowPtr[u + 1]; e++) {
+                int v = fino.vecinos[e];
+                if (padre[v] < 0 && (pareja < 0 || masa[v] < masa[pareja])) {
+                    pareja = v;
+                }
+            }
+            padre[u] = gruesos;
+            masaGruesa.push_back(masa[u]);
+            if (pareja >= 0) {
+                padre[pareja] = gruesos;
+                masaGruesa.back() += masa[pareja];
+            }
+            gruesos++;
+        }
+
+        // Un emparejamiento que apenas reduce (estrellas, nodos aislados) no compensa
+        if (gruesos > n * 4 / 5) {
+            break;
+        }
+
+        NivelDisposicion grueso;
+        grueso.numNodos = gruesos;
+        construirSimetrica(gruesos, [&](auto&& f) {
+            for (int u = 0; u < n; u++) {
+                for (int e = fino.rowPtr[u]; e < fino.rowPtr[u + 1]; e++) {
+                    f(padre[u], padre[fino.vecinos[e]]);
+                }
+            }
+        }, grueso.rowPtr, grueso.vecinos);
+        padres.push_back(std::move(padre));
+        niveles.push_back(std::move(grueso));
+        masa.swap(masaGruesa);
+    }
+}
+
+void DisposicionFuerzas::simular(const NivelDisposicion& nivel, int iteraciones,
+                                 double temperaturaInicial, const ParametrosDisposicion& parametros,
+                                 std::vector<double>& posiciones) const {
+    const int n = nivel.numNodos;
+    const double theta2 = parametros.theta * parametros.theta;
+    std::vector<double> desplazamiento(2 * static_cast<size_t>(n));
+    std::vector<int> orden(n);
+    std::vector<char> ordenado(n);
+    for (int i = 0; i < n; i++) {
+        orden[i] = i;
+    }
+    Quadtree arbol;
+
+    for (int it = 0; it < iteraciones; it++) {
+        arbol.construir(posiciones, orden);
+        arbol.ordenEspacial(orden);
+        if (static_cast<int>(orden.size()) < n) {
+            std::fill(ordenado.begin(), ordenado.end(), 0);
+            for (int i : orden) {
+                ordenado[i] = 1;
+            }
+            for (int i = 0; i < n; i++) {
+                if (!ordenado[i]) {
+                    orden.push_back(i);
+                }
+            }
+        }
+
+        double mediaX = 0.0, mediaY = 0.0;
+        for (int i = 0; i < n; i++) {
+            mediaX += posiciones[2 * i];
+            mediaY += posiciones[2 * i + 1];
+        }
+        mediaX /= n;
+        mediaY /= n;
+
+        // Enfriamiento lineal: pasos largos al principio, ajuste fino al final
+        const double temperatura =
+            temperaturaInicial * (1.0 - static_cast<double>(it) / iteraciones);
+
+        paraleloPara(n, 256, [&](int64_t desde, int64_t hasta, int) {
+            for (int64_t k = desde; k < hasta; k++) {
+                int i = orden[k];
+                double x = posiciones[2 * i];
+                double y = posiciones[2 * i + 1];
+                double fx = 0.0, fy = 0.0;
+                arbol.repulsion(i, x, y, theta2, fx, fy);
+
+                // Atracción d²/k hacia cada vecino: vector d * (dx, dy)
+                for (int e = nivel.rowPtr[i]; e < nivel.rowPtr[i + 1]; e++) {
+                    int j = nivel.vecinos[e];
+                    double dx = x - posiciones[2 * j];
+                    double dy = y - posiciones[2 * j + 1];
+                    double d = std::sqrt(dx * dx + dy * dy);
+                    fx -= dx * d;
+                    fy -= dy * d;
+                }
+
+                fx -= parametros.gravedad * (x - mediaX);
+                fy -= parametros.gravedad * (y - mediaY);
+
+                double norma = std::sqrt(fx * fx + fy * fy);
+                double paso = norma > 0.0 ? std::min(norma, temperatura) / norma : 0.0;
+                desplazamiento[2 * i] = fx * paso;
+                desplazamiento[2 * i + 1] = fy * paso;
+            }
+        }, "DisposicionFuerzas::simular");
+
+        for (size_t p = 0; p < desplazamiento.size(); p++) {
+            posiciones[p] += desplazamiento[p];
+        }
+    }
+}
+
+bool DisposicionFuerzas::calcular(const ParametrosDisposicion& parametros,
+                                  std::vector<double>& posiciones) const {
+    const int numNodos = niveles[0].numNodos;
+    const size_t esperado = 2 * static_cast<size_t>(numNodos);
+    if (parametros.iteraciones < 0 || parametros.theta < 0.0 || parametros.gravedad < 0.0 ||
+        (!posiciones.empty() && posiciones.size() != esperado)) {
+        std::cerr << "[C++ Core] Error: Parametros de disposicion invalidos." << std::endl;
+        return false;
+    }
+    if (numNodos == 0) {
+        posiciones.clear();
+        return true;
+    }
+
+    std::cout << "[C++ Core] Calculando disposicion de " << numNodos << " nodos ("
+              << niveles.size() << " niveles, " << parametros.iteraciones
+              << " iteraciones)..." << std::endl;
+    auto inicio = std::chrono::high_resolution_clock::now();
+
+    auto temperatura = [](int n) {
+        return std::max(1.0, std::sqrt(static_cast<double>(n)) / 10.0);
+    };
+
+    if (!posiciones.empty()) {
+        // Continuar un dibujo previo: solo un ajuste suave sobre el nivel original
+        simular(niveles[0], parametros.iteraciones, temperatura(numNodos) * FACTOR_REFINAMIENTO,
+                parametros, posiciones);
+    } else {
+        GeneradorAleatorio rng(parametros.semilla);
+        const int ultimo = static_cast<int>(niveles.size()) - 1;
+        std::vector<double> actual(2 * static_cast<size_t>(niveles[ultimo].numNodos));
+        const double extensionGruesa = std::sqrt(static_cast<double>(niveles[ultimo].numNodos));
+        for (double& p : actual) {
+            p = (rng.uniforme() - 0.5) * extensionGruesa;
+        }
+        simular(niveles[ultimo], parametros.iteraciones, temperatura(niveles[ultimo].numNodos),
+                parametros, actual);
+
+        // Proyectar cada nivel sobre el siguiente más fino y refinar
+        for (int l = ultimo - 1; l >= 0; l--) {
+            const int n = niveles[l].numNodos;
+            const double escala = std::sqrt(static_cast<double>(n) / niveles[l + 1].numNodos);
+            std::vector<double> fino(2 * static_cast<size_t>(n));
+            for (int v = 0; v < n; v++) {
+                int p = padres[l][v];
+                fino[2 * v] = actual[2 * p] * escala + (rng.uniforme() - 0.5) * 0.1;
+                fino[2 * v + 1] = actual[2 * p + 1] * escala + (rng.uniforme() - 0.5) * 0.1;
+            }
+            actual.swap(fino);
+            simular(niveles[l], std::max(1, parametros.iteraciones / 2),
+                    temperatura(n) * FACTOR_REFINAMIENTO, parametros, actual);
+        }
+        posiciones.swap(actual);
+    }
+
+    auto fin = std::chrono::high_resolution_clock::now();
+    auto duracion = std::chrono::duration_cast<std::chrono::microseconds>(fin - inicio);
+    std::cout << "[C++ Core] Disposicion completada. Tiempo: " << duracion.count() / 1000.0
+              << " ms." << std::endl;
+    return true;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file DisposicionFuerzas.h
+ * @brief Disposición dirigida por fuerzas (Fruchterman-Reingold con Barnes-Hut)
+ * @author NeuroNet Team
+ *
+ * Calcula coordenadas 2D para dibujar un grafo (típicamente un subgrafo
+ * extraído del núcleo). La repulsión entre todos los pares se aproxima
+ * con un quadtree de Barnes-Hut, O(n log n) por iteración en lugar de
+ * O(n²); la atracción recorre las aristas tratadas como no dirigidas.
+ * Para no quedar atrapada en dobleces (típicos al partir de posiciones
+ * al azar), la simulación es multinivel: se engrosa el grafo por
+ * emparejamiento de vecinos, se dispone el nivel más pequeño y cada
+ * nivel se proyecta sobre el siguiente y se refina.
+ * Los desplazamientos de cada iteración se calculan en paralelo sobre
+ * las posiciones de la iteración anterior, así que el resultado no
+ * depende del número de hilos.
+ */
+
+#ifndef DISPOSICION_FUERZAS_H
+#define DISPOSICION_FUERZAS_H
+
+#include "GrafoDisperso.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct ParametrosDisposicion
+ * @brief Configuración de una disposición
+ */
+struct ParametrosDisposicion {
+    int iteraciones = 50;       ///< Pasos del nivel más grueso (los refinados usan la mitad)
+    double theta = 1.2;         ///< Criterio de apertura de Barnes-Hut (0 = exacto)
+    double gravedad = 0.05;     ///< Atracción lineal hacia el centro (une componentes)
+    uint64_t semilla = 42;      ///< Semilla de las posiciones iniciales aleatorias
+};
+
+/**
+ * @class DisposicionFuerzas
+ * @brief Motor de disposición sobre una VistaCSR
+ *
+ * La distancia ideal entre nodos adyacentes es 1; el dibujo ocupa un
+ * área del orden de sqrt(n) x sqrt(n). Los pesos de las aristas se
+ * ignoran.
+ */
+class DisposicionFuerzas {
+public:
+    /**
+     * @brief Prepara la adyacencia no dirigida (sin lazos ni duplicados)
+     *        y la jerarquía de engrosamiento
+     */
+    explicit DisposicionFuerzas(const GrafoDisperso& grafo);
+
+    /**
+     * @brief Ejecuta la simulación
+     * @param parametros Iteraciones, theta, gravedad y semilla
+     * @param posiciones Entrada/salida: 2 * numNodos valores (x0, y0, x1, y1, ...).
+     *        Si llega con ese tamaño se usa como posición inicial (para
+     *        refinar un dibujo previo); si llega vacío se inicializa al azar.
+     * @return false si los parámetros o las posiciones iniciales son inválidos
+     */
+    bool calcular(const ParametrosDisposicion& parametros, std::vector<double>& posiciones) const;
+
+private:
+    /**
+     * @brief Adyacencia simétrica (CSR) de un nivel de la jerarquía
+     */
+    struct NivelDisposicion {
+        int numNodos = 0;
+        std::vector<int> rowPtr;
+        std::vector<int> vecinos;
+    };
+
+    std::vector<NivelDisposicion> niveles;   ///< niveles[0] es el grafo original
+    std::vector<std::vector<int>> padres;    ///< padres[l][v]: nodo de niveles[l + 1] que contiene a v
+
+    void simular(const NivelDisposicion& nivel, int iteraciones, double temperaturaInicial,
+                 const ParametrosDisposicion& parametros, std::vector<double>& posiciones) const;
+};
+
+#endif // DISPOSICION_FUERZAS_H
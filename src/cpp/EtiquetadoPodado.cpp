@@ -0,0 +1,504 @@
+/**
+ * @file EtiquetadoPodado.cpp
+ * @brief Implementación del índice PLL con raíces bit-paralelas
+ * @author NeuroNet Team
+ */
+
+#include "EtiquetadoPodado.h"
+#include "Paralelo.h"
+#include <atomic>
+#include <cstring>
+
+namespace {
+
+const uint8_t INF8 = 255;
+const int INF_CONSULTA = 1 << 30;
+const char MAGIA_PLL[4] = {'N', 'N', 'P', 'L'};
+const uint32_t VERSION_PLL = 1;
+
+template <typename T, typename A>
+void escribirVector(std::ofstream& archivo, const std::vector<T, A>& datos) {
+    uint64_t cantidad = datos.size();
+    archivo.write(reinterpret_cast<const char*>(&cantidad), sizeof(cantidad));
+    archivo.write(reinterpret_cast<const char*>(datos.data()), datos.size() * sizeof(T));
+}
+
+/**
+ * Lee un vector escrito por escribirVector. Un tamaño mayor que lo que
+ * queda del archivo (`bytesArchivo`) se rechaza antes de reservar
+ */
+template <typename T, typename A>
+bool leerVector(std::ifstream& archivo, std::vector<T, A>& datos, uint64_t bytesArchivo) {
+    uint64_t cantidad = 0;
+    archivo.read(reinterpret_cast<char*>(&cantidad), sizeof(cantidad));
+    if (!archivo) {
+        return false;
+    }
+    uint64_t posicion = static_cast<uint64_t>(archivo.tellg());
+    if (posicion > bytesArchivo || cantidad > (bytesArchivo - posicion) / sizeof(T)) {
+        return false;
+    }
+    datos.resize(cantidad);
+    archivo.read(reinterpret_cast<char*>(datos.data()), cantidad * sizeof(T));
+    return static_cast<bool>(archivo);
+}
+
+/**
+ * Comprueba los invariantes de los que dependen las consultas, para no
+ * adoptar un índice corrupto que lea fuera de los arreglos
+ */
+template <typename R, typename D, typename C, typename O, typename H, typename E>
+bool indiceConsistente(int n, int raicesBP, const R& rango, const D& bpDistancia,
+                       const C& bpConjuntos, const O& offsets, const H& hubs, const E& distancias) {
+    if (n < 0 || raicesBP < 0) {
+        return false;
+    }
+    const size_t nodos = static_cast<size_t>(n);
+    if (rango.size() != nodos || bpDistancia.size() != nodos * raicesBP ||
+        bpConjuntos.size() != nodos * raicesBP * 2 || offsets.size() != nodos + 1) {
+        return false;
+    }
+    for (int r : rango) {
+        if (r < 0 || r >= n) {
+            return false;
+        }
+    }
+    if (offsets[0] != 0 || static_cast<uint64_t>(offsets[n]) != hubs.size() ||
+        hubs.size() != distancias.size()) {
+        return false;
+    }
+    // Cada etiqueta acaba en el centinela n, que es lo que detiene la
+    // intersección de consultarRangos
+    for (int r = 0; r < n; r++) {
+        if (offsets[r + 1] <= offsets[r] || hubs[offsets[r + 1] - 1] != n) {
+            return false;
+        }
+    }
+    for (int h : hubs) {
+        if (h < 0 || h > n) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+IndicePLL::IndicePLL()
+    : numNodos(0), numAristasGrafo(0), numRaicesBP(0), segundosConstruccion(0.0) {
+}
+
+void IndicePLL::limpiar() {
+    numNodos = 0;
+    numAristasGrafo = 0;
+    numRaicesBP = 0;
+    segundosConstruccion = 0.0;
+    VectorIndice<int>().swap(rango);
+    VectorIndice<uint8_t>().swap(bpDistancia);
+    VectorIndice<uint64_t>().swap(bpConjuntos);
+    VectorIndice<int64_t>().swap(offsets);
+    VectorIndice<int>().swap(hubs);
+    VectorIndice<uint8_t>().swap(distancias);
+}
+
+bool IndicePLL::construir(const GrafoDisperso& grafo, int raicesBP) {
+    limpiar();
+
+    VectorIndice<int> rowPtrND, columnasND;
+    VistaCSR nd = grafo.vistaNoDirigida(rowPtrND, columnasND);
+    const int n = nd.numNodos;
+    if (n == 0) {
+        std::cerr << "[C++ Core] Error: No se puede indexar un grafo vacio." << std::endl;
+        return false;
+    }
+
+    std::cout << "[C++ Core] Construyendo indice PLL (" << raicesBP
+              << " raices bit-paralelas) sobre la vista no dirigida..." << std::endl;
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Orden por grado decreciente; el índice trabaja con rangos
+    std::vector<int> orden(n);
+    for (int v = 0; v < n; v++) {
+        orden[v] = v;
+    }
+    std::sort(orden.begin(), orden.end(), [&](int a, int b) {
+        return nd.grado(a) != nd.grado(b) ? nd.grado(a) > nd.grado(b) : a < b;
+    });
+    rango.assign(n, 0);
+    for (int r = 0; r < n; r++) {
+        rango[orden[r]] = r;
+    }
+
+    std::vector<int> adjPtr(n + 1, 0);
+    for (int r = 0; r < n; r++) {
+        adjPtr[r + 1] = adjPtr[r] + nd.grado(orden[r]);
+    }
+    std::vector<int> adj(adjPtr[n]);
+    paraleloPara(n, 4096, [&](int64_t desde, int64_t hasta, int) {
+        for (int64_t r = desde; r < hasta; r++) {
+            int v = orden[r];
+            int pos = adjPtr[r];
+            for (int i = nd.rowPtr[v]; i < nd.rowPtr[v + 1]; i++) {
+                adj[pos++] = rango[nd.columnas[i]];
+            }
+            std::sort(adj.begin() + adjPtr[r], adj.begin() + adjPtr[r + 1]);
+        }
+    }, "IndicePLL::construir");
+    VectorIndice<int>().swap(rowPtrND);
+    VectorIndice<int>().swap(columnasND);
+
+    // --- Raíces bit-paralelas: selección secuencial, BFS en paralelo ---
+    std::vector<bool> usado(n, false);
+    std::vector<int> raices;
+    std::vector<std::vector<int>> vecinosRaiz;
+    for (int r = 0; static_cast<int>(raices.size()) < raicesBP; r++) {
+        while (r < n && usado[r]) r++;
+        if (r >= n) break;
+        usado[r] = true;
+        std::vector<int> seleccion;
+        for (int i = adjPtr[r]; i < adjPtr[r + 1] && seleccion.size() < 64; i++) {
+            if (!usado[adj[i]]) {
+                usado[adj[i]] = true;
+                seleccion.push_back(adj[i]);
+            }
+        }
+        raices.push_back(r);
+        vecinosRaiz.push_back(std::move(seleccion));
+    }
+    numRaicesBP = static_cast<int>(raices.size());
+    bpDistancia.assign(static_cast<size_t>(n) * numRaicesBP, INF8);
+    bpConjuntos.assign(static_cast<size_t>(n) * numRaicesBP * 2, 0);
+
+    std::atomic<bool> demasiadoLargo(false);
+    paraleloPara(numRaicesBP, 1, [&](int64_t desde, int64_t hasta, int) {
+        std::vector<uint8_t> d(n);
+        std::vector<std::pair<uint64_t, uint64_t>> s(n);
+        std::vector<int> cola(n);
+        std::vector<std::pair<int, int>> hermanos, hijos;
+
+        for (int64_t b = desde; b < hasta; b++) {
+            std::fill(d.begin(), d.end(), INF8);
+            std::fill(s.begin(), s.end(), std::make_pair(0ULL, 0ULL));
+
+            int cabeza = 0;
+            cola[cabeza++] = raices[b];
+            d[raices[b]] = 0;
+            int finNivel = cabeza;
+            for (size_t i = 0; i < vecinosRaiz[b].size(); i++) {
+                int v = vecinosRaiz[b][i];
+                cola[cabeza++] = v;
+                d[v] = 1;
+                s[v].first = 1ULL << i;
+            }
+
+            int inicioNivel = 0;
+            for (int nivel = 0; inicioNivel < cabeza; nivel++) {
+                if (nivel + 1 >= INF8) {
+                    demasiadoLargo = true;
+                    break;
+                }
+                hermanos.clear();
+                hijos.clear();
+                for (int q = inicioNivel; q < finNivel; q++) {
+                    int v = cola[q];
+                    for (int i = adjPtr[v]; i < adjPtr[v + 1]; i++) {
+                        int w = adj[i];
+                        if (nivel > d[w]) {
+                            continue;
+                        }
+                        if (nivel == d[w]) {
+                            if (v < w) hermanos.emplace_back(v, w);
+                        } else {
+                            if (d[w] == INF8) {
+                                cola[cabeza++] = w;
+                                d[w] = static_cast<uint8_t>(nivel + 1);
+                            }
+                            hijos.emplace_back(v, w);
+                        }
+                    }
+                }
+                for (const auto& h : hermanos) {
+                    s[h.first].second |= s[h.second].first;
+                    s[h.second].second |= s[h.first].first;
+                }
+                for (const auto& h : hijos) {
+                    s[h.second].first |= s[h.first].first;
+                    s[h.second].second |= s[h.first].second;
+                }
+                inicioNivel = finNivel;
+                finNivel = cabeza;
+            }
+
+            for (int v = 0; v < n; v++) {
+                size_t pos = static_cast<size_t>(v) * numRaicesBP + b;
+                bpDistancia[pos] = d[v];
+                bpConjuntos[2 * pos] = s[v].first;
+                bpConjuntos[2 * pos + 1] = s[v].second;
+            }
+        }
+    }, "IndicePLL::construir");
+
+    // --- BFS podados en orden de rango ---
+    std::vector<std::vector<int>> hubsTmp(n);
+    std::vector<std::vector<uint8_t>> distTmp(n);
+    std::vector<uint8_t> distRaiz(n, INF8);
+    std::vector<bool> visitado(n, false);
+    std::vector<int> cola;
+    cola.reserve(n);
+
+    for (int r = 0; r < n && !demasiadoLargo; r++) {
+        if (usado[r]) {
+            continue;
+        }
+        for (size_t i = 0; i < hubsTmp[r].size(); i++) {
+            distRaiz[hubsTmp[r][i]] = distTmp[r][i];
+        }
+        const uint8_t* bpR = bpDistancia.data() + static_cast<size_t>(r) * numRaicesBP;
+        const uint64_t* bsR = bpConjuntos.data() + static_cast<size_t>(r) * numRaicesBP * 2;
+
+        cola.clear();
+        cola.push_back(r);
+        visitado[r] = true;
+        size_t inicioNivel = 0;
+        for (int nivel = 0; inicioNivel < cola.size(); nivel++) {
+            if (nivel >= INF8) {
+                demasiadoLargo = true;
+                break;
+            }
+            size_t finNivel = cola.size();
+            for (size_t q = inicioNivel; q < finNivel; q++) {
+                int v = cola[q];
+
+                // Poda con las raíces bit-paralelas
+                const uint8_t* bpV = bpDistancia.data() + static_cast<size_t>(v) * numRaicesBP;
+                const uint64_t* bsV = bpConjuntos.data() + static_cast<size_t>(v) * numRaicesBP * 2;
+                bool podar = false;
+                for (int i = 0; i < numRaicesBP && !podar; i++) {
+                    if (bpR[i] == INF8 || bpV[i] == INF8) continue;
+                    int td = bpR[i] + bpV[i];
+                    if (td - 2 <= nivel) {
+                        td += (bsR[2 * i] & bsV[2 * i]) ? -2
+                            : ((bsR[2 * i] & bsV[2 * i + 1]) | (bsR[2 * i + 1] & bsV[2 * i])) ? -1 : 0;
+                        podar = td <= nivel;
+                    }
+                }
+                // Poda con las etiquetas ya construidas
+                for (size_t i = 0; i < hubsTmp[v].size() && !podar; i++) {
+                    uint8_t dh = distRaiz[hubsTmp[v][i]];
+                    podar = dh != INF8 && dh + distTmp[v][i] <= nivel;
+                }
+                if (podar) {
+                    continue;
+                }
+
+                hubsTmp[v].push_back(r);
+                distTmp[v].push_back(static_cast<uint8_t>(nivel));
+                for (int i = adjPtr[v]; i < adjPtr[v + 1]; i++) {
+                    int w = adj[i];
+                    if (!visitado[w]) {
+                        visitado[w] = true;
+                        cola.push_back(w);
+                    }
+                }
+            }
+            inicioNivel = finNivel;
+        }
+
+        for (int v : cola) {
+            visitado[v] = false;
+        }
+        for (int h : hubsTmp[r]) {
+            distRaiz[h] = INF8;
+        }
+    }
+
+    if (demasiadoLargo) {
+        std::cerr << "[C++ Core] Error: Distancias mayores a " << (INF8 - 1)
+                  << " no caben en el indice PLL." << std::endl;
+        limpiar();
+        return false;
+    }
+
+    // --- Aplanar las etiquetas en el arena ---
+    offsets.assign(n + 1, 0);
+    for (int r = 0; r < n; r++) {
+        offsets[r + 1] = offsets[r] + static_cast<int64_t>(hubsTmp[r].size()) + 1;
+    }
+    hubs.resize(offsets[n]);
+    distancias.resize(offsets[n]);
+    paraleloPara(n, 4096, [&](int64_t desde, int64_t hasta, int) {
+        for (int64_t r = desde; r < hasta; r++) {
+            int64_t pos = offsets[r];
+            std::copy(hubsTmp[r].begin(), hubsTmp[r].end(), hubs.begin() + pos);
+            std::copy(distTmp[r].begin(), distTmp[r].end(), distancias.begin() + pos);
+            pos += hubsTmp[r].size();
+            hubs[pos] = n;  // Centinela
+            distancias[pos] = 0;
+            std::vector<int>().swap(hubsTmp[r]);
+            std::vector<uint8_t>().swap(distTmp[r]);
+        }
+    }, "IndicePLL::construir");
+
+    numNodos = n;
+    numAristasGrafo = grafo.vistaCSR().numAristas;
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    segundosConstruccion = std::chrono::duration<double>(endTime - startTime).count();
+
+    EstadisticasPLL estadisticas = getEstadisticas();
+    std::cout << "[C++ Core] Indice PLL construido. Etiqueta promedio: " << estadisticas.promedioEtiqueta
+              << " entradas, memoria: " << estadisticas.bytesIndice / (1024.0 * 1024.0)
+              << " MB. Tiempo: " << segundosConstruccion << " s." << std::endl;
+    return true;
+}
+
+int IndicePLL::consultarRangos(int ru, int rv) const {
+    if (ru == rv) {
+        return 0;
+    }
+
+    int mejor = INF_CONSULTA;
+    const uint8_t* bpU = bpDistancia.data() + static_cast<size_t>(ru) * numRaicesBP;
+    const uint8_t* bpV = bpDistancia.data() + static_cast<size_t>(rv) * numRaicesBP;
+    const uint64_t* bsU = bpConjuntos.data() + static_cast<size_t>(ru) * numRaicesBP * 2;
+    const uint64_t* bsV = bpConjuntos.data() + static_cast<size_t>(rv) * numRaicesBP * 2;
+    for (int i = 0; i < numRaicesBP; i++) {
+        if (bpU[i] == INF8 || bpV[i] == INF8) continue;
+        int td = bpU[i] + bpV[i];
+        if (td - 2 <= mejor) {
+            td += (bsU[2 * i] & bsV[2 * i]) ? -2
+                : ((bsU[2 * i] & bsV[2 * i + 1]) | (bsU[2 * i + 1] & bsV[2 * i])) ? -1 : 0;
+            mejor = std::min(mejor, td);
+        }
+    }
+
+    // Intersección de las dos etiquetas ordenadas por hub
+    int64_t i = offsets[ru];
+    int64_t j = offsets[rv];
+    while (true) {
+        int hu = hubs[i];
+        int hv = hubs[j];
+        if (hu == hv) {
+            if (hu == numNodos) break;
+            mejor = std::min(mejor, distancias[i] + distancias[j]);
+            i++;
+            j++;
+        } else if (hu < hv) {
+            i++;
+        } else {
+            j++;
+        }
+    }
+
+    return mejor == INF_CONSULTA ? -1 : mejor;
+}
+
+int IndicePLL::consultar(int u, int v) const {
+    if (numNodos == 0 || u < 0 || v < 0 || u >= numNodos || v >= numNodos) {
+        return -1;
+    }
+    return consultarRangos(rango[u], rango[v]);
+}
+
+void IndicePLL::consultarLote(const int* u, const int* v, int64_t cantidad, int* salida) const {
+    paraleloPara(cantidad, 4096, [&](int64_t desde, int64_t hasta, int) {
+        for (int64_t i = desde; i < hasta; i++) {
+            salida[i] = consultar(u[i], v[i]);
+        }
+    }, "IndicePLL::consultarLote");
+}
+
+EstadisticasPLL IndicePLL::getEstadisticas() const {
+    EstadisticasPLL estadisticas;
+    estadisticas.numNodos = numNodos;
+    estadisticas.numRaicesBP = numRaicesBP;
+    estadisticas.entradasEtiqueta = numNodos > 0 ? offsets[numNodos] - numNodos : 0;
+    estadisticas.promedioEtiqueta = numNodos > 0
+        ? static_cast<double>(estadisticas.entradasEtiqueta) / numNodos : 0.0;
+    estadisticas.bytesIndice = rango.capacity() * sizeof(int) +
+                               bpDistancia.capacity() +
+                               bpConjuntos.capacity() * sizeof(uint64_t) +
+                               offsets.capacity() * sizeof(int64_t) +
+                               hubs.capacity() * sizeof(int) +
+                               distancias.capacity();
+    estadisticas.segundosConstruccion = segundosConstruccion;
+    return estadisticas;
+}
+
+bool IndicePLL::guardar(const std::string& ruta) const {
+    if (numNodos == 0) {
+        std::cerr << "[C++ Core] Error: No hay indice PLL construido para guardar." << std::endl;
+        return false;
+    }
+
+    std::ofstream archivo(ruta, std::ios::binary);
+    if (!archivo.is_open()) {
+        std::cerr << "[C++ Core] Error: No se pudo crear el archivo " << ruta << std::endl;
+        return false;
+    }
+
+    int32_t cabecera[3] = {numNodos, numAristasGrafo, numRaicesBP};
+    archivo.write(MAGIA_PLL, sizeof(MAGIA_PLL));
+    archivo.write(reinterpret_cast<const char*>(&VERSION_PLL), sizeof(VERSION_PLL));
+    archivo.write(reinterpret_cast<const char*>(cabecera), sizeof(cabecera));
+    archivo.write(reinterpret_cast<const char*>(&segundosConstruccion), sizeof(segundosConstruccion));
+    escribirVector(archivo, rango);
+    escribirVector(archivo, bpDistancia);
+    escribirVector(archivo, bpConjuntos);
+    escribirVector(archivo, offsets);
+    escribirVector(archivo, hubs);
+    escribirVector(archivo, distancias);
+
+    std::cout << "[C++ Core] Indice PLL guardado en '" << ruta << "'." << std::endl;
+    return static_cast<bool>(archivo);
+}
+
+bool IndicePLL::cargar(const std::string& ruta, const GrafoDisperso& grafo) {
+    std::ifstream archivo(ruta, std::ios::binary | std::ios::ate);
+    if (!archivo.is_open()) {
+        std::cerr << "[C++ Core] Error: No se pudo abrir el archivo " << ruta << std::endl;
+        return false;
+    }
+    const uint64_t bytesArchivo = static_cast<uint64_t>(archivo.tellg());
+    archivo.seekg(0);
+
+    char magia[4];
+    uint32_t version = 0;
+    int32_t cabecera[3];
+    archivo.read(magia, sizeof(magia));
+    archivo.read(reinterpret_cast<char*>(&version), sizeof(version));
+    archivo.read(reinterpret_cast<char*>(cabecera), sizeof(cabecera));
+    if (!archivo || std::memcmp(magia, MAGIA_PLL, sizeof(magia)) != 0 || version != VERSION_PLL) {
+        std::cerr << "[C++ Core] Error: '" << ruta << "' no es un indice PLL valido." << std::endl;
+        return false;
+    }
+
+    VistaCSR csr = grafo.vistaCSR();
+    if (cabecera[0] != csr.numNodos || cabecera[1] != csr.numAristas) {
+        std::cerr << "[C++ Core] Error: El indice PLL no corresponde al grafo cargado." << std::endl;
+        return false;
+    }
+
+    limpiar();
+    archivo.read(reinterpret_cast<char*>(&segundosConstruccion), sizeof(segundosConstruccion));
+    bool ok = leerVector(archivo, rango, bytesArchivo) && leerVector(archivo, bpDistancia, bytesArchivo) &&
+              leerVector(archivo, bpConjuntos, bytesArchivo) && leerVector(archivo, offsets, bytesArchivo) &&
+              leerVector(archivo, hubs, bytesArchivo) && leerVector(archivo, distancias, bytesArchivo);
+    if (!ok) {
+        std::cerr << "[C++ Core] Error: Archivo de indice PLL truncado." << std::endl;
+        limpiar();
+        return false;
+    }
+    if (!indiceConsistente(cabecera[0], cabecera[2], rango, bpDistancia, bpConjuntos,
+                           offsets, hubs, distancias)) {
+        std::cerr << "[C++ Core] Error: Archivo de indice PLL inconsistente con su cabecera." << std::endl;
+        limpiar();
+        return false;
+    }
+
+    numNodos = cabecera[0];
+    numAristasGrafo = cabecera[1];
+    numRaicesBP = cabecera[2];
+    std::cout << "[C++ Core] Indice PLL cargado desde '" << ruta << "'." << std::endl;
+    return true;
+}
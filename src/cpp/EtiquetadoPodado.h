@@ -0,0 +1,108 @@
+/**
+ * @file EtiquetadoPodado.h
+ * @brief Índice de distancias exactas por etiquetado 2-hop podado (PLL)
+ * @author NeuroNet Team
+ *
+ * Implementa el Pruned Landmark Labeling de Akiba, Iwata y Yoshida con
+ * raíces bit-paralelas. Cada nodo guarda una etiqueta con pares
+ * (hub, distancia) y d(u, v) es el mínimo de d(u, h) + d(h, v) sobre los
+ * hubs comunes; las raíces bit-paralelas cubren, con 64 vecinos cada
+ * una, los nodos de mayor grado y reducen drásticamente las etiquetas.
+ *
+ * El índice se define sobre la vista no dirigida del grafo. Las
+ * etiquetas viven en un arena plano (offsets + hubs + distancias) para
+ * que las consultas sean un recorrido secuencial de dos rangos.
+ */
+
+#ifndef ETIQUETADO_PODADO_H
+#define ETIQUETADO_PODADO_H
+
+#include "GrafoDisperso.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct EstadisticasPLL
+ * @brief Tamaño del índice y costo de construcción
+ */
+struct EstadisticasPLL {
+    int numNodos = 0;
+    int numRaicesBP = 0;
+    int64_t entradasEtiqueta = 0;   ///< Total de pares (hub, distancia)
+    double promedioEtiqueta = 0.0;  ///< Entradas normales por nodo
+    size_t bytesIndice = 0;         ///< Memoria ocupada por el índice
+    double segundosConstruccion = 0.0;
+};
+
+/**
+ * @class IndicePLL
+ * @brief Etiquetado podado con raíces bit-paralelas
+ */
+class IndicePLL {
+public:
+    IndicePLL();
+
+    /**
+     * @brief Construye el índice
+     * @param grafo Grafo a indexar (se usa su vista no dirigida)
+     * @param numRaicesBP Raíces bit-paralelas (0 desactiva la variante)
+     * @return true si la construcción fue exitosa
+     */
+    bool construir(const GrafoDisperso& grafo, int numRaicesBP = 16);
+
+    /**
+     * @brief Distancia exacta no dirigida entre u y v
+     * @return Distancia, o -1 si no están conectados o los IDs son inválidos
+     */
+    int consultar(int u, int v) const;
+
+    /**
+     * @brief Resuelve un lote de consultas (usado también para medir)
+     * @param u Orígenes
+     * @param v Destinos
+     * @param cantidad Número de pares
+     * @param salida Distancias (-1 si no hay camino)
+     */
+    void consultarLote(const int* u, const int* v, int64_t cantidad, int* salida) const;
+
+    /**
+     * @brief Guarda el índice en un archivo binario
+     */
+    bool guardar(const std::string& ruta) const;
+
+    /**
+     * @brief Carga un índice guardado, validando que corresponda al grafo
+     */
+    bool cargar(const std::string& ruta, const GrafoDisperso& grafo);
+
+    /**
+     * @brief Descarta el índice
+     */
+    void limpiar();
+
+    bool estaConstruido() const { return numNodos > 0; }
+    EstadisticasPLL getEstadisticas() const;
+
+private:
+    int numNodos;
+    int numAristasGrafo;            ///< Aristas del grafo original (validación)
+    int numRaicesBP;
+    double segundosConstruccion;
+
+    VectorIndice<int> rango;        ///< Nodo original -> posición en el orden por grado
+
+    // Etiquetas bit-paralelas, por rango: [r * numRaicesBP + i]
+    VectorIndice<uint8_t> bpDistancia;
+    VectorIndice<uint64_t> bpConjuntos; ///< Dos máscaras por raíz: S^-1 y S^0
+
+    // Arena de etiquetas normales, por rango; cada etiqueta termina en
+    // el centinela hub = numNodos
+    VectorIndice<int64_t> offsets;
+    VectorIndice<int> hubs;
+    VectorIndice<uint8_t> distancias;
+
+    int consultarRangos(int ru, int rv) const;
+};
+
+#endif // ETIQUETADO_PODADO_H
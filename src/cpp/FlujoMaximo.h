@@ -0,0 +1,76 @@
+/**
+ * @file FlujoMaximo.h
+ * @brief Flujo máximo y corte mínimo entre conjuntos de nodos (Dinic)
+ * @author NeuroNet Team
+ *
+ * La red residual se deriva de la estructura CSR: cada nodo guarda sus
+ * arcos de salida seguidos de los arcos inversos de sus aristas de
+ * entrada, y cada arco conoce la posición de su gemelo. Los arcos de
+ * salida de v son las aristas originales; su capacidad original es la
+ * suma de las capacidades residuales del arco y de su gemelo. Con
+ * capacidades unitarias (el caso por defecto) Dinic termina en
+ * O(m·sqrt(m)).
+ *
+ * Las fuentes y sumideros múltiples se manejan sin supernodos: el BFS
+ * de niveles parte de todas las fuentes a la vez y cualquier sumidero
+ * termina un camino de aumento.
+ */
+
+#ifndef FLUJO_MAXIMO_H
+#define FLUJO_MAXIMO_H
+
+#include "GrafoDisperso.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct ResultadoFlujo
+ * @brief Valor del flujo máximo y aristas del corte mínimo
+ */
+struct ResultadoFlujo {
+    int64_t valor = 0;           ///< Flujo máximo = capacidad del corte mínimo
+    std::vector<int> corte;      ///< Pares (origen, destino) concatenados
+    int fases = 0;               ///< Fases de Dinic (BFS de niveles) ejecutadas
+    int nodosLadoFuente = 0;     ///< Nodos alcanzables desde las fuentes en el residual
+};
+
+/**
+ * @class FlujoMaximo
+ * @brief Dinic sobre una red residual construida desde un GrafoDisperso
+ */
+class FlujoMaximo {
+public:
+    explicit FlujoMaximo(const GrafoDisperso& grafo);
+
+    /**
+     * @brief Calcula el flujo máximo de las fuentes a los sumideros
+     * @param fuentes Nodos fuente
+     * @param sumideros Nodos sumidero (disjuntos de las fuentes)
+     * @param usarPesos Usar `values` como capacidades (si no, capacidad 1)
+     * @param resultado Salida
+     * @return false si los conjuntos son inválidos
+     */
+    bool calcular(const std::vector<int>& fuentes, const std::vector<int>& sumideros,
+                  bool usarPesos, ResultadoFlujo& resultado);
+
+private:
+    VistaCSR csr;
+
+    // Red residual: arcos de cada nodo en [inicio[v], inicio[v+1])
+    std::vector<int64_t> inicio;
+    std::vector<int> cabeza;         ///< Nodo destino del arco
+    std::vector<int> capacidad;      ///< Capacidad residual
+    std::vector<uint32_t> gemelo;    ///< Posición del arco inverso
+
+    std::vector<int> nivel;
+    std::vector<int64_t> actual;     ///< Arco actual de cada nodo en la fase
+    std::vector<char> esSumidero;
+    std::vector<int> cola;
+    std::vector<int64_t> pila;
+
+    void asignarCapacidades(bool usarPesos);
+    bool calcularNiveles(const std::vector<int>& fuentes);
+    int64_t flujoBloqueante(int fuente);
+};
+
+#endif // FLUJO_MAXIMO_H
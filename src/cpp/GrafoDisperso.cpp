@@ -5,89 +5,373 @@
  */
 
 #include "GrafoDisperso.h"
+#include "ArenaMemoria.h"
+#include "LecturaAristas.h"
+#include "MemoriaCompartida.h"
+#include "Metricas.h"
+#include "Paralelo.h"
+#include "RecorridoBFS.h"
+#include "Trabajos.h"
+#include <atomic>
+#include <climits>
+#include <cstring>
+#include <memory>
+#include <new>
+
+namespace {
+
+// Iteraciones entre consultas al token de cancelación en los bucles calientes
+const int INTERVALO_CONTROL = 4096;
+
+// Frontera mínima para expandir un nivel del BFS en paralelo
+const int64_t UMBRAL_BFS_PARALELO = 8192;
+
+/**
+ * Cabecera de un CSR publicado en memoria compartida o en una instantánea.
+ * Los arreglos siguen a la cabecera, cada uno alineado a 64 bytes.
+ */
+struct CabeceraCSR {
+    char magia[8];
+    uint32_t version;
+    uint32_t bytesCabecera;
+    int64_t numNodos;
+    int64_t numAristas;
+    int64_t numIds;
+    int64_t offsetRowPtr;
+    int64_t offsetColumnas;
+    int64_t offsetValores;
+    int64_t offsetGradoEntrada;
+    int64_t offsetIds;
+    int64_t bytesTotales;
+};
+
+const char MAGIA_CSR[8] = {'N', 'N', 'C', 'S', 'R', '0', '1', '\0'};
+const uint32_t VERSION_CSR = 1;
+
+int64_t alinear64(int64_t bytes) {
+    return (bytes + 63) & ~int64_t(63);
+}
+
+/**
+ * Calcula los offsets de cada arreglo y el tamaño total del segmento
+ */
+void distribuirCabecera(CabeceraCSR& cabecera) {
+    int64_t pos = alinear64(sizeof(CabeceraCSR));
+    cabecera.offsetRowPtr = pos;
+    pos = alinear64(pos + (cabecera.numNodos + 1) * int64_t(sizeof(int)));
+    cabecera.offsetColumnas = pos;
+    pos = alinear64(pos + cabecera.numAristas * int64_t(sizeof(int)));
+    cabecera.offsetValores = pos;
+    pos = alinear64(pos + cabecera.numAristas * int64_t(sizeof(int)));
+    cabecera.offsetGradoEntrada = pos;
+    pos = alinear64(pos + cabecera.numNodos * int64_t(sizeof(int)));
+    cabecera.offsetIds = pos;
+    pos = alinear64(pos + cabecera.numIds * int64_t(sizeof(int)));
+    cabecera.bytesTotales = pos;
+}
+
+/**
+ * Comprueba que los arreglos formen un CSR bien formado: row_ptr empieza
+ * en 0, termina en m y no decrece, y todos los destinos están en [0, n).
+ * Las consultas no validan índices, así que cualquier arreglo que no se
+ * haya construido aquí debe pasar por esta comprobación.
+ */
+bool esCSRValido(const int* rowPtr, const int* columnas, int n, int m, const char* region) {
+    if (rowPtr[0] != 0 || rowPtr[n] != m) {
+        return false;
+    }
+    auto combinar = [](int a, int b) { return a | b; };
+    // Primero la monotonía: así ninguna fila puede salirse de columnas
+    int invalidas = paraleloReducir<int>(n, 1 << 16, 0, [&](int64_t desde, int64_t hasta) {
+        int malas = 0;
+        for (int64_t u = desde; u < hasta; u++) {
+            malas |= rowPtr[u] > rowPtr[u + 1];
+        }
+        return malas;
+    }, combinar, region);
+    if (invalidas != 0) {
+        return false;
+    }
+    // Destinos en rango y filas ordenadas: los análisis buscan e intersecan vecinos
+    invalidas = paraleloReducir<int>(n, 1 << 12, 0, [&](int64_t desde, int64_t hasta) {
+        int malas = 0;
+        for (int64_t u = desde; u < hasta; u++) {
+            int anterior = 0;
+            for (int k = rowPtr[u]; k < rowPtr[u + 1]; k++) {
+                malas |= columnas[k] < anterior || columnas[k] >= n;
+                anterior = columnas[k];
+            }
+        }
+        return malas;
+    }, combinar, region);
+    return invalidas == 0;
+}
+
+/**
+ * Comprueba que un grado de entrada que no se calculó aquí coincida con
+ * las columnas (ya validadas por esCSRValido). vistaTranspuesta reparte
+ * las aristas según estos grados, así que uno falso escribiría fuera.
+ */
+bool esGradoEntradaValido(const int* columnas, const int* gradoEntrada, int n, int m,
+                          const char* region) {
+    VectorTemporal<std::atomic<int>> cuentas(n);
+    paraleloPara(m, 1 << 16, [&](int64_t desde, int64_t hasta, int) {
+        for (int64_t k = desde; k < hasta; k++) {
+            cuentas[columnas[k]].fetch_add(1, std::memory_order_relaxed);
+        }
+    }, region);
+    int distintos = paraleloReducir<int>(n, 1 << 16, 0, [&](int64_t desde, int64_t hasta) {
+        int malos = 0;
+        for (int64_t v = desde; v < hasta; v++) {
+            malos |= cuentas[v].load(std::memory_order_relaxed) != gradoEntrada[v];
+        }
+        return malos;
+    }, [](int a, int b) { return a | b; }, region);
+    return distintos == 0;
+}
+
+/**
+ * Construye los arreglos CSR de m aristas dadas por los accesores
+ * origen(k) y destino(k), con IDs ya validados en [0, n). Cada tramo de
+ * nodos pertenece a un solo hilo, que recorre todas las aristas y solo
+ * cuenta y coloca las suyas: no hacen falta atómicos (que serializan los
+ * fallos de caché del reparto) y cada fila conserva el orden de entrada.
+ * Después cada fila se ordena por destino, y por peso, para que las
+ * aristas repetidas queden en un orden determinista.
+ */
+template <typename Origen, typename Destino>
+void construirFilas(int64_t m, int n, Origen origen, Destino destino, const int* pesos,
+                    VectorGrafo<int>& rowPtr, VectorGrafo<int>& columnas,
+                    VectorGrafo<int>& valores, VectorCache<int>& gradoEntrada,
+                    const char* region) {
+    int tramos = std::max(1, std::min(numHilosDisponibles(), n));
+    auto primerNodo = [&](int64_t tramo) { return static_cast<int>(int64_t(n) * tramo / tramos); };
+    
+    // Contar grados de salida y de entrada
+    rowPtr.assign(n + 1, 0);
+    gradoEntrada.assign(n, 0);
+    paraleloPara(tramos, 1, [&](int64_t desde, int64_t hasta, int) {
+        for (int64_t t = desde; t < hasta; t++) {
+            unsigned int inicio = primerNodo(t);
+            unsigned int ancho = primerNodo(t + 1) - inicio;
+            for (int64_t k = 0; k < m; k++) {
+                // Una resta sin signo comprueba las dos cotas del tramo
+                unsigned int o = static_cast<unsigned int>(origen(k)) - inicio;
+                unsigned int d = static_cast<unsigned int>(destino(k)) - inicio;
+                if (o < ancho) {
+                    rowPtr[inicio + o + 1]++;
+                }
+                if (d < ancho) {
+                    gradoEntrada[inicio + d]++;
+                }
+            }
+        }
+    }, region);
+    for (int u = 0; u < n; u++) {
+        rowPtr[u + 1] += rowPtr[u];
+    }
+    
+    // Repartir las aristas en sus filas
+    columnas.resize(m);
+    valores.resize(m);
+    AmbitoArena ambito;
+    int* cursor = ambito.arreglo<int>(n);
+    std::copy(rowPtr.begin(), rowPtr.end() - 1, cursor);
+    paraleloPara(tramos, 1, [&](int64_t desde, int64_t hasta, int) {
+        for (int64_t t = desde; t < hasta; t++) {
+            unsigned int inicio = primerNodo(t);
+            unsigned int ancho = primerNodo(t + 1) - inicio;
+            for (int64_t k = 0; k < m; k++) {
+                unsigned int o = static_cast<unsigned int>(origen(k)) - inicio;
+                if (o < ancho) {
+                    int pos = cursor[inicio + o]++;
+                    columnas[pos] = destino(k);
+                    valores[pos] = pesos != nullptr ? pesos[k] : 1;
+                }
+            }
+        }
+    }, region);
+    
+    // Ordenar cada fila (con pesos, como pares destino-peso)
+    std::vector<std::vector<std::pair<int, int>>> temporales(numHilosDisponibles());
+    paraleloPara(n, 4096, [&](int64_t desde, int64_t hasta, int hilo) {
+        std::vector<std::pair<int, int>>& pares = temporales[hilo];
+        for (int64_t u = desde; u < hasta; u++) {
+            int inicio = rowPtr[u];
+            int fin = rowPtr[u + 1];
+            if (pesos == nullptr) {
+                std::sort(columnas.begin() + inicio, columnas.begin() + fin);
+                continue;
+            }
+            pares.clear();
+            for (int k = inicio; k < fin; k++) {
+                pares.emplace_back(columnas[k], valores[k]);
+            }
+            std::sort(pares.begin(), pares.end());
+            for (int k = inicio; k < fin; k++) {
+                columnas[k] = pares[k - inicio].first;
+                valores[k] = pares[k - inicio].second;
+            }
+        }
+    }, region, static_cast<int>(temporales.size()));
+}
+
+} // namespace
 
 GrafoDisperso::GrafoDisperso() : numNodos(0), numAristas(0) {
     std::cout << "[C++ Core] Inicializando GrafoDisperso..." << std::endl;
 }
 
 GrafoDisperso::~GrafoDisperso() {
-    // Los vectores se limpian automáticamente
+    // Los vectores y el segmento (si lo hay) se liberan automáticamente
+}
+
+void GrafoDisperso::enlazarAlmacen() {
+    segmento.reset();
+    row_ptr = almacen.rowPtr.data();
+    column_indices = almacen.columnas.data();
+    values = almacen.valores.data();
+    gradoEntrada = almacen.gradoEntrada.data();
+    idsOriginales = almacen.idsOriginales.data();
+    numIdsOriginales = static_cast<int>(almacen.idsOriginales.size());
 }
 
-void GrafoDisperso::construirCSR(std::vector<std::pair<int, int>>& aristas, int maxNodo) {
+void GrafoDisperso::construirCSR(ListaAristas& aristas, int maxNodo) {
     numNodos = maxNodo + 1;
     numAristas = aristas.size();
     
-    // Inicializar vectores
-    row_ptr.resize(numNodos + 1, 0);
-    gradoEntrada.resize(numNodos, 0);
+    // Reconstruir los vectores (el grafo puede haber contenido otros datos)
+    almacen.idsOriginales.clear();
+    construirFilas(numAristas, numNodos,
+                   [&](int64_t k) { return aristas[k].first; },
+                   [&](int64_t k) { return aristas[k].second; },
+                   nullptr, almacen.rowPtr, almacen.columnas, almacen.valores,
+                   almacen.gradoEntrada, "GrafoDisperso::construirCSR");
     
-    // Contar el número de aristas salientes por nodo
-    for (const auto& arista : aristas) {
-        row_ptr[arista.first + 1]++;
-        gradoEntrada[arista.second]++;
-    }
+    enlazarAlmacen();
+}
+
+template <typename T>
+bool GrafoDisperso::construirDesdeArreglos(const T* origenes, const T* destinos, const int* pesos,
+                                           int64_t cantidad) {
+    auto startTime = std::chrono::high_resolution_clock::now();
     
-    // Calcular prefijos acumulados para row_ptr
-    for (int i = 1; i <= numNodos; i++) {
-        row_ptr[i] += row_ptr[i - 1];
+    // Máximo ID, o -2 si algún ID está fuera de [0, INT_MAX)
+    const int64_t INVALIDO = -2;
+    int64_t maxNodo = -1;
+    if (cantidad < 0 || cantidad > INT_MAX) {
+        maxNodo = INVALIDO;
+    } else {
+        maxNodo = paraleloReducir<int64_t>(cantidad, 1 << 16, int64_t(-1),
+            [&](int64_t desde, int64_t hasta) {
+                int64_t maximo = -1;
+                for (int64_t k = desde; k < hasta; k++) {
+                    int64_t o = origenes[k];
+                    int64_t d = destinos[k];
+                    if (o < 0 || d < 0 || o >= INT_MAX || d >= INT_MAX) {
+                        return INVALIDO;
+                    }
+                    maximo = std::max(maximo, std::max(o, d));
+                }
+                return maximo;
+            },
+            [&](int64_t a, int64_t b) { return a == INVALIDO || b == INVALIDO ? INVALIDO : std::max(a, b); },
+            "GrafoDisperso::construirDesdeAristas");
     }
+    if (maxNodo == INVALIDO) {
+        std::cerr << "[C++ Core] Error: Las aristas contienen IDs de nodo fuera de rango." << std::endl;
+        return false;
+    }
+    
+    numNodos = static_cast<int>(maxNodo + 1);
+    numAristas = static_cast<int>(cantidad);
+    almacen.idsOriginales.clear();
+    construirFilas(cantidad, numNodos,
+                   [&](int64_t k) { return static_cast<int>(origenes[k]); },
+                   [&](int64_t k) { return static_cast<int>(destinos[k]); },
+                   pesos, almacen.rowPtr, almacen.columnas, almacen.valores,
+                   almacen.gradoEntrada, "GrafoDisperso::construirDesdeAristas");
+    enlazarAlmacen();
+    
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
     
-    // Llenar column_indices y values
-    column_indices.resize(numAristas);
-    values.resize(numAristas, 1); // Todas las aristas tienen peso 1
+    std::cout << "[C++ Core] Grafo construido desde arreglos. Nodos: " << numNodos
+              << " | Aristas: " << numAristas << ". Tiempo ejecucion: " << duration.count()
+              << " ms." << std::endl;
     
-    // Vector temporal para llevar el conteo de inserción por fila
-    std::vector<int> currentPos(row_ptr.begin(), row_ptr.end() - 1);
+    return true;
+}
+
+bool GrafoDisperso::construirDesdeAristas(const int32_t* origenes, const int32_t* destinos,
+                                          const int* pesos, int64_t cantidad) {
+    return construirDesdeArreglos(origenes, destinos, pesos, cantidad);
+}
+
+bool GrafoDisperso::construirDesdeAristas(const int64_t* origenes, const int64_t* destinos,
+                                          const int* pesos, int64_t cantidad) {
+    return construirDesdeArreglos(origenes, destinos, pesos, cantidad);
+}
+
+bool GrafoDisperso::adoptarCSR(const int* rowPtr, const int* columnas, const int* pesos,
+                               int nodos, int aristas) {
+    if (nodos < 0 || aristas < 0 ||
+        !esCSRValido(rowPtr, columnas, nodos, aristas, "GrafoDisperso::adoptarCSR")) {
+        std::cerr << "[C++ Core] Error: Los arreglos no forman un grafo CSR valido "
+                  << "(filas ordenadas y destinos en rango)." << std::endl;
+        return false;
+    }
     
-    for (const auto& arista : aristas) {
-        int origen = arista.first;
-        int destino = arista.second;
-        int pos = currentPos[origen]++;
-        column_indices[pos] = destino;
+    almacen = AlmacenCSR();
+    almacen.gradoEntrada.assign(nodos, 0);
+    for (int k = 0; k < aristas; k++) {
+        almacen.gradoEntrada[columnas[k]]++;
     }
+    if (pesos == nullptr) {
+        almacen.valores.assign(aristas, 1);
+    }
+    enlazarAlmacen();
     
-    // Ordenar los índices de columna dentro de cada fila para acceso eficiente
-    for (int i = 0; i < numNodos; i++) {
-        std::sort(column_indices.begin() + row_ptr[i], 
-                  column_indices.begin() + row_ptr[i + 1]);
+    // Las filas y columnas se leen directamente de los arreglos del llamador
+    numNodos = nodos;
+    numAristas = aristas;
+    row_ptr = rowPtr;
+    column_indices = columnas;
+    if (pesos != nullptr) {
+        values = pesos;
     }
+    
+    std::cout << "[C++ Core] Estructura CSR adoptada sin copia. Nodos: " << numNodos
+              << " | Aristas: " << numAristas << std::endl;
+    return true;
 }
 
 bool GrafoDisperso::cargarDatos(const std::string& filename) {
+    return cargarDatos(filename, nullptr);
+}
+
+bool GrafoDisperso::cargarDatos(const std::string& filename, ControlTrabajo* control) {
     std::cout << "[C++ Core] Cargando dataset '" << filename << "'..." << std::endl;
     
     auto startTime = std::chrono::high_resolution_clock::now();
     
-    std::ifstream file(filename);
-    if (!file.is_open()) {
+    ListaAristas aristas;
+    int maxNodo = 0;
+    ResultadoLectura lectura = leerListaAristas(filename, aristas, maxNodo, control);
+    if (lectura == ResultadoLectura::NoEncontrado) {
         std::cerr << "[C++ Core] Error: No se pudo abrir el archivo " << filename << std::endl;
         return false;
     }
-    
-    std::vector<std::pair<int, int>> aristas;
-    std::string linea;
-    int maxNodo = 0;
-    int lineaNum = 0;
-    
-    while (std::getline(file, linea)) {
-        lineaNum++;
-        
-        // Ignorar líneas vacías o comentarios (comienzan con #)
-        if (linea.empty() || linea[0] == '#') {
-            continue;
-        }
-        
-        std::istringstream iss(linea);
-        int origen, destino;
-        
-        if (iss >> origen >> destino) {
-            aristas.emplace_back(origen, destino);
-            maxNodo = std::max(maxNodo, std::max(origen, destino));
-        }
+    if (lectura == ResultadoLectura::Cancelada) {
+        std::cout << "[C++ Core] Carga cancelada tras " << aristas.size()
+                  << " aristas leidas." << std::endl;
+        return false;
     }
     
-    file.close();
+    if (control != nullptr && control->estaCancelado()) {
+        std::cout << "[C++ Core] Carga cancelada antes de construir el CSR." << std::endl;
+        return false;
+    }
     
     // Construir estructura CSR
     construirCSR(aristas, maxNodo);
@@ -105,6 +389,11 @@ bool GrafoDisperso::cargarDatos(const std::string& filename) {
 }
 
 std::vector<std::pair<int, int>> GrafoDisperso::BFS(int nodoInicio, int profundidadMaxima) {
+    return BFS(nodoInicio, profundidadMaxima, nullptr);
+}
+
+std::vector<std::pair<int, int>> GrafoDisperso::BFS(int nodoInicio, int profundidadMaxima,
+                                                    ControlTrabajo* control) {
     std::cout << "[C++ Core] Ejecutando BFS desde nodo " << nodoInicio 
               << " con profundidad maxima " << profundidadMaxima << "..." << std::endl;
     
@@ -117,33 +406,137 @@ std::vector<std::pair<int, int>> GrafoDisperso::BFS(int nodoInicio, int profundi
         return resultado;
     }
     
-    std::vector<bool> visitado(numNodos, false);
-    std::queue<std::pair<int, int>> cola; // (nodo, nivel)
+    // Recorrido por niveles: el nivel k ocupa un tramo contiguo de
+    // `resultado` y es la frontera que se expande para obtener el k+1.
+    // marca[v]: NO_VISITADO, VISITADO o, al expandir un nivel en paralelo,
+    // la menor posición de la frontera que descubrió a v
+    const int NO_VISITADO = INT_MAX;
+    const int VISITADO = -1;
+    AmbitoArena ambito;
+    std::atomic<int>* marca = ambito.arreglo<std::atomic<int>>(numNodos);
+    {
+        CronometroMetrica cronometro(ContadorMetrica::NanosPreparacion);
+        paraleloPara(numNodos, 1 << 16, [&](int64_t desde, int64_t hasta, int) {
+            for (int64_t v = desde; v < hasta; v++) {
+                new (&marca[v]) std::atomic<int>(NO_VISITADO);
+            }
+        }, "GrafoDisperso::BFS");
+    }
     
-    cola.push({nodoInicio, 0});
-    visitado[nodoInicio] = true;
+    resultado.emplace_back(nodoInicio, 0);
+    marca[nodoInicio].store(VISITADO, std::memory_order_relaxed);
     
-    while (!cola.empty()) {
-        auto [nodoActual, nivel] = cola.front();
-        cola.pop();
+    // Métricas: coste de cada nivel, medido fuera de los bucles de expansión
+    const bool medir = metricasActivas();
+    std::vector<PerfilNivelBFS> perfil;
+    int64_t bytesTrabajo = static_cast<int64_t>(numNodos) * sizeof(std::atomic<int>);
+    
+    size_t inicioNivel = 0;
+    for (int nivel = 0; nivel < profundidadMaxima && inicioNivel < resultado.size(); nivel++) {
+        if (control != nullptr) {
+            if (control->estaCancelado()) {
+                std::cout << "[C++ Core] BFS cancelado en el nivel " << nivel << "." << std::endl;
+                return resultado;
+            }
+            control->reportar(nivel, profundidadMaxima);
+        }
         
-        resultado.emplace_back(nodoActual, nivel);
+        size_t finNivel = resultado.size();
+        int64_t frontera = static_cast<int64_t>(finNivel - inicioNivel);
+        CronometroMetrica cronometroNivel(ContadorMetrica::NanosExpansion);
+        bool paralelo = !(frontera < UMBRAL_BFS_PARALELO || numHilosDisponibles() == 1);
         
-        if (nivel >= profundidadMaxima) {
-            continue;
+        if (!paralelo) {
+            for (size_t f = inicioNivel; f < finNivel; f++) {
+                int nodoActual = resultado[f].first;
+                for (int i = row_ptr[nodoActual]; i < row_ptr[nodoActual + 1]; i++) {
+                    int vecino = column_indices[i];
+                    if (marca[vecino].load(std::memory_order_relaxed) == NO_VISITADO) {
+                        marca[vecino].store(VISITADO, std::memory_order_relaxed);
+                        resultado.emplace_back(vecino, nivel + 1);
+                    }
+                }
+            }
+        } else {
+            // Primera pasada: cada nodo nuevo queda reclamado por la menor
+            // posición de la frontera que lo alcanza (quien lo descubriría
+            // primero en el recorrido secuencial)
+            const int64_t bloque = 1024;
+            paraleloPara(frontera, bloque, [&](int64_t desde, int64_t hasta, int) {
+                for (int64_t f = desde; f < hasta; f++) {
+                    int nodoActual = resultado[inicioNivel + f].first;
+                    int posicion = static_cast<int>(f);
+                    for (int i = row_ptr[nodoActual]; i < row_ptr[nodoActual + 1]; i++) {
+                        std::atomic<int>& m = marca[column_indices[i]];
+                        int actual = m.load(std::memory_order_relaxed);
+                        while (actual > posicion &&
+                               !m.compare_exchange_weak(actual, posicion, std::memory_order_relaxed)) {
+                        }
+                    }
+                }
+            }, "GrafoDisperso::BFS");
+            
+            // Segunda pasada: cada dueño emite sus nodos en el orden de su
+            // fila; al concatenar por bloques se obtiene el orden secuencial
+            std::vector<std::vector<std::pair<int, int>>> porBloque((frontera + bloque - 1) / bloque);
+            paraleloPara(frontera, bloque, [&](int64_t desde, int64_t hasta, int) {
+                std::vector<std::pair<int, int>>& local = porBloque[desde / bloque];
+                for (int64_t f = desde; f < hasta; f++) {
+                    int nodoActual = resultado[inicioNivel + f].first;
+                    int posicion = static_cast<int>(f);
+                    for (int i = row_ptr[nodoActual]; i < row_ptr[nodoActual + 1]; i++) {
+                        int vecino = column_indices[i];
+                        if (marca[vecino].load(std::memory_order_relaxed) == posicion) {
+                            marca[vecino].store(VISITADO, std::memory_order_relaxed);
+                            local.emplace_back(vecino, nivel + 1);
+                        }
+                    }
+                }
+            }, "GrafoDisperso::BFS");
+            
+            for (const auto& local : porBloque) {
+                resultado.insert(resultado.end(), local.begin(), local.end());
+                bytesTrabajo += static_cast<int64_t>(local.capacity() * sizeof(local[0]));
+            }
         }
         
-        // Obtener vecinos usando la estructura CSR
-        int inicio = row_ptr[nodoActual];
-        int fin = row_ptr[nodoActual + 1];
-        
-        for (int i = inicio; i < fin; i++) {
-            int vecino = column_indices[i];
-            if (!visitado[vecino]) {
-                visitado[vecino] = true;
-                cola.push({vecino, nivel + 1});
+        if (medir) {
+            PerfilNivelBFS costo;
+            costo.frontera = frontera;
+            costo.nanosegundos = cronometroNivel.nanosegundos();
+            int64_t gradoMaximo = 0;
+            for (size_t f = inicioNivel; f < finNivel; f++) {
+                int grado = row_ptr[resultado[f].first + 1] - row_ptr[resultado[f].first];
+                costo.aristas += grado;
+                gradoMaximo = std::max<int64_t>(gradoMaximo, grado);
             }
+            maximoMetrica(MaximoMetrica::FronteraMaxima, frontera);
+            maximoMetrica(MaximoMetrica::GradoMaximoExpandido, gradoMaximo);
+            if (paralelo) {
+                sumarMetrica(ContadorMetrica::NivelesParalelos, 1);
+                sumarMetrica(ContadorMetrica::NanosExpansionParalela, costo.nanosegundos);
+            }
+            perfil.push_back(costo);
+        }
+        inicioNivel = finNivel;
+    }
+    
+    if (medir) {
+        int64_t aristas = 0;
+        for (const PerfilNivelBFS& costo : perfil) {
+            aristas += costo.aristas;
         }
+        bytesTrabajo += static_cast<int64_t>(resultado.capacity() * sizeof(resultado[0]));
+        sumarMetrica(ContadorMetrica::LlamadasBFS, 1);
+        sumarMetrica(ContadorMetrica::NivelesBFS, static_cast<int64_t>(perfil.size()));
+        sumarMetrica(ContadorMetrica::NodosVisitados, static_cast<int64_t>(resultado.size()));
+        sumarMetrica(ContadorMetrica::AristasExploradas, aristas);
+        sumarMetrica(ContadorMetrica::BytesReservados, bytesTrabajo);
+        registrarPerfilBFS(perfil);
+    }
+    
+    if (control != nullptr) {
+        control->reportar(profundidadMaxima, profundidadMaxima);
     }
     
     auto endTime = std::chrono::high_resolution_clock::now();
@@ -156,6 +549,10 @@ std::vector<std::pair<int, int>> GrafoDisperso::BFS(int nodoInicio, int profundi
 }
 
 std::vector<int> GrafoDisperso::DFS(int nodoInicio) {
+    return DFS(nodoInicio, nullptr);
+}
+
+std::vector<int> GrafoDisperso::DFS(int nodoInicio, ControlTrabajo* control) {
     std::cout << "[C++ Core] Ejecutando DFS desde nodo " << nodoInicio << "..." << std::endl;
     
     std::vector<int> resultado;
@@ -165,8 +562,14 @@ std::vector<int> GrafoDisperso::DFS(int nodoInicio) {
         return resultado;
     }
     
-    std::vector<bool> visitado(numNodos, false);
+    // Un bit por nodo, de la arena del hilo
+    AmbitoArena ambito;
+    const size_t palabras = (static_cast<size_t>(numNodos) + 63) / 64;
+    uint64_t* visitado = ambito.arreglo<uint64_t>(palabras);
+    std::fill(visitado, visitado + palabras, uint64_t(0));
+    auto yaVisitado = [&](int nodo) { return (visitado[nodo >> 6] >> (nodo & 63)) & 1; };
     std::stack<int> pila;
+    int64_t aristasExploradas = 0;
     
     pila.push(nodoInicio);
     
@@ -174,25 +577,47 @@ std::vector<int> GrafoDisperso::DFS(int nodoInicio) {
         int nodoActual = pila.top();
         pila.pop();
         
-        if (visitado[nodoActual]) {
+        if (yaVisitado(nodoActual)) {
             continue;
         }
         
-        visitado[nodoActual] = true;
+        if (control != nullptr && resultado.size() % INTERVALO_CONTROL == 0) {
+            if (control->estaCancelado()) {
+                std::cout << "[C++ Core] DFS cancelado tras " << resultado.size()
+                          << " nodos." << std::endl;
+                return resultado;
+            }
+            control->reportar(static_cast<int64_t>(resultado.size()), numNodos);
+        }
+        
+        visitado[nodoActual >> 6] |= uint64_t(1) << (nodoActual & 63);
         resultado.push_back(nodoActual);
         
         // Obtener vecinos en orden inverso para mantener orden natural
         int inicio = row_ptr[nodoActual];
         int fin = row_ptr[nodoActual + 1];
+        aristasExploradas += fin - inicio;
         
         for (int i = fin - 1; i >= inicio; i--) {
             int vecino = column_indices[i];
-            if (!visitado[vecino]) {
+            if (!yaVisitado(vecino)) {
                 pila.push(vecino);
             }
         }
     }
     
+    if (control != nullptr) {
+        // El total era una cota (numNodos); al terminar se ajusta a lo alcanzado
+        control->reportar(static_cast<int64_t>(resultado.size()),
+                          static_cast<int64_t>(resultado.size()));
+    }
+    
+    sumarMetrica(ContadorMetrica::LlamadasDFS, 1);
+    sumarMetrica(ContadorMetrica::NodosVisitados, static_cast<int64_t>(resultado.size()));
+    sumarMetrica(ContadorMetrica::AristasExploradas, aristasExploradas);
+    sumarMetrica(ContadorMetrica::BytesReservados,
+                 static_cast<int64_t>(numNodos / 8 + resultado.capacity() * sizeof(int)));
+    
     std::cout << "[C++ Core] DFS completado. Nodos visitados: " << resultado.size() << std::endl;
     
     return resultado;
@@ -239,16 +664,23 @@ int GrafoDisperso::getNumAristas() {
 }
 
 std::pair<int, int> GrafoDisperso::getNodoMayorGrado() {
-    int maxGrado = 0;
-    int nodoMax = -1;
-    
-    for (int i = 0; i < numNodos; i++) {
-        int grado = obtenerGrado(i);
-        if (grado > maxGrado) {
-            maxGrado = grado;
-            nodoMax = i;
+    // (grado, nodo); ante empates gana el nodo de menor ID, como en el recorrido secuencial
+    using Candidato = std::pair<int, int>;
+    auto mayorEnBloque = [&](int64_t desde, int64_t hasta) {
+        Candidato mejor(0, -1);
+        for (int64_t i = desde; i < hasta; i++) {
+            int grado = row_ptr[i + 1] - row_ptr[i];
+            if (grado > mejor.first) {
+                mejor = {grado, static_cast<int>(i)};
+            }
         }
-    }
+        return mejor;
+    };
+    auto combinar = [](const Candidato& a, const Candidato& b) { return b.first > a.first ? b : a; };
+    Candidato mejor = paraleloReducir(numNodos, 1 << 16, Candidato(0, -1), mayorEnBloque, combinar,
+                                      "GrafoDisperso::getNodoMayorGrado");
+    int maxGrado = mejor.first;
+    int nodoMax = mejor.second;
     
     std::cout << "[C++ Core] Nodo con mayor grado de salida: " << nodoMax 
               << " (grado: " << maxGrado << ")" << std::endl;
@@ -259,17 +691,17 @@ std::pair<int, int> GrafoDisperso::getNodoMayorGrado() {
 size_t GrafoDisperso::getMemoriaUsada() {
     size_t memoria = 0;
     
-    // Memoria de row_ptr
-    memoria += row_ptr.capacity() * sizeof(int);
-    
-    // Memoria de column_indices
-    memoria += column_indices.capacity() * sizeof(int);
+    // Arreglos CSR, grado de entrada e IDs originales
+    memoria += almacen.rowPtr.capacity() * sizeof(int);
+    memoria += almacen.columnas.capacity() * sizeof(int);
+    memoria += almacen.valores.capacity() * sizeof(int);
+    memoria += almacen.gradoEntrada.capacity() * sizeof(int);
+    memoria += almacen.idsOriginales.capacity() * sizeof(int);
     
-    // Memoria de values
-    memoria += values.capacity() * sizeof(int);
-    
-    // Memoria de gradoEntrada
-    memoria += gradoEntrada.capacity() * sizeof(int);
+    // Segmento compartido mapeado (las páginas son comunes a todos los procesos)
+    if (segmento) {
+        memoria += segmento->tamano();
+    }
     
     return memoria;
 }
@@ -320,6 +752,424 @@ std::vector<std::pair<int, int>> GrafoDisperso::getAristasSubgrafo(int nodoInici
     return aristas;
 }
 
+VistaCSR GrafoDisperso::vistaCSR() const {
+    VistaCSR vista;
+    vista.rowPtr = row_ptr;
+    vista.columnas = column_indices;
+    vista.valores = values;
+    vista.gradoEntrada = gradoEntrada;
+    vista.numNodos = numNodos;
+    vista.numAristas = numAristas;
+    return vista;
+}
+
+VistaCSR GrafoDisperso::vistaNoDirigida(VectorIndice<int>& rowPtr, VectorIndice<int>& columnas) const {
+    // Contar vecinos en ambas direcciones (los lazos se descartan)
+    std::vector<int> conteo(numNodos + 1, 0);
+    for (int u = 0; u < numNodos; u++) {
+        for (int i = row_ptr[u]; i < row_ptr[u + 1]; i++) {
+            int v = column_indices[i];
+            if (u != v) {
+                conteo[u + 1]++;
+                conteo[v + 1]++;
+            }
+        }
+    }
+    for (int i = 1; i <= numNodos; i++) {
+        conteo[i] += conteo[i - 1];
+    }
+    
+    std::vector<int> simetricas(conteo[numNodos]);
+    std::vector<int> currentPos(conteo.begin(), conteo.end() - 1);
+    for (int u = 0; u < numNodos; u++) {
+        for (int i = row_ptr[u]; i < row_ptr[u + 1]; i++) {
+            int v = column_indices[i];
+            if (u != v) {
+                simetricas[currentPos[u]++] = v;
+                simetricas[currentPos[v]++] = u;
+            }
+        }
+    }
+    
+    // Ordenar cada fila y eliminar duplicados (aristas recíprocas)
+    std::vector<int> tamano(numNodos + 1, 0);
+    paraleloPara(numNodos, 4096, [&](int64_t desde, int64_t hasta, int) {
+        for (int64_t u = desde; u < hasta; u++) {
+            auto inicio = simetricas.begin() + conteo[u];
+            auto fin = simetricas.begin() + conteo[u + 1];
+            std::sort(inicio, fin);
+            tamano[u + 1] = static_cast<int>(std::unique(inicio, fin) - inicio);
+        }
+    }, "GrafoDisperso::vistaNoDirigida");
+    
+    rowPtr.assign(numNodos + 1, 0);
+    for (int u = 0; u < numNodos; u++) {
+        rowPtr[u + 1] = rowPtr[u] + tamano[u + 1];
+    }
+    columnas.resize(rowPtr[numNodos]);
+    paraleloPara(numNodos, 4096, [&](int64_t desde, int64_t hasta, int) {
+        for (int64_t u = desde; u < hasta; u++) {
+            std::copy(simetricas.begin() + conteo[u],
+                      simetricas.begin() + conteo[u] + tamano[u + 1],
+                      columnas.begin() + rowPtr[u]);
+        }
+    }, "GrafoDisperso::vistaNoDirigida");
+    
+    VistaCSR vista;
+    vista.rowPtr = rowPtr.data();
+    vista.columnas = columnas.data();
+    vista.numNodos = numNodos;
+    vista.numAristas = rowPtr[numNodos];
+    return vista;
+}
+
+VistaCSR GrafoDisperso::vistaTranspuesta(VectorIndice<int>& rowPtr, VectorIndice<int>& columnas) const {
+    // El grado de entrada ya está calculado: basta con acumularlo
+    rowPtr.assign(numNodos + 1, 0);
+    for (int v = 0; v < numNodos; v++) {
+        rowPtr[v + 1] = rowPtr[v] + gradoEntrada[v];
+    }
+    
+    // Recorrer los orígenes en orden deja cada fila ya ordenada
+    columnas.resize(numAristas);
+    std::vector<int> currentPos(rowPtr.begin(), rowPtr.end() - 1);
+    for (int u = 0; u < numNodos; u++) {
+        for (int i = row_ptr[u]; i < row_ptr[u + 1]; i++) {
+            columnas[currentPos[column_indices[i]]++] = u;
+        }
+    }
+    
+    VistaCSR vista;
+    vista.rowPtr = rowPtr.data();
+    vista.columnas = columnas.data();
+    vista.numNodos = numNodos;
+    vista.numAristas = numAristas;
+    return vista;
+}
+
+void GrafoDisperso::asignarCSR(VectorGrafo<int>&& rowPtr, VectorGrafo<int>&& columnas,
+                               VectorGrafo<int>&& pesos) {
+    numNodos = static_cast<int>(rowPtr.size()) - 1;
+    numAristas = static_cast<int>(columnas.size());
+    almacen.rowPtr = std::move(rowPtr);
+    almacen.columnas = std::move(columnas);
+    almacen.valores = std::move(pesos);
+    almacen.idsOriginales.clear();
+    
+    almacen.gradoEntrada.assign(numNodos, 0);
+    for (int destino : almacen.columnas) {
+        almacen.gradoEntrada[destino]++;
+    }
+    enlazarAlmacen();
+}
+
+bool GrafoDisperso::extraerSubgrafo(const std::vector<int>& nodos, GrafoDisperso& destino) const {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    
+    for (int nodo : nodos) {
+        if (nodo < 0 || nodo >= numNodos) {
+            std::cerr << "[C++ Core] Error: Nodo " << nodo << " invalido para el subgrafo." << std::endl;
+            return false;
+        }
+    }
+    
+    // Orden creciente: el reetiquetado es monótono y las filas quedan ordenadas
+    VectorGrafo<int> ids(nodos.begin(), nodos.end());
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    int n = static_cast<int>(ids.size());
+    
+    VectorTemporal<int> local(numNodos, -1);
+    paraleloPara(n, 4096, [&](int64_t desde, int64_t hasta, int) {
+        for (int64_t i = desde; i < hasta; i++) {
+            local[ids[i]] = static_cast<int>(i);
+        }
+    }, "GrafoDisperso::extraerSubgrafo");
+    
+    // Contar las aristas que sobreviven en cada fila
+    VectorGrafo<int> rowPtr(n + 1, 0);
+    paraleloPara(n, 1024, [&](int64_t desde, int64_t hasta, int) {
+        for (int64_t i = desde; i < hasta; i++) {
+            int u = ids[i];
+            int cuenta = 0;
+            for (int k = row_ptr[u]; k < row_ptr[u + 1]; k++) {
+                cuenta += local[column_indices[k]] >= 0;
+            }
+            rowPtr[i + 1] = cuenta;
+        }
+    }, "GrafoDisperso::extraerSubgrafo");
+    for (int i = 1; i <= n; i++) {
+        rowPtr[i] += rowPtr[i - 1];
+    }
+    
+    // Copiar columnas reetiquetadas y pesos
+    VectorGrafo<int> columnas(rowPtr[n]);
+    VectorGrafo<int> pesos(rowPtr[n]);
+    paraleloPara(n, 1024, [&](int64_t desde, int64_t hasta, int) {
+        for (int64_t i = desde; i < hasta; i++) {
+            int u = ids[i];
+            int pos = rowPtr[i];
+            for (int k = row_ptr[u]; k < row_ptr[u + 1]; k++) {
+                int v = local[column_indices[k]];
+                if (v >= 0) {
+                    columnas[pos] = v;
+                    pesos[pos] = values[k];
+                    pos++;
+                }
+            }
+        }
+    }, "GrafoDisperso::extraerSubgrafo");
+    
+    // Si este grafo ya es un subgrafo, se compone la correspondencia
+    if (numIdsOriginales > 0) {
+        for (int& id : ids) {
+            id = idsOriginales[id];
+        }
+    }
+    
+    destino.asignarCSR(std::move(rowPtr), std::move(columnas), std::move(pesos));
+    destino.almacen.idsOriginales = std::move(ids);
+    destino.enlazarAlmacen();
+    
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+    
+    std::cout << "[C++ Core] Subgrafo inducido extraido. Nodos: " << destino.numNodos
+              << " | Aristas: " << destino.numAristas
+              << ". Tiempo ejecucion: " << duration.count() / 1000.0 << " ms." << std::endl;
+    
+    return true;
+}
+
+bool GrafoDisperso::extraerSubgrafoBFS(int nodoInicio, int profundidadMaxima,
+                                       GrafoDisperso& destino) const {
+    if (nodoInicio < 0 || nodoInicio >= numNodos) {
+        std::cerr << "[C++ Core] Error: Nodo de inicio invalido." << std::endl;
+        return false;
+    }
+    if (profundidadMaxima < 0) {
+        std::cerr << "[C++ Core] Error: La profundidad debe ser no negativa." << std::endl;
+        return false;
+    }
+    
+    EspacioBFS espacio(numNodos);
+    bfsDistancias(vistaCSR(), nodoInicio, espacio, profundidadMaxima);
+    return extraerSubgrafo(espacio.visitados, destino);
+}
+
+int64_t GrafoDisperso::aristasSubgrafoLote(const std::vector<int>& semillas, int profundidadMaxima,
+                                           std::vector<int64_t>& offsets,
+                                           std::vector<int>& aristas) const {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    
+    int64_t numSemillas = static_cast<int64_t>(semillas.size());
+    VistaCSR csr = vistaCSR();
+    
+    // Un espacio BFS por hilo, creado solo si el hilo llega a trabajar
+    std::vector<std::unique_ptr<EspacioBFS>> espacios(numHilosDisponibles());
+    std::vector<std::vector<int>> porSemilla(numSemillas);
+    
+    paraleloPara(numSemillas, 16, [&](int64_t desde, int64_t hasta, int hilo) {
+        if (!espacios[hilo]) {
+            espacios[hilo].reset(new EspacioBFS(numNodos));
+        }
+        EspacioBFS& espacio = *espacios[hilo];
+        
+        for (int64_t s = desde; s < hasta; s++) {
+            int semilla = semillas[s];
+            if (semilla < 0 || semilla >= numNodos) {
+                continue;
+            }
+            bfsDistancias(csr, semilla, espacio, profundidadMaxima);
+            
+            // Mismo orden que getAristasSubgrafo: nodos en orden BFS y
+            // todas las aristas salientes de los niveles internos
+            std::vector<int>& local = porSemilla[s];
+            for (int u : espacio.visitados) {
+                if (espacio.distancia[u] >= profundidadMaxima) {
+                    continue;
+                }
+                for (int k = row_ptr[u]; k < row_ptr[u + 1]; k++) {
+                    local.push_back(u);
+                    local.push_back(column_indices[k]);
+                }
+            }
+        }
+    }, "GrafoDisperso::aristasSubgrafoLote", static_cast<int>(espacios.size()));
+    
+    offsets.assign(numSemillas + 1, 0);
+    for (int64_t s = 0; s < numSemillas; s++) {
+        offsets[s + 1] = offsets[s] + static_cast<int64_t>(porSemilla[s].size() / 2);
+    }
+    
+    aristas.resize(offsets[numSemillas] * 2);
+    paraleloPara(numSemillas, 16, [&](int64_t desde, int64_t hasta, int) {
+        for (int64_t s = desde; s < hasta; s++) {
+            std::copy(porSemilla[s].begin(), porSemilla[s].end(), aristas.begin() + offsets[s] * 2);
+            std::vector<int>().swap(porSemilla[s]);
+        }
+    }, "GrafoDisperso::aristasSubgrafoLote");
+    
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+    
+    std::cout << "[C++ Core] Redes ego en lote: " << numSemillas << " semillas | Aristas: "
+              << offsets[numSemillas] << ". Tiempo ejecucion: " << duration.count() / 1000.0
+              << " ms." << std::endl;
+    
+    return offsets[numSemillas];
+}
+
+bool GrafoDisperso::importarCSR(const int* rowPtr, const int* columnas, const int* pesos,
+                                const int* ids, int numNodos, int numAristas) {
+    if (numNodos < 0 || numAristas < 0 ||
+        !esCSRValido(rowPtr, columnas, numNodos, numAristas, "GrafoDisperso::importarCSR")) {
+        std::cerr << "[C++ Core] Error: Los arreglos recibidos no forman un grafo CSR valido." << std::endl;
+        return false;
+    }
+    
+    VectorGrafo<int> filas(rowPtr, rowPtr + numNodos + 1);
+    VectorGrafo<int> destinos(columnas, columnas + numAristas);
+    VectorGrafo<int> valores = pesos != nullptr ? VectorGrafo<int>(pesos, pesos + numAristas)
+                                                : VectorGrafo<int>(numAristas, 1);
+    asignarCSR(std::move(filas), std::move(destinos), std::move(valores));
+    if (ids != nullptr) {
+        almacen.idsOriginales.assign(ids, ids + numNodos);
+        enlazarAlmacen();
+    }
+    return true;
+}
+
+bool GrafoDisperso::publicarCompartido(const std::string& nombre, bool enArchivo) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    
+    CabeceraCSR cabecera;
+    std::memset(&cabecera, 0, sizeof(cabecera));
+    std::memcpy(cabecera.magia, MAGIA_CSR, sizeof(MAGIA_CSR));
+    cabecera.version = VERSION_CSR;
+    cabecera.bytesCabecera = sizeof(CabeceraCSR);
+    cabecera.numNodos = numNodos;
+    cabecera.numAristas = numAristas;
+    cabecera.numIds = numIdsOriginales;
+    distribuirCabecera(cabecera);
+    
+    std::unique_ptr<SegmentoCompartido> nuevo =
+        SegmentoCompartido::crear(nombre, static_cast<size_t>(cabecera.bytesTotales), enArchivo);
+    if (!nuevo) {
+        return false;
+    }
+    
+    char* base = static_cast<char*>(nuevo->datos());
+    auto copiar = [&](int64_t offset, const int* origen, int64_t cantidad) {
+        if (cantidad > 0) {
+            std::memcpy(base + offset, origen, cantidad * sizeof(int));
+        }
+    };
+    copiar(cabecera.offsetRowPtr, row_ptr, numNodos > 0 ? numNodos + 1 : 0);
+    copiar(cabecera.offsetColumnas, column_indices, numAristas);
+    copiar(cabecera.offsetValores, values, numAristas);
+    copiar(cabecera.offsetGradoEntrada, gradoEntrada, numNodos);
+    copiar(cabecera.offsetIds, idsOriginales, numIdsOriginales);
+    if (numNodos == 0) {
+        // Un grafo vacío se publica con row_ptr = {0}
+        std::memset(base + cabecera.offsetRowPtr, 0, sizeof(int));
+    }
+    // La cabecera se escribe al final: un lector nunca ve una magia válida
+    // sobre arreglos a medio copiar
+    std::memcpy(base, &cabecera, sizeof(cabecera));
+    
+    if (!enArchivo) {
+        // El publicador pasa a leer del segmento y suelta su copia privada
+        almacen = AlmacenCSR();
+        segmento = std::move(nuevo);
+        row_ptr = reinterpret_cast<const int*>(base + cabecera.offsetRowPtr);
+        column_indices = reinterpret_cast<const int*>(base + cabecera.offsetColumnas);
+        values = reinterpret_cast<const int*>(base + cabecera.offsetValores);
+        gradoEntrada = reinterpret_cast<const int*>(base + cabecera.offsetGradoEntrada);
+        idsOriginales = reinterpret_cast<const int*>(base + cabecera.offsetIds);
+    }
+    
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+    
+    std::cout << "[C++ Core] Grafo publicado en " << (enArchivo ? "archivo " : "segmento ") << nombre
+              << " (" << cabecera.bytesTotales / (1024.0 * 1024.0) << " MB). Tiempo ejecucion: "
+              << duration.count() / 1000.0 << " ms." << std::endl;
+    
+    return true;
+}
+
+bool GrafoDisperso::adjuntarCompartido(const std::string& nombre, bool enArchivo) {
+    std::unique_ptr<SegmentoCompartido> nuevo = SegmentoCompartido::abrir(nombre, enArchivo);
+    if (!nuevo) {
+        std::cerr << "[C++ Core] Error: No existe el grafo compartido " << nombre << std::endl;
+        return false;
+    }
+    
+    const char* base = static_cast<const char*>(nuevo->datos());
+    int64_t bytes = static_cast<int64_t>(nuevo->tamano());
+    CabeceraCSR cabecera;
+    bool valido = bytes >= static_cast<int64_t>(sizeof(CabeceraCSR));
+    if (valido) {
+        std::memcpy(&cabecera, base, sizeof(cabecera));
+        CabeceraCSR esperada = cabecera;
+        valido = std::memcmp(cabecera.magia, MAGIA_CSR, sizeof(MAGIA_CSR)) == 0 &&
+                 cabecera.version == VERSION_CSR &&
+                 cabecera.bytesCabecera == sizeof(CabeceraCSR) &&
+                 cabecera.numNodos >= 0 && cabecera.numNodos < INT_MAX &&
+                 cabecera.numAristas >= 0 && cabecera.numAristas <= INT_MAX &&
+                 (cabecera.numIds == 0 || cabecera.numIds == cabecera.numNodos);
+        if (valido) {
+            distribuirCabecera(esperada);
+            valido = std::memcmp(&esperada, &cabecera, sizeof(cabecera)) == 0 &&
+                     cabecera.bytesTotales <= bytes;
+        }
+    }
+    
+    int n = 0;
+    int m = 0;
+    const int* rowPtr = nullptr;
+    const int* columnas = nullptr;
+    if (valido) {
+        n = static_cast<int>(cabecera.numNodos);
+        m = static_cast<int>(cabecera.numAristas);
+        rowPtr = reinterpret_cast<const int*>(base + cabecera.offsetRowPtr);
+        columnas = reinterpret_cast<const int*>(base + cabecera.offsetColumnas);
+        valido = esCSRValido(rowPtr, columnas, n, m, "GrafoDisperso::adjuntarCompartido") &&
+                 esGradoEntradaValido(columnas,
+                                      reinterpret_cast<const int*>(base + cabecera.offsetGradoEntrada),
+                                      n, m, "GrafoDisperso::adjuntarCompartido");
+    }
+    if (!valido) {
+        std::cerr << "[C++ Core] Error: " << nombre << " no contiene un grafo CSR valido." << std::endl;
+        return false;
+    }
+    
+    almacen = AlmacenCSR();
+    segmento = std::move(nuevo);
+    numNodos = n;
+    numAristas = m;
+    row_ptr = rowPtr;
+    column_indices = columnas;
+    values = reinterpret_cast<const int*>(base + cabecera.offsetValores);
+    gradoEntrada = reinterpret_cast<const int*>(base + cabecera.offsetGradoEntrada);
+    idsOriginales = reinterpret_cast<const int*>(base + cabecera.offsetIds);
+    numIdsOriginales = static_cast<int>(cabecera.numIds);
+    
+    std::cout << "[C++ Core] Grafo compartido adjuntado (solo lectura): " << nombre
+              << ". Nodos: " << numNodos << " | Aristas: " << numAristas << std::endl;
+    
+    return true;
+}
+
+bool GrafoDisperso::eliminarCompartido(const std::string& nombre) {
+    return SegmentoCompartido::eliminar(nombre);
+}
+
+bool GrafoDisperso::esCompartido() const {
+    return static_cast<bool>(segmento);
+}
+
 void GrafoDisperso::printDebugInfo() {
     std::cout << "\n=== Debug Info ===" << std::endl;
     std::cout << "Nodos: " << numNodos << std::endl;
@@ -327,13 +1177,13 @@ void GrafoDisperso::printDebugInfo() {
     std::cout << "Memoria: " << getMemoriaUsada() / (1024.0 * 1024.0) << " MB" << std::endl;
     
     std::cout << "\nrow_ptr (primeros 10): ";
-    for (int i = 0; i < std::min(10, (int)row_ptr.size()); i++) {
+    for (int i = 0; i < std::min(10, row_ptr != nullptr ? numNodos + 1 : 0); i++) {
         std::cout << row_ptr[i] << " ";
     }
     std::cout << std::endl;
     
     std::cout << "column_indices (primeros 20): ";
-    for (int i = 0; i < std::min(20, (int)column_indices.size()); i++) {
+    for (int i = 0; i < std::min(20, numAristas); i++) {
         std::cout << column_indices[i] << " ";
     }
     std::cout << std::endl;
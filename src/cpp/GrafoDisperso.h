@@ -11,6 +11,7 @@
 #define GRAFO_DISPERSO_H
 
 #include "GrafoBase.h"
+#include "ContabilidadMemoria.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -20,6 +21,32 @@
 #include <unordered_map>
 #include <algorithm>
 #include <chrono>
+#include <memory>
+
+class ControlTrabajo;
+class SegmentoCompartido;
+
+/**
+ * @struct VistaCSR
+ * @brief Vista de solo lectura sobre los arreglos CSR de un grafo
+ * 
+ * Permite que los motores de análisis (caminatas, recorridos, índices)
+ * accedan a la estructura dispersa sin copiarla ni pasar por los
+ * métodos que construyen vectores nuevos en cada llamada.
+ */
+struct VistaCSR {
+    const int* rowPtr = nullptr;     ///< numNodos + 1 punteros de fila
+    const int* columnas = nullptr;   ///< Destinos de las aristas
+    const int* valores = nullptr;    ///< Pesos de las aristas
+    const int* gradoEntrada = nullptr; ///< Grado de entrada por nodo
+    int numNodos = 0;                ///< Número de filas
+    int numAristas = 0;              ///< Número de elementos no nulos
+
+    /**
+     * @brief Grado de salida de un nodo (sin validar el rango)
+     */
+    int grado(int nodo) const { return rowPtr[nodo + 1] - rowPtr[nodo]; }
+};
 
 /**
  * @class GrafoDisperso
@@ -35,23 +62,65 @@
  */
 class GrafoDisperso : public GrafoBase {
 private:
-    // Vectores CSR para representación de la matriz de adyacencia
-    std::vector<int> row_ptr;        ///< Punteros al inicio de cada fila
-    std::vector<int> column_indices; ///< Índices de columna (destinos de aristas)
-    std::vector<int> values;         ///< Valores de las aristas (peso = 1)
+    /**
+     * @brief Arreglos propios del grafo cuando no vive en un segmento compartido
+     */
+    struct AlmacenCSR {
+        VectorGrafo<int> rowPtr;
+        VectorGrafo<int> columnas;
+        VectorGrafo<int> valores;
+        VectorCache<int> gradoEntrada;   ///< Derivado de columnas
+        VectorGrafo<int> idsOriginales;
+    };
+    
+    AlmacenCSR almacen;                          ///< Vacío mientras el grafo usa un segmento
+    std::unique_ptr<SegmentoCompartido> segmento; ///< Segmento publicado o adjuntado (o nulo)
+    
+    // Vectores CSR para representación de la matriz de adyacencia. Apuntan
+    // a `almacen` o a un segmento compartido de solo lectura.
+    const int* row_ptr = nullptr;        ///< Punteros al inicio de cada fila
+    const int* column_indices = nullptr; ///< Índices de columna (destinos de aristas)
+    const int* values = nullptr;         ///< Valores de las aristas (peso = 1)
     
     int numNodos;                    ///< Número total de nodos
     int numAristas;                  ///< Número total de aristas
     
     // Para grado de entrada (requiere estructura adicional o cálculo)
-    std::vector<int> gradoEntrada;   ///< Cache del grado de entrada por nodo
+    const int* gradoEntrada = nullptr;   ///< Cache del grado de entrada por nodo
+    
+    // IDs del grafo de origen cuando este grafo es un subgrafo extraído
+    const int* idsOriginales = nullptr;  ///< Nodo local -> ID original (nulo si se cargó de archivo)
+    int numIdsOriginales = 0;
+    
+    /**
+     * @brief Libera el segmento compartido y apunta los arreglos a `almacen`
+     */
+    void enlazarAlmacen();
     
     /**
      * @brief Construye la estructura CSR a partir de una lista de aristas
      * @param aristas Vector de pares (origen, destino)
      * @param maxNodo El ID máximo de nodo encontrado
      */
-    void construirCSR(std::vector<std::pair<int, int>>& aristas, int maxNodo);
+    void construirCSR(VectorTemporal<std::pair<int, int>>& aristas, int maxNodo);
+    
+    /**
+     * @brief Adopta arreglos CSR ya construidos (filas ordenadas)
+     * @param rowPtr Punteros de fila (numNodos + 1 entradas)
+     * @param columnas Destinos de las aristas
+     * @param pesos Pesos de las aristas (mismo tamaño que columnas)
+     * 
+     * Recalcula el grado de entrada y los contadores a partir de los arreglos.
+     */
+    void asignarCSR(VectorGrafo<int>&& rowPtr, VectorGrafo<int>&& columnas,
+                    VectorGrafo<int>&& pesos);
+    
+    /**
+     * @brief Implementación común de construirDesdeAristas (T = int32_t o int64_t)
+     */
+    template <typename T>
+    bool construirDesdeArreglos(const T* origenes, const T* destinos, const int* pesos,
+                                int64_t cantidad);
 
 public:
     /**
@@ -63,6 +132,10 @@ public:
      * @brief Destructor
      */
     ~GrafoDisperso() override;
+    
+    // Los arreglos pueden vivir en un segmento compartido: no se copia
+    GrafoDisperso(const GrafoDisperso&) = delete;
+    GrafoDisperso& operator=(const GrafoDisperso&) = delete;
 
     // Implementaciones de métodos virtuales de GrafoBase
     bool cargarDatos(const std::string& filename) override;
@@ -74,9 +147,202 @@ public:
     int getNumNodos() override;
     int getNumAristas() override;
     std::pair<int, int> getNodoMayorGrado() override;
+    /** Arreglos propios o segmento mapeado; temporales e índices: obtenerEstadoMemoria() */
     size_t getMemoriaUsada() override;
     std::vector<std::pair<int, int>> getAristasSubgrafo(int nodoInicio, int profundidadMaxima) override;
     
+    /**
+     * @brief Carga un Edge List informando progreso y atendiendo cancelación
+     * @param filename Ruta del archivo
+     * @param control Progreso (bytes leídos / tamaño del archivo) y token
+     *        de cancelación; puede ser nulo
+     * @return false si hubo error o se canceló (el grafo anterior queda intacto)
+     */
+    bool cargarDatos(const std::string& filename, ControlTrabajo* control);
+    
+    /**
+     * @brief BFS limitado con progreso (nivel actual / profundidad máxima)
+     * @return Nodos visitados hasta el momento de la cancelación, si la hubo
+     */
+    std::vector<std::pair<int, int>> BFS(int nodoInicio, int profundidadMaxima,
+                                         ControlTrabajo* control);
+    
+    /**
+     * @brief DFS con progreso (nodos visitados / total de nodos)
+     * @return Prefijo del orden DFS si se canceló
+     */
+    std::vector<int> DFS(int nodoInicio, ControlTrabajo* control);
+    
+    /**
+     * @brief Obtiene una vista de solo lectura de los arreglos CSR
+     * @return VistaCSR válida mientras el grafo no se vuelva a cargar
+     */
+    VistaCSR vistaCSR() const;
+    
+    /**
+     * @brief Construye la versión no dirigida (simétrica) de la estructura
+     * @param rowPtr Salida: punteros de fila de la vista simétrica
+     * @param columnas Salida: vecinos ordenados y sin duplicados ni lazos
+     * @return VistaCSR sobre los vectores de salida (sin valores ni grado de entrada)
+     * 
+     * Cada arista u->v aparece como u-v y v-u. Es la base de los análisis
+     * que se definen sobre grafos no dirigidos (diámetro, excentricidad).
+     */
+    VistaCSR vistaNoDirigida(VectorIndice<int>& rowPtr, VectorIndice<int>& columnas) const;
+    
+    /**
+     * @brief Construye la estructura transpuesta (aristas invertidas)
+     * @param rowPtr Salida: punteros de fila de la transpuesta
+     * @param columnas Salida: predecesores de cada nodo, ordenados
+     * @return VistaCSR sobre los vectores de salida (sin valores ni grado de entrada)
+     * 
+     * La fila v de la transpuesta contiene los nodos u con arista u->v;
+     * permite recorridos hacia atrás (distancias hacia un nodo).
+     */
+    VistaCSR vistaTranspuesta(VectorIndice<int>& rowPtr, VectorIndice<int>& columnas) const;
+    
+    /**
+     * @brief Extrae el subgrafo inducido por un conjunto de nodos
+     * @param nodos IDs de los nodos (se ignoran duplicados; el orden no importa)
+     * @param destino Grafo que recibe el subgrafo compacto y reetiquetado
+     * @return true si la extracción fue exitosa, false si algún ID es inválido
+     * 
+     * El nodo local i corresponde al i-ésimo ID original en orden
+     * creciente, de modo que las filas del resultado siguen ordenadas.
+     * Se conservan todas las aristas u->v con ambos extremos en el
+     * conjunto, junto con sus pesos. getIdsOriginales() del destino
+     * devuelve la correspondencia con los IDs originales.
+     */
+    bool extraerSubgrafo(const std::vector<int>& nodos, GrafoDisperso& destino) const;
+    
+    /**
+     * @brief Extrae el subgrafo inducido por la vecindad BFS de un nodo
+     * @param nodoInicio Nodo central
+     * @param profundidadMaxima Distancia máxima (saltos salientes) desde el centro
+     * @param destino Grafo que recibe el subgrafo
+     * @return true si la extracción fue exitosa
+     * 
+     * A diferencia de getAristasSubgrafo, el resultado es inducido:
+     * incluye también las aristas entre nodos del último nivel.
+     */
+    bool extraerSubgrafoBFS(int nodoInicio, int profundidadMaxima, GrafoDisperso& destino) const;
+    
+    /**
+     * @brief Aristas de las redes ego de muchas semillas en una sola llamada
+     * @param semillas Nodos centrales (los IDs inválidos producen una red vacía)
+     * @param profundidadMaxima Profundidad del BFS de cada red ego
+     * @param offsets Salida: la red i ocupa las aristas [offsets[i], offsets[i+1])
+     * @param aristas Salida: pares (origen, destino) concatenados, 2 enteros por arista
+     * @return Número total de aristas
+     * 
+     * Cada red ego contiene las mismas aristas, en el mismo orden, que
+     * getAristasSubgrafo. Las semillas se reparten entre hilos, cada uno
+     * con su propio espacio BFS reutilizable.
+     */
+    int64_t aristasSubgrafoLote(const std::vector<int>& semillas, int profundidadMaxima,
+                                std::vector<int64_t>& offsets, std::vector<int>& aristas) const;
+    
+    /**
+     * @brief Correspondencia nodo local -> ID en el grafo cargado de archivo
+     * @return Vector vacío si el grafo no es un subgrafo extraído
+     */
+    std::vector<int> getIdsOriginales() const {
+        return std::vector<int>(idsOriginales, idsOriginales + numIdsOriginales);
+    }
+    
+    /**
+     * @brief IDs originales sin copiar (numNodos entradas)
+     * @return nullptr si el grafo no es un subgrafo extraído
+     */
+    const int* datosIdsOriginales() const {
+        return numIdsOriginales > 0 ? idsOriginales : nullptr;
+    }
+    
+    /**
+     * @brief Construye el grafo a partir de arreglos de aristas en memoria
+     * @param origenes Origen de cada arista
+     * @param destinos Destino de cada arista
+     * @param pesos Peso de cada arista, o nulo para peso 1
+     * @param cantidad Número de aristas
+     * @return false si algún ID es negativo o no cabe en int (el grafo
+     *         anterior queda intacto)
+     * 
+     * Equivale a cargar un Edge List con esas aristas (numNodos = máximo
+     * ID + 1), pero sin pasar por texto: conteo, reparto y ordenación de
+     * filas se hacen en paralelo directamente sobre los arreglos.
+     */
+    bool construirDesdeAristas(const int32_t* origenes, const int32_t* destinos, const int* pesos,
+                               int64_t cantidad);
+    bool construirDesdeAristas(const int64_t* origenes, const int64_t* destinos, const int* pesos,
+                               int64_t cantidad);
+    
+    /**
+     * @brief Usa arreglos CSR del llamador sin copiarlos
+     * @param rowPtr nodos + 1 punteros de fila
+     * @param columnas aristas destinos, ordenados dentro de cada fila
+     * @param pesos aristas pesos, o nulo para peso 1
+     * @return false si los arreglos no forman un CSR válido
+     * 
+     * El llamador debe mantener vivos y sin modificar los arreglos mientras
+     * el grafo los use (hasta que se destruya o se vuelva a cargar). Solo
+     * se reservan el grado de entrada y, si faltan, los pesos.
+     */
+    bool adoptarCSR(const int* rowPtr, const int* columnas, const int* pesos,
+                    int nodos, int aristas);
+    
+    /**
+     * @brief Copia arreglos CSR construidos fuera (p. ej. recibidos de otro proceso)
+     * @param rowPtr numNodos + 1 punteros de fila
+     * @param columnas numAristas destinos, filas ordenadas
+     * @param pesos numAristas pesos, o nulo para peso 1
+     * @param ids numNodos IDs originales, o nulo si no es un subgrafo
+     * @return false si los arreglos no forman un CSR válido (el grafo
+     *         anterior queda intacto)
+     * 
+     * Una sola copia de memoria por arreglo; el grado de entrada se recalcula.
+     */
+    bool importarCSR(const int* rowPtr, const int* columnas, const int* pesos, const int* ids,
+                     int numNodos, int numAristas);
+    
+    /**
+     * @brief Publica los arreglos CSR en memoria compartida con nombre
+     * @param nombre Nombre del segmento POSIX (p. ej. "/neuronet_grafo") o,
+     *        si enArchivo, ruta del archivo de instantánea
+     * @param enArchivo Escribir una instantánea mapeable en disco en lugar
+     *        de un segmento en memoria
+     * @return false si el nombre ya existe o no se pudo crear
+     * 
+     * Tras publicar en memoria, este grafo pasa a leer del segmento y
+     * libera sus vectores, de modo que el proceso no guarda dos copias.
+     * El nombre se elimina cuando este grafo se destruye o se vuelve a
+     * cargar; los procesos ya adjuntos conservan su mapeo. La instantánea
+     * en archivo permanece en disco y el grafo conserva sus vectores.
+     */
+    bool publicarCompartido(const std::string& nombre, bool enArchivo);
+    
+    /**
+     * @brief Adjunta de solo lectura un grafo publicado por otro proceso
+     * @param nombre Nombre usado en publicarCompartido
+     * @param enArchivo El nombre es la ruta de una instantánea en disco
+     * @return false si no existe o el contenido no es un CSR válido (el
+     *         grafo anterior queda intacto)
+     * 
+     * No se copia ningún arreglo: las consultas leen directamente del
+     * mapeo, compartido entre todos los procesos adjuntos.
+     */
+    bool adjuntarCompartido(const std::string& nombre, bool enArchivo);
+    
+    /**
+     * @brief Elimina el nombre de un segmento publicado (p. ej. huérfano)
+     * @return false si no existía
+     */
+    static bool eliminarCompartido(const std::string& nombre);
+    
+    /**
+     * @brief Indica si los arreglos CSR viven en un segmento compartido
+     */
+    bool esCompartido() const;
+    
     /**
      * @brief Imprime información de debug del grafo
      */
@@ -0,0 +1,770 @@
+/**
+ * @file GrafoExterno.cpp
+ * @brief Implementación del grafo semiexterno
+ * @author NeuroNet Team
+ */
+
+#include "GrafoExterno.h"
+#include "LecturaAristas.h"
+#include "MemoriaCompartida.h"
+#include "Paralelo.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+/**
+ * Cabecera de un archivo .nnext. Los arreglos siguen a la cabecera,
+ * cada uno alineado a 64 bytes.
+ */
+struct CabeceraExterna {
+    char magia[8];
+    uint32_t version;
+    uint32_t bytesCabecera;
+    int64_t numNodos;
+    int64_t numAristas;
+    int64_t offsetRowPtr;
+    int64_t offsetGradoEntrada;
+    int64_t offsetColumnas;
+    int64_t bytesTotales;
+};
+
+const char MAGIA_EXTERNO[8] = {'N', 'N', 'E', 'X', 'T', '0', '1', '\0'};
+const uint32_t VERSION_EXTERNO = 1;
+
+// Memoria para aristas al convertir desde cargarDatos
+const size_t MEMORIA_CONVERSION = size_t(1) << 30;
+
+// Columnas por lectura en los barridos (32 MB)
+const int64_t BLOQUE_COLUMNAS = int64_t(8) << 20;
+
+// Hueco máximo (en columnas) entre dos filas que se leen juntas: leer
+// 256 KB de más cuesta menos que otro acceso aleatorio al disco
+const int64_t HUECO_MAXIMO = int64_t(64) << 10;
+
+// Columnas de una fila que el DFS lee de una vez sin mmap
+const int64_t TRAMO_DFS = 1024;
+
+int64_t alinear64(int64_t bytes) {
+    return (bytes + 63) & ~int64_t(63);
+}
+
+/**
+ * Calcula los offsets de cada arreglo y el tamaño total del archivo
+ */
+void distribuirCabecera(CabeceraExterna& cabecera) {
+    int64_t pos = alinear64(sizeof(CabeceraExterna));
+    cabecera.offsetRowPtr = pos;
+    pos = alinear64(pos + (cabecera.numNodos + 1) * int64_t(sizeof(int64_t)));
+    cabecera.offsetGradoEntrada = pos;
+    pos = alinear64(pos + cabecera.numNodos * int64_t(sizeof(int)));
+    cabecera.offsetColumnas = pos;
+    cabecera.bytesTotales = pos + cabecera.numAristas * int64_t(sizeof(int));
+}
+
+bool esDestinoValido(int v, int n) {
+    return static_cast<unsigned int>(v) < static_cast<unsigned int>(n);
+}
+
+/**
+ * Coloca en memoria las filas de los nodos [desde, hasta) con las aristas
+ * de `aristas` cuyo origen cae en el tramo. cursor[u - desde] es la
+ * siguiente posición libre de la fila u, relativa al inicio del tramo.
+ */
+void colocarAristas(const ListaAristas& aristas, int desde, int hasta,
+                    std::vector<int64_t>& cursor, std::vector<int>& columnas) {
+    unsigned int ancho = static_cast<unsigned int>(hasta - desde);
+    for (const auto& arista : aristas) {
+        unsigned int o = static_cast<unsigned int>(arista.first - desde);
+        if (o < ancho) {
+            columnas[cursor[o]++] = arista.second;
+        }
+    }
+}
+
+/**
+ * Ordena cada fila del tramo por destino y lo añade al archivo
+ */
+void escribirTramo(std::ofstream& salida, const std::vector<int64_t>& filas, int desde, int hasta,
+                   std::vector<int>& columnas) {
+    int64_t base = filas[desde];
+    paraleloPara(hasta - desde, 4096, [&](int64_t a, int64_t b, int) {
+        for (int64_t u = desde + a; u < desde + b; u++) {
+            std::sort(columnas.begin() + (filas[u] - base), columnas.begin() + (filas[u + 1] - base));
+        }
+    }, "GrafoExterno::convertirListaAristas");
+    salida.write(reinterpret_cast<const char*>(columnas.data()),
+                 static_cast<std::streamsize>((filas[hasta] - base) * sizeof(int)));
+}
+
+void rellenarHasta(std::ofstream& salida, int64_t offset) {
+    static const char ceros[64] = {};
+    int64_t faltan = offset - static_cast<int64_t>(salida.tellp());
+    salida.write(ceros, static_cast<std::streamsize>(faltan));
+}
+
+} // namespace
+
+/**
+ * Acceso a column_indices para una operación: punteros al mapeo o, sin
+ * mmap, lecturas a un búfer propio (por eso cada operación crea el suyo)
+ */
+struct GrafoExterno::LectorColumnas {
+    const char* base = nullptr;     ///< Inicio del archivo mapeado (nulo sin mmap)
+    int64_t offset = 0;             ///< Posición de column_indices en el archivo
+    std::ifstream archivo;
+    std::vector<int> buffer;
+    bool fallo = false;
+
+    explicit LectorColumnas(const GrafoExterno& grafo) : offset(grafo.offsetColumnas) {
+        if (grafo.mapeo) {
+            base = static_cast<const char*>(grafo.mapeo->datos());
+        } else {
+            archivo.open(grafo.ruta, std::ios::binary);
+        }
+    }
+
+    /**
+     * Columnas [desde, desde + cantidad); válidas hasta la siguiente
+     * lectura. Sin mmap, cantidad no debe pasar de BLOQUE_COLUMNAS (las
+     * filas más largas se leen con recorrer)
+     */
+    const int* leer(int64_t desde, int64_t cantidad) {
+        if (base != nullptr) {
+            return reinterpret_cast<const int*>(base + offset) + desde;
+        }
+        if (static_cast<int64_t>(buffer.size()) < cantidad) {
+            buffer.resize(cantidad);
+        }
+        archivo.seekg(offset + desde * int64_t(sizeof(int)));
+        archivo.read(reinterpret_cast<char*>(buffer.data()),
+                     static_cast<std::streamsize>(cantidad * sizeof(int)));
+        if (!archivo) {
+            // Archivo truncado tras abrirlo: sin destinos válidos
+            if (!fallo) {
+                std::cerr << "[C++ Core] Error: Lectura incompleta de las aristas del grafo externo."
+                          << std::endl;
+                fallo = true;
+            }
+            std::fill(buffer.begin(), buffer.begin() + cantidad, -1);
+            archivo.clear();
+        }
+        return buffer.data();
+    }
+
+    /**
+     * Entrega las columnas [desde, desde + cantidad) a trozo(columnas, n):
+     * de una vez con mmap y, sin él, en trozos de BLOQUE_COLUMNAS, para no
+     * reservar un búfer del tamaño de una fila enorme
+     */
+    template <typename Trozo>
+    void recorrer(int64_t desde, int64_t cantidad, Trozo trozo) {
+        int64_t paso = base != nullptr ? std::max<int64_t>(cantidad, 1) : BLOQUE_COLUMNAS;
+        for (int64_t k = 0; k < cantidad; k += paso) {
+            int64_t n = std::min(paso, cantidad - k);
+            trozo(leer(desde + k, n), n);
+        }
+    }
+
+    /** Pide al sistema que cargue las columnas [desde, hasta) */
+    void anticipar(int64_t desde, int64_t hasta) { aconsejar(desde, hasta, true); }
+
+    /** Las columnas [desde, hasta) ya no se necesitan */
+    void descartar(int64_t desde, int64_t hasta) { aconsejar(desde, hasta, false); }
+
+private:
+    void aconsejar(int64_t desde, int64_t hasta, bool necesarias) {
+#ifndef _WIN32
+        if (base == nullptr || hasta <= desde) {
+            return;
+        }
+        static const int64_t pagina = static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+        int64_t inicio = (offset + desde * int64_t(sizeof(int))) / pagina * pagina;
+        int64_t fin = offset + hasta * int64_t(sizeof(int));
+        madvise(const_cast<char*>(base) + inicio, static_cast<size_t>(fin - inicio),
+                necesarias ? MADV_WILLNEED : MADV_DONTNEED);
+#else
+        (void)desde;
+        (void)hasta;
+        (void)necesarias;
+#endif
+    }
+};
+
+template <typename Fila, typename Cuerpo>
+void GrafoExterno::recorrerFilas(int64_t cantidad, Fila fila, bool barrido, LectorColumnas& lector,
+                                 Cuerpo cuerpo) const {
+    // Tramo [i, j) de filas que se leen juntas: columnas [desde, hasta)
+    struct Tramo {
+        int64_t i, j, desde, hasta;
+    };
+    auto tramoDesde = [&](int64_t i) {
+        Tramo t{i, i + 1, rowPtr[fila(i)], rowPtr[fila(i) + 1]};
+        while (t.j < cantidad) {
+            int u = fila(t.j);
+            if (rowPtr[u] - t.hasta > HUECO_MAXIMO || rowPtr[u + 1] - t.desde > BLOQUE_COLUMNAS) {
+                break;
+            }
+            t.hasta = rowPtr[u + 1];
+            t.j++;
+        }
+        return t;
+    };
+
+    if (cantidad <= 0) {
+        return;
+    }
+    Tramo actual = tramoDesde(0);
+    lector.anticipar(actual.desde, actual.hasta);
+    while (true) {
+        bool hayMas = actual.j < cantidad;
+        Tramo siguiente = hayMas ? tramoDesde(actual.j) : actual;
+        if (hayMas) {
+            lector.anticipar(siguiente.desde, siguiente.hasta);
+        }
+        if (actual.j == actual.i + 1) {
+            // Una sola fila, que puede superar BLOQUE_COLUMNAS
+            int u = fila(actual.i);
+            lector.recorrer(actual.desde, actual.hasta - actual.desde,
+                            [&](const int* columnas, int64_t n) { cuerpo(u, columnas, n); });
+        } else {
+            const int* columnas = lector.leer(actual.desde, actual.hasta - actual.desde);
+            for (int64_t k = actual.i; k < actual.j; k++) {
+                int u = fila(k);
+                cuerpo(u, columnas + (rowPtr[u] - actual.desde), rowPtr[u + 1] - rowPtr[u]);
+            }
+        }
+        if (barrido) {
+            lector.descartar(actual.desde, actual.hasta);
+        }
+        if (!hayMas) {
+            break;
+        }
+        actual = siguiente;
+    }
+}
+
+GrafoExterno::GrafoExterno() : numNodos(0), numAristas(0), offsetColumnas(0) {
+    std::cout << "[C++ Core] Inicializando GrafoExterno..." << std::endl;
+}
+
+GrafoExterno::~GrafoExterno() {
+    // El mapeo (si lo hay) se libera automáticamente
+}
+
+void GrafoExterno::cerrar() {
+    mapeo.reset();
+    std::vector<int64_t>().swap(rowPtr);
+    std::vector<int>().swap(gradoEntrada);
+    numNodos = 0;
+    numAristas = 0;
+    offsetColumnas = 0;
+    ruta.clear();
+}
+
+bool GrafoExterno::convertirListaAristas(const std::string& listaAristas, const std::string& destino,
+                                         size_t memoriaMaxima) {
+    std::cout << "[C++ Core] Convirtiendo '" << listaAristas << "' a grafo externo '" << destino
+              << "'..." << std::endl;
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Primera pasada: grados de salida y de entrada. Mientras quepan, las
+    // aristas se retienen para no tener que releer el archivo
+    const size_t maxRetenidas = memoriaMaxima / sizeof(std::pair<int, int>);
+    std::vector<int64_t> filas;
+    std::vector<int> entrada;
+    ListaAristas retenidas;
+    bool retener = true;
+    bool idsNegativos = false;
+    ListaAristas aristas;
+    int maxNodo = 0;
+
+    ResultadoLectura lectura = leerListaAristas(listaAristas, aristas, maxNodo, nullptr,
+        [&](ListaAristas& bloque) {
+            if (static_cast<size_t>(maxNodo) + 1 >= filas.size()) {
+                size_t nuevo = std::max(static_cast<size_t>(maxNodo) + 2, filas.size() * 2);
+                filas.resize(nuevo, 0);
+                entrada.resize(nuevo, 0);
+            }
+            for (const auto& arista : bloque) {
+                if (arista.first < 0 || arista.second < 0) {
+                    idsNegativos = true;
+                    continue;
+                }
+                filas[arista.first + 1]++;
+                entrada[arista.second]++;
+            }
+            if (retener && retenidas.size() + bloque.size() <= maxRetenidas) {
+                retenidas.insert(retenidas.end(), bloque.begin(), bloque.end());
+            } else if (retener) {
+                retener = false;
+                ListaAristas().swap(retenidas);
+            }
+            bloque.clear();
+        });
+    if (lectura != ResultadoLectura::Completa) {
+        std::cerr << "[C++ Core] Error: No se pudo abrir el archivo " << listaAristas << std::endl;
+        return false;
+    }
+    if (idsNegativos || maxNodo == INT_MAX) {
+        std::cerr << "[C++ Core] Error: Las aristas contienen IDs de nodo fuera de rango." << std::endl;
+        return false;
+    }
+
+    int n = maxNodo + 1;
+    filas.resize(n + 1, 0);
+    entrada.resize(n, 0);
+    for (int u = 0; u < n; u++) {
+        filas[u + 1] += filas[u];
+    }
+    int64_t m = filas[n];
+
+    CabeceraExterna cabecera;
+    std::memset(&cabecera, 0, sizeof(cabecera));
+    std::memcpy(cabecera.magia, MAGIA_EXTERNO, sizeof(MAGIA_EXTERNO));
+    cabecera.version = VERSION_EXTERNO;
+    cabecera.bytesCabecera = sizeof(CabeceraExterna);
+    cabecera.numNodos = n;
+    cabecera.numAristas = m;
+    distribuirCabecera(cabecera);
+
+    std::ofstream salida(destino, std::ios::binary | std::ios::trunc);
+    if (!salida.is_open()) {
+        std::cerr << "[C++ Core] Error: No se pudo crear " << destino << std::endl;
+        return false;
+    }
+    // La cabecera se escribe al final: un archivo a medio escribir no es válido
+    rellenarHasta(salida, cabecera.offsetRowPtr);
+    salida.write(reinterpret_cast<const char*>(filas.data()),
+                 static_cast<std::streamsize>((n + 1) * sizeof(int64_t)));
+    rellenarHasta(salida, cabecera.offsetGradoEntrada);
+    salida.write(reinterpret_cast<const char*>(entrada.data()),
+                 static_cast<std::streamsize>(n * sizeof(int)));
+    std::vector<int>().swap(entrada);
+    rellenarHasta(salida, cabecera.offsetColumnas);
+
+    // Las filas se colocan por tramos de nodos cuyas aristas caben en la
+    // memoria; cada tramo se escribe a continuación del anterior
+    const int64_t capacidad = std::max<int64_t>(1, memoriaMaxima / sizeof(int));
+    int pasadas = 1;
+    std::vector<int> columnas;
+    std::vector<int64_t> cursor;
+    for (int desde = 0; desde < n && salida;) {
+        int hasta = desde + 1;
+        if (retener) {
+            hasta = n;
+        } else {
+            while (hasta < n && filas[hasta + 1] - filas[desde] <= capacidad) {
+                hasta++;
+            }
+        }
+        columnas.resize(filas[hasta] - filas[desde]);
+        cursor.resize(hasta - desde);
+        for (int u = desde; u < hasta; u++) {
+            cursor[u - desde] = filas[u] - filas[desde];
+        }
+
+        if (retener) {
+            colocarAristas(retenidas, desde, hasta, cursor, columnas);
+            ListaAristas().swap(retenidas);
+        } else {
+            int ignorado = 0;
+            lectura = leerListaAristas(listaAristas, aristas, ignorado, nullptr,
+                [&](ListaAristas& bloque) {
+                    colocarAristas(bloque, desde, hasta, cursor, columnas);
+                    bloque.clear();
+                });
+            pasadas++;
+            if (lectura != ResultadoLectura::Completa) {
+                std::cerr << "[C++ Core] Error: No se pudo releer " << listaAristas << std::endl;
+                return false;
+            }
+        }
+        escribirTramo(salida, filas, desde, hasta, columnas);
+        desde = hasta;
+    }
+
+    salida.seekp(0);
+    salida.write(reinterpret_cast<const char*>(&cabecera), sizeof(cabecera));
+    salida.close();
+    if (!salida) {
+        std::cerr << "[C++ Core] Error: No se pudo escribir " << destino << std::endl;
+        return false;
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+
+    std::cout << "[C++ Core] Grafo externo escrito. Nodos: " << n << " | Aristas: " << m
+              << " | Pasadas por la lista: " << pasadas << ". Tiempo ejecucion: "
+              << duration.count() << " ms." << std::endl;
+
+    return true;
+}
+
+bool GrafoExterno::abrir(const std::string& rutaArchivo, bool usarMmap) {
+    cerrar();
+
+    std::ifstream archivo(rutaArchivo, std::ios::binary);
+    if (!archivo.is_open()) {
+        std::cerr << "[C++ Core] Error: No se pudo abrir el archivo " << rutaArchivo << std::endl;
+        return false;
+    }
+    archivo.seekg(0, std::ios::end);
+    int64_t bytes = static_cast<int64_t>(archivo.tellg());
+    archivo.seekg(0, std::ios::beg);
+
+    CabeceraExterna cabecera;
+    bool valido = bytes >= static_cast<int64_t>(sizeof(CabeceraExterna));
+    if (valido) {
+        archivo.read(reinterpret_cast<char*>(&cabecera), sizeof(cabecera));
+        CabeceraExterna esperada = cabecera;
+        valido = archivo && std::memcmp(cabecera.magia, MAGIA_EXTERNO, sizeof(MAGIA_EXTERNO)) == 0 &&
+                 cabecera.version == VERSION_EXTERNO &&
+                 cabecera.bytesCabecera == sizeof(CabeceraExterna) &&
+                 cabecera.numNodos >= 0 && cabecera.numNodos < INT_MAX && cabecera.numAristas >= 0;
+        if (valido) {
+            distribuirCabecera(esperada);
+            valido = std::memcmp(&esperada, &cabecera, sizeof(cabecera)) == 0 &&
+                     cabecera.bytesTotales <= bytes;
+        }
+    }
+
+    // Los punteros de fila y los grados de entrada se cargan en memoria;
+    // las columnas se validan al usarlas (recorrerlas aquí costaría una
+    // pasada completa por el disco)
+    if (valido) {
+        int n = static_cast<int>(cabecera.numNodos);
+        rowPtr.resize(n + 1);
+        gradoEntrada.resize(n);
+        archivo.seekg(cabecera.offsetRowPtr);
+        archivo.read(reinterpret_cast<char*>(rowPtr.data()),
+                     static_cast<std::streamsize>((n + 1) * sizeof(int64_t)));
+        archivo.seekg(cabecera.offsetGradoEntrada);
+        archivo.read(reinterpret_cast<char*>(gradoEntrada.data()),
+                     static_cast<std::streamsize>(n * sizeof(int)));
+        valido = archivo && rowPtr[0] == 0 && rowPtr[n] == cabecera.numAristas;
+        for (int u = 0; valido && u < n; u++) {
+            valido = rowPtr[u] <= rowPtr[u + 1];
+        }
+    }
+    if (!valido) {
+        std::cerr << "[C++ Core] Error: " << rutaArchivo << " no contiene un grafo externo valido."
+                  << std::endl;
+        cerrar();
+        return false;
+    }
+
+    numNodos = static_cast<int>(cabecera.numNodos);
+    numAristas = cabecera.numAristas;
+    offsetColumnas = cabecera.offsetColumnas;
+    ruta = rutaArchivo;
+    if (usarMmap) {
+        mapeo = SegmentoCompartido::abrir(rutaArchivo, true);
+        if (!mapeo) {
+            std::cout << "[C++ Core] Aviso: No se pudo mapear " << rutaArchivo
+                      << "; las aristas se leeran por bloques." << std::endl;
+        }
+    }
+
+    std::cout << "[C++ Core] Grafo externo abierto: " << rutaArchivo << ". Nodos: " << numNodos
+              << " | Aristas: " << numAristas << " | Acceso: "
+              << (mapeo ? "mmap" : "lectura por bloques") << ". Memoria en uso: "
+              << getMemoriaUsada() / (1024.0 * 1024.0) << " MB." << std::endl;
+
+    return true;
+}
+
+bool GrafoExterno::cargarDatos(const std::string& filename) {
+    std::cout << "[C++ Core] Cargando dataset externo '" << filename << "'..." << std::endl;
+
+    char magia[sizeof(MAGIA_EXTERNO)] = {};
+    {
+        std::ifstream archivo(filename, std::ios::binary);
+        if (!archivo.is_open()) {
+            std::cerr << "[C++ Core] Error: No se pudo abrir el archivo " << filename << std::endl;
+            return false;
+        }
+        archivo.read(magia, sizeof(magia));
+    }
+    if (std::memcmp(magia, MAGIA_EXTERNO, sizeof(MAGIA_EXTERNO)) == 0) {
+        return abrir(filename);
+    }
+
+    // Edge List: se convierte una vez y se reutiliza mientras sea más reciente
+    std::string convertido = filename + ".nnext";
+    std::error_code error;
+    bool vigente = std::filesystem::exists(convertido, error) &&
+                   std::filesystem::last_write_time(convertido, error) >=
+                       std::filesystem::last_write_time(filename, error) &&
+                   !error;
+    if (vigente && abrir(convertido)) {
+        return true;
+    }
+    return convertirListaAristas(filename, convertido, MEMORIA_CONVERSION) && abrir(convertido);
+}
+
+std::vector<std::pair<int, int>> GrafoExterno::recorrerNiveles(
+    int nodoInicio, int profundidadMaxima, std::vector<std::pair<int, int>>* aristas) const {
+    std::vector<std::pair<int, int>> resultado; // (nodo, distancia)
+
+    if (nodoInicio < 0 || nodoInicio >= numNodos) {
+        std::cerr << "[C++ Core] Error: Nodo de inicio invalido." << std::endl;
+        return resultado;
+    }
+
+    // La frontera de cada nivel se expande por ID creciente: las filas se
+    // leen en el orden del archivo y las cercanas en una sola lectura
+    std::vector<bool> visitado(numNodos, false);
+    std::vector<int> frontera{nodoInicio};
+    std::vector<int> siguiente;
+    visitado[nodoInicio] = true;
+    resultado.emplace_back(nodoInicio, 0);
+
+    LectorColumnas lector(*this);
+    for (int nivel = 0; nivel < profundidadMaxima && !frontera.empty(); nivel++) {
+        siguiente.clear();
+        recorrerFilas(static_cast<int64_t>(frontera.size()), [&](int64_t k) { return frontera[k]; },
+                      false, lector, [&](int u, const int* vecinos, int64_t grado) {
+            for (int64_t i = 0; i < grado; i++) {
+                int v = vecinos[i];
+                if (!esDestinoValido(v, numNodos)) {
+                    continue;
+                }
+                if (aristas != nullptr) {
+                    aristas->emplace_back(u, v);
+                }
+                if (!visitado[v]) {
+                    visitado[v] = true;
+                    siguiente.push_back(v);
+                }
+            }
+        });
+        std::sort(siguiente.begin(), siguiente.end());
+        for (int v : siguiente) {
+            resultado.emplace_back(v, nivel + 1);
+        }
+        frontera.swap(siguiente);
+    }
+    return resultado;
+}
+
+std::vector<std::pair<int, int>> GrafoExterno::BFS(int nodoInicio, int profundidadMaxima) {
+    std::cout << "[C++ Core] Ejecutando BFS externo desde nodo " << nodoInicio
+              << " con profundidad maxima " << profundidadMaxima << "..." << std::endl;
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    std::vector<std::pair<int, int>> resultado = recorrerNiveles(nodoInicio, profundidadMaxima, nullptr);
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+
+    std::cout << "[C++ Core] BFS completado. Nodos encontrados: " << resultado.size()
+              << ". Tiempo ejecucion: " << duration.count() / 1000.0 << " ms." << std::endl;
+
+    return resultado;
+}
+
+std::vector<int> GrafoExterno::DFS(int nodoInicio) {
+    std::cout << "[C++ Core] Ejecutando DFS externo desde nodo " << nodoInicio << "..." << std::endl;
+
+    std::vector<int> resultado;
+
+    if (nodoInicio < 0 || nodoInicio >= numNodos) {
+        std::cerr << "[C++ Core] Error: Nodo de inicio invalido." << std::endl;
+        return resultado;
+    }
+
+    // Pila de (nodo, siguiente arista por examinar): el mismo orden que
+    // apilar los vecinos en orden inverso, con O(profundidad) de estado
+    struct Marco {
+        int nodo;
+        int64_t siguiente;
+    };
+    std::vector<bool> visitado(numNodos, false);
+    std::vector<Marco> pila;
+    visitado[nodoInicio] = true;
+    resultado.push_back(nodoInicio);
+    pila.push_back({nodoInicio, rowPtr[nodoInicio]});
+
+    // Ventana de columnas [ventanaDesde, ventanaHasta) leída por última vez
+    LectorColumnas lector(*this);
+    const int* ventana = nullptr;
+    int64_t ventanaDesde = 0;
+    int64_t ventanaHasta = 0;
+
+    while (!pila.empty()) {
+        Marco& marco = pila.back();
+        int64_t fin = rowPtr[marco.nodo + 1];
+        int nuevo = -1;
+        while (marco.siguiente < fin && nuevo < 0) {
+            if (marco.siguiente < ventanaDesde || marco.siguiente >= ventanaHasta) {
+                ventanaDesde = marco.siguiente;
+                ventanaHasta = mapeo ? fin : std::min(fin, marco.siguiente + TRAMO_DFS);
+                ventana = lector.leer(ventanaDesde, ventanaHasta - ventanaDesde);
+            }
+            int v = ventana[marco.siguiente - ventanaDesde];
+            marco.siguiente++;
+            if (esDestinoValido(v, numNodos) && !visitado[v]) {
+                nuevo = v;
+            }
+        }
+        if (nuevo < 0) {
+            pila.pop_back();
+            continue;
+        }
+        visitado[nuevo] = true;
+        resultado.push_back(nuevo);
+        pila.push_back({nuevo, rowPtr[nuevo]});
+    }
+
+    std::cout << "[C++ Core] DFS completado. Nodos visitados: " << resultado.size() << std::endl;
+
+    return resultado;
+}
+
+int GrafoExterno::obtenerGrado(int nodo) {
+    if (nodo < 0 || nodo >= numNodos) {
+        return -1;
+    }
+    return static_cast<int>(std::min<int64_t>(rowPtr[nodo + 1] - rowPtr[nodo], INT_MAX));
+}
+
+int GrafoExterno::obtenerGradoEntrada(int nodo) {
+    if (nodo < 0 || nodo >= numNodos) {
+        return -1;
+    }
+    return gradoEntrada[nodo];
+}
+
+std::vector<int> GrafoExterno::getVecinos(int nodo) {
+    std::vector<int> vecinos;
+
+    if (nodo < 0 || nodo >= numNodos) {
+        return vecinos;
+    }
+
+    int64_t grado = rowPtr[nodo + 1] - rowPtr[nodo];
+    vecinos.reserve(grado);
+    LectorColumnas lector(*this);
+    lector.recorrer(rowPtr[nodo], grado, [&](const int* columnas, int64_t cantidad) {
+        // Como en los recorridos: un archivo truncado no aporta destinos
+        for (int64_t k = 0; k < cantidad; k++) {
+            if (esDestinoValido(columnas[k], numNodos)) {
+                vecinos.push_back(columnas[k]);
+            }
+        }
+    });
+
+    return vecinos;
+}
+
+int GrafoExterno::getNumNodos() {
+    return numNodos;
+}
+
+int GrafoExterno::getNumAristas() {
+    return static_cast<int>(std::min<int64_t>(numAristas, INT_MAX));
+}
+
+std::pair<int, int> GrafoExterno::getNodoMayorGrado() {
+    // (grado, nodo); ante empates gana el nodo de menor ID
+    using Candidato = std::pair<int64_t, int>;
+    auto mayorEnBloque = [&](int64_t desde, int64_t hasta) {
+        Candidato mejor(0, -1);
+        for (int64_t i = desde; i < hasta; i++) {
+            int64_t grado = rowPtr[i + 1] - rowPtr[i];
+            if (grado > mejor.first) {
+                mejor = {grado, static_cast<int>(i)};
+            }
+        }
+        return mejor;
+    };
+    auto combinar = [](const Candidato& a, const Candidato& b) { return b.first > a.first ? b : a; };
+    Candidato mejor = paraleloReducir(numNodos, 1 << 16, Candidato(0, -1), mayorEnBloque, combinar,
+                                      "GrafoExterno::getNodoMayorGrado");
+    int maxGrado = static_cast<int>(std::min<int64_t>(mejor.first, INT_MAX));
+
+    std::cout << "[C++ Core] Nodo con mayor grado de salida: " << mejor.second
+              << " (grado: " << maxGrado << ")" << std::endl;
+
+    return {mejor.second, maxGrado};
+}
+
+size_t GrafoExterno::getMemoriaUsada() {
+    return rowPtr.capacity() * sizeof(int64_t) + gradoEntrada.capacity() * sizeof(int);
+}
+
+std::vector<std::pair<int, int>> GrafoExterno::getAristasSubgrafo(int nodoInicio, int profundidadMaxima) {
+    std::cout << "[C++ Core] Obteniendo aristas del subgrafo externo desde nodo " << nodoInicio
+              << "..." << std::endl;
+
+    std::vector<std::pair<int, int>> aristas;
+    if (nodoInicio < 0 || nodoInicio >= numNodos) {
+        return aristas;
+    }
+    std::vector<std::pair<int, int>> nodos = recorrerNiveles(nodoInicio, profundidadMaxima, &aristas);
+
+    std::cout << "[C++ Core] Subgrafo obtenido. Nodos: " << nodos.size()
+              << " | Aristas: " << aristas.size() << std::endl;
+
+    return aristas;
+}
+
+int GrafoExterno::componentesConexas(std::vector<int>& etiquetas) const {
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Union-find donde la raíz de cada conjunto es su menor ID: el padre de
+    // un nodo nunca es mayor que él, y una pasada creciente final deja
+    // cada etiqueta apuntando a su raíz
+    etiquetas.resize(numNodos);
+    std::iota(etiquetas.begin(), etiquetas.end(), 0);
+    auto raiz = [&](int x) {
+        while (etiquetas[x] != x) {
+            etiquetas[x] = etiquetas[etiquetas[x]];
+            x = etiquetas[x];
+        }
+        return x;
+    };
+
+    LectorColumnas lector(*this);
+    recorrerFilas(numNodos, [](int64_t k) { return static_cast<int>(k); }, true, lector,
+                  [&](int u, const int* vecinos, int64_t grado) {
+        for (int64_t i = 0; i < grado; i++) {
+            if (!esDestinoValido(vecinos[i], numNodos)) {
+                continue;
+            }
+            int a = raiz(u);
+            int b = raiz(vecinos[i]);
+            if (a < b) {
+                etiquetas[b] = a;
+            } else if (b < a) {
+                etiquetas[a] = b;
+            }
+        }
+    });
+
+    int componentes = 0;
+    for (int u = 0; u < numNodos; u++) {
+        etiquetas[u] = etiquetas[etiquetas[u]];
+        componentes += etiquetas[u] == u;
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+
+    std::cout << "[C++ Core] Componentes conexas: " << componentes << ". Tiempo ejecucion: "
+              << duration.count() << " ms." << std::endl;
+
+    return componentes;
+}
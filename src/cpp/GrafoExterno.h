@@ -0,0 +1,147 @@
+/**
+ * @file GrafoExterno.h
+ * @brief Grafo semiexterno: punteros de fila en memoria y aristas en disco
+ * @author NeuroNet Team
+ *
+ * Para grafos cuyas aristas no caben en RAM. Solo row_ptr (int64) y el
+ * grado de entrada viven en memoria (O(n)); column_indices se lee de un
+ * archivo en disco, mapeado con mmap y consejos de acceso (madvise) o,
+ * si no se puede mapear, con lecturas secuenciales grandes. Los
+ * algoritmos recorren el archivo en orden creciente de fila: el BFS
+ * expande cada nivel con la frontera ordenada por ID y las componentes
+ * conexas se obtienen con una sola pasada secuencial.
+ *
+ * Formato del archivo (.nnext): cabecera, row_ptr (int64, n + 1),
+ * grado de entrada (int32, n) y column_indices (int32, m), cada arreglo
+ * alineado a 64 bytes. Las filas están ordenadas por destino, como en
+ * GrafoDisperso; las aristas no tienen peso.
+ */
+
+#ifndef GRAFO_EXTERNO_H
+#define GRAFO_EXTERNO_H
+
+#include "GrafoBase.h"
+#include <cstdint>
+#include <memory>
+
+class SegmentoCompartido;
+
+/**
+ * @class GrafoExterno
+ * @brief Implementación de GrafoBase que lee las aristas desde disco
+ *
+ * Las consultas son de solo lectura y cada una usa su propio lector, así
+ * que pueden ejecutarse desde varios hilos a la vez.
+ */
+class GrafoExterno : public GrafoBase {
+private:
+    struct LectorColumnas;
+
+    std::vector<int64_t> rowPtr;     ///< numNodos + 1 punteros de fila
+    std::vector<int> gradoEntrada;   ///< Grado de entrada por nodo
+    int numNodos;
+    int64_t numAristas;
+
+    std::string ruta;                ///< Archivo .nnext abierto
+    int64_t offsetColumnas;          ///< Posición de column_indices en el archivo
+    std::unique_ptr<SegmentoCompartido> mapeo; ///< Archivo mapeado (nulo si se lee por bloques)
+
+    /**
+     * @brief Recorre las filas fila(0), ..., fila(cantidad - 1) (IDs crecientes)
+     * @param barrido true si se recorre todo el archivo: las páginas ya
+     *        procesadas se sueltan para no crecer en memoria residente
+     * @param cuerpo Se llama con (nodo, vecinos, cantidad) para cada fila;
+     *        sin mmap, una fila de más de BLOQUE_COLUMNAS llega en varias
+     *        llamadas consecutivas
+     *
+     * Filas cercanas en el archivo se leen en una sola operación y la
+     * siguiente lectura se anticipa al sistema mientras se procesa la
+     * actual, así que una frontera densa se convierte en un barrido
+     * secuencial.
+     */
+    template <typename Fila, typename Cuerpo>
+    void recorrerFilas(int64_t cantidad, Fila fila, bool barrido, LectorColumnas& lector,
+                       Cuerpo cuerpo) const;
+
+    /**
+     * @brief BFS por niveles; opcionalmente recoge las aristas de los niveles < profundidadMaxima
+     */
+    std::vector<std::pair<int, int>> recorrerNiveles(int nodoInicio, int profundidadMaxima,
+                                                     std::vector<std::pair<int, int>>* aristas) const;
+
+    void cerrar();
+
+public:
+    GrafoExterno();
+    ~GrafoExterno() override;
+
+    GrafoExterno(const GrafoExterno&) = delete;
+    GrafoExterno& operator=(const GrafoExterno&) = delete;
+
+    /**
+     * @brief Convierte un Edge List en un archivo .nnext con memoria acotada
+     * @param listaAristas Archivo de texto (NodoOrigen NodoDestino)
+     * @param destino Ruta del archivo .nnext a crear
+     * @param memoriaMaxima Bytes para aristas en memoria durante la conversión
+     * @return false si no se pudo leer la lista o escribir el destino
+     *
+     * Si todas las aristas caben en memoriaMaxima se leen una sola vez; si
+     * no, una primera pasada cuenta los grados y cada pasada siguiente
+     * coloca las filas de un tramo de nodos que cabe en la memoria y lo
+     * escribe de forma secuencial. Además de memoriaMaxima se usan O(n)
+     * bytes para los grados.
+     */
+    static bool convertirListaAristas(const std::string& listaAristas, const std::string& destino,
+                                      size_t memoriaMaxima);
+
+    /**
+     * @brief Abre un archivo .nnext
+     * @param usarMmap false para leer siempre por bloques en lugar de mapear
+     * @return false si el archivo no existe o no es un grafo válido
+     */
+    bool abrir(const std::string& rutaArchivo, bool usarMmap = true);
+
+    // Implementaciones de métodos virtuales de GrafoBase
+
+    /**
+     * Abre un .nnext; si filename es un Edge List, lo convierte antes a
+     * filename + ".nnext" (reutiliza la conversión si ya existe).
+     */
+    bool cargarDatos(const std::string& filename) override;
+    /** Mismos nodos y distancias que GrafoDisperso::BFS; dentro de cada nivel, por ID creciente */
+    std::vector<std::pair<int, int>> BFS(int nodoInicio, int profundidadMaxima) override;
+    /** Mismo orden que GrafoDisperso::DFS; lee las filas con acceso aleatorio */
+    std::vector<int> DFS(int nodoInicio) override;
+    int obtenerGrado(int nodo) override;
+    int obtenerGradoEntrada(int nodo) override;
+    std::vector<int> getVecinos(int nodo) override;
+    int getNumNodos() override;
+    /** Satura en INT_MAX; ver getNumAristas64 */
+    int getNumAristas() override;
+    std::pair<int, int> getNodoMayorGrado() override;
+    /** Memoria propia del proceso; las páginas mapeadas pertenecen a la caché del sistema */
+    size_t getMemoriaUsada() override;
+    std::vector<std::pair<int, int>> getAristasSubgrafo(int nodoInicio, int profundidadMaxima) override;
+
+    int64_t getNumAristas64() const { return numAristas; }
+
+    /**
+     * @brief Componentes conexas (débiles: se ignora la dirección)
+     * @param etiquetas Salida: para cada nodo, el menor ID de su componente
+     * @return Número de componentes
+     *
+     * Union-find sobre los n nodos con una sola pasada secuencial por las aristas.
+     */
+    int componentesConexas(std::vector<int>& etiquetas) const;
+
+    /** Punteros de fila en memoria (numNodos + 1 entradas) */
+    const int64_t* punterosFila() const { return rowPtr.data(); }
+
+    /** Grados de entrada en memoria (numNodos entradas) */
+    const int* gradosEntrada() const { return gradoEntrada.data(); }
+
+    /** true si las aristas se leen de un mapeo del archivo */
+    bool usaMmap() const { return static_cast<bool>(mapeo); }
+};
+
+#endif // GRAFO_EXTERNO_H
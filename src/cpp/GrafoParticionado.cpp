@@ -0,0 +1,688 @@
+/**
+ * @file GrafoParticionado.cpp
+ * @brief Implementación del grafo particionado entre procesos
+ * @author NeuroNet Team
+ *
+ * El esquema 1D es el caso R = 1 de la malla 2D: la columna de procesos
+ * de cada uno es solo él mismo (expandir no comunica nada) y su fila son
+ * todos los procesos.
+ */
+
+#include "GrafoParticionado.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#ifndef _WIN32
+
+namespace {
+
+// Órdenes del coordinador (int64[3]: orden, argumento, reservado)
+const int64_t ORDEN_BFS = 1;     // argumento: nodo inicial
+const int64_t ORDEN_NIVEL = 2;   // argumento: 1 expandir un nivel, 0 terminar y enviar el resultado
+const int64_t ORDEN_FIN = 3;
+
+/**
+ * Dueño de cada nodo y su posición entre los nodos de su dueño. Se
+ * construye antes de crear los trabajadores, que lo comparten por
+ * copia en escritura sin duplicarlo.
+ */
+struct RepartoNodos {
+    std::vector<int> dueno;    ///< Partición de cada nodo
+    std::vector<int> local;    ///< Índice del nodo entre los de su partición (orden de ID)
+    std::vector<int> tamano;   ///< Nodos de cada partición
+    int particiones;
+
+    /** Sin asignación: P tramos contiguos de IDs de tamaño casi igual */
+    RepartoNodos(int nodos, int p, const std::vector<int>& asignacion)
+        : dueno(nodos), local(nodos), tamano(p, 0), particiones(p) {
+        for (int v = 0; v < nodos; v++) {
+            dueno[v] = asignacion.empty() ? static_cast<int>(int64_t(v) * p / nodos) : asignacion[v];
+            local[v] = tamano[dueno[v]]++;
+        }
+    }
+};
+
+bool enviarCompleto(int fd, const void* datos, size_t bytes) {
+    const char* p = static_cast<const char*>(datos);
+    while (bytes > 0) {
+        ssize_t n = send(fd, p, bytes, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        bytes -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+bool recibirCompleto(int fd, void* datos, size_t bytes) {
+    char* p = static_cast<char*>(datos);
+    while (bytes > 0) {
+        ssize_t n = recv(fd, p, bytes, 0);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        bytes -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+/**
+ * Proceso trabajador: guarda las aristas de su bloque de la malla y los
+ * nodos que posee, y ejecuta su parte de cada nivel del BFS
+ */
+class ProcesoParticion {
+public:
+    ProcesoParticion(const VistaCSR& csr, const RepartoNodos& reparto, int yo, int filasMalla,
+                     int coordinador, std::vector<int> sockets)
+        : reparto(reparto), yo(yo), coordinador(coordinador), sockets(std::move(sockets)) {
+        int fila = yo % filasMalla;
+        int columna = yo / filasMalla;
+        distancia.assign(reparto.tamano[yo], -1);
+        for (int i = 0; i < filasMalla; i++) {
+            paresColumna.push_back(columna * filasMalla + i);
+        }
+        for (int b = fila; b < reparto.particiones; b += filasMalla) {
+            paresFila.push_back(b);
+        }
+
+        // Aristas (u, v) con u en la columna de particiones y v en una partición de la fila
+        fuente.assign(csr.numNodos, -1);
+        rowPtr.push_back(0);
+        for (int u = 0; u < csr.numNodos; u++) {
+            if (reparto.dueno[u] / filasMalla != columna) {
+                continue;
+            }
+            fuente[u] = static_cast<int>(rowPtr.size()) - 1;
+            for (int k = csr.rowPtr[u]; k < csr.rowPtr[u + 1]; k++) {
+                int v = csr.columnas[k];
+                if (filasMalla == 1 || reparto.dueno[v] % filasMalla == fila) {
+                    columnas.push_back(v);
+                }
+            }
+            rowPtr.push_back(static_cast<int64_t>(columnas.size()));
+        }
+        salientes.resize(reparto.particiones);
+        enviado.assign(csr.numNodos, false);
+        for (int fd : this->sockets) {
+            if (fd >= 0) {
+                fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+            }
+        }
+    }
+
+    void ejecutar() {
+        int64_t listo[2] = {static_cast<int64_t>(columnas.size()),
+                            static_cast<int64_t>(distancia.size())};
+        if (!enviarCompleto(coordinador, listo, sizeof(listo))) {
+            return;
+        }
+        int64_t orden[3];
+        while (recibirCompleto(coordinador, orden, sizeof(orden))) {
+            if (orden[0] == ORDEN_BFS) {
+                if (!BFS(static_cast<int>(orden[1]))) {
+                    return;
+                }
+            } else {
+                return;
+            }
+        }
+    }
+
+private:
+    const RepartoNodos& reparto;
+    int yo;
+    int coordinador;
+    std::vector<int> sockets;      ///< Socket hacia cada trabajador (-1 para sí mismo)
+    std::vector<int> fuente;       ///< Fila local de cada nodo de la columna (-1 si no es de ella)
+    std::vector<int64_t> rowPtr;   ///< Filas de los nodos de la columna de particiones
+    std::vector<int> columnas;     ///< Destinos (IDs globales)
+    std::vector<int> distancia;    ///< Distancia de los nodos propios (-1 sin visitar)
+    std::vector<int> paresColumna;
+    std::vector<int> paresFila;
+    std::vector<std::vector<int>> salientes;
+    std::vector<bool> enviado;     ///< Destinos remotos ya anotados en este nivel (n bits)
+    int64_t bytes = 0;
+    int64_t mensajes = 0;
+
+    /**
+     * Envía salida[p] a cada compañero p de `pares` y añade a `entrada` lo
+     * que envían ellos. Todos los compañeros intercambian a la vez: las
+     * escrituras y lecturas se multiplexan con poll para que ningún par
+     * quede bloqueado escribiendo mientras el otro también escribe.
+     */
+    bool intercambiar(const std::vector<int>& pares, const std::vector<const std::vector<int>*>& salida,
+                      std::vector<int>& entrada) {
+        struct Canal {
+            int fd;
+            std::vector<char> envio;     // cantidad (int64) + enteros
+            size_t enviados = 0;
+            int64_t cantidad = -1;       // -1 mientras no llega la cabecera
+            char cabecera[sizeof(int64_t)] = {};
+            size_t recibidos = 0;
+            std::vector<int> datos;
+        };
+        std::vector<Canal> canales;
+        for (int p : pares) {
+            if (p == yo) {
+                continue;
+            }
+            Canal canal;
+            canal.fd = sockets[p];
+            int64_t cantidad = static_cast<int64_t>(salida[p]->size());
+            canal.envio.resize(sizeof(int64_t) + cantidad * sizeof(int));
+            std::memcpy(canal.envio.data(), &cantidad, sizeof(int64_t));
+            if (cantidad > 0) {
+                std::memcpy(canal.envio.data() + sizeof(int64_t), salida[p]->data(),
+                            cantidad * sizeof(int));
+            }
+            bytes += static_cast<int64_t>(canal.envio.size());
+            mensajes++;
+            canales.push_back(std::move(canal));
+        }
+
+        auto recibido = [](const Canal& c) {
+            return c.cantidad >= 0 && c.recibidos == static_cast<size_t>(c.cantidad) * sizeof(int);
+        };
+        std::vector<pollfd> sondeo;
+        std::vector<size_t> indice;
+        while (true) {
+            sondeo.clear();
+            indice.clear();
+            for (size_t c = 0; c < canales.size(); c++) {
+                short eventos = 0;
+                if (canales[c].enviados < canales[c].envio.size()) {
+                    eventos |= POLLOUT;
+                }
+                if (!recibido(canales[c])) {
+                    eventos |= POLLIN;
+                }
+                if (eventos != 0) {
+                    sondeo.push_back({canales[c].fd, eventos, 0});
+                    indice.push_back(c);
+                }
+            }
+            if (sondeo.empty()) {
+                break;
+            }
+            if (poll(sondeo.data(), sondeo.size(), -1) < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            for (size_t s = 0; s < sondeo.size(); s++) {
+                Canal& canal = canales[indice[s]];
+                short listos = sondeo[s].revents;
+                if (listos & POLLOUT) {
+                    ssize_t n = send(canal.fd, canal.envio.data() + canal.enviados,
+                                     canal.envio.size() - canal.enviados, MSG_NOSIGNAL | MSG_DONTWAIT);
+                    if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                        return false;
+                    }
+                    canal.enviados += n > 0 ? static_cast<size_t>(n) : 0;
+                }
+                if (listos & (POLLIN | POLLHUP | POLLERR)) {
+                    char* destino;
+                    size_t faltan;
+                    if (canal.cantidad < 0) {
+                        destino = canal.cabecera + canal.recibidos;
+                        faltan = sizeof(int64_t) - canal.recibidos;
+                    } else {
+                        destino = reinterpret_cast<char*>(canal.datos.data()) + canal.recibidos;
+                        faltan = canal.datos.size() * sizeof(int) - canal.recibidos;
+                    }
+                    ssize_t n = recv(canal.fd, destino, faltan, MSG_DONTWAIT);
+                    if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+                        return false;
+                    }
+                    canal.recibidos += n > 0 ? static_cast<size_t>(n) : 0;
+                    if (canal.cantidad < 0 && canal.recibidos == sizeof(int64_t)) {
+                        std::memcpy(&canal.cantidad, canal.cabecera, sizeof(int64_t));
+                        canal.datos.resize(canal.cantidad);
+                        canal.recibidos = 0;
+                    }
+                }
+            }
+        }
+        for (const Canal& canal : canales) {
+            entrada.insert(entrada.end(), canal.datos.begin(), canal.datos.end());
+        }
+        return true;
+    }
+
+    bool BFS(int nodoInicio) {
+        std::fill(distancia.begin(), distancia.end(), -1);
+        std::vector<int> frontera;
+        std::vector<int> fuentes;
+        std::vector<int> candidatos;
+        std::vector<int> resultado;   // pares (nodo, distancia) aplanados
+        bytes = 0;
+        mensajes = 0;
+        if (reparto.dueno[nodoInicio] == yo) {
+            distancia[reparto.local[nodoInicio]] = 0;
+            frontera.push_back(nodoInicio);
+            resultado.insert(resultado.end(), {nodoInicio, 0});
+        }
+
+        std::vector<const std::vector<int>*> salida(reparto.particiones, &frontera);
+        int64_t orden[3];
+        for (int nivel = 0;; nivel++) {
+            if (!recibirCompleto(coordinador, orden, sizeof(orden)) || orden[0] != ORDEN_NIVEL) {
+                return false;
+            }
+            if (orden[1] == 0) {
+                break;
+            }
+
+            // Expandir: la frontera de toda la columna de bloques
+            fuentes.assign(frontera.begin(), frontera.end());
+            std::fill(salida.begin(), salida.end(), &frontera);
+            if (!intercambiar(paresColumna, salida, fuentes)) {
+                return false;
+            }
+
+            // Destinos de las aristas locales: los propios se marcan en el
+            // acto y los remotos se anotan una sola vez por nivel
+            frontera.clear();
+            auto marcar = [&](int v) {
+                int& d = distancia[reparto.local[v]];
+                if (d < 0) {
+                    d = nivel + 1;
+                    frontera.push_back(v);
+                    resultado.insert(resultado.end(), {v, nivel + 1});
+                }
+            };
+            for (int p : paresFila) {
+                salientes[p].clear();
+            }
+            for (int u : fuentes) {
+                for (int64_t k = rowPtr[fuente[u]]; k < rowPtr[fuente[u] + 1]; k++) {
+                    int v = columnas[k];
+                    int dueno = reparto.dueno[v];
+                    if (dueno == yo) {
+                        marcar(v);
+                    } else if (!enviado[v]) {
+                        enviado[v] = true;
+                        salientes[dueno].push_back(v);
+                    }
+                }
+            }
+            for (int p : paresFila) {
+                for (int v : salientes[p]) {
+                    enviado[v] = false;
+                }
+                salida[p] = &salientes[p];
+            }
+
+            // Plegar: cada destino remoto llega a su dueño por la fila de procesos
+            candidatos.clear();
+            if (!intercambiar(paresFila, salida, candidatos)) {
+                return false;
+            }
+            for (int v : candidatos) {
+                marcar(v);
+            }
+            int64_t tamano = static_cast<int64_t>(frontera.size());
+            if (!enviarCompleto(coordinador, &tamano, sizeof(tamano))) {
+                return false;
+            }
+        }
+
+        int64_t cabecera[3] = {static_cast<int64_t>(resultado.size() / 2), bytes, mensajes};
+        return enviarCompleto(coordinador, cabecera, sizeof(cabecera)) &&
+               enviarCompleto(coordinador, resultado.data(), resultado.size() * sizeof(int));
+    }
+};
+
+/**
+ * Par de sockets que no sobrevive a un exec: si el proceso padre lanza
+ * otros programas mientras los trabajadores viven, no heredan la malla.
+ */
+bool crearParSockets(int par[2]) {
+#ifdef SOCK_CLOEXEC
+    return socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, par) == 0;
+#else
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, par) != 0) {
+        return false;
+    }
+    fcntl(par[0], F_SETFD, FD_CLOEXEC);
+    fcntl(par[1], F_SETFD, FD_CLOEXEC);
+    return true;
+#endif
+}
+
+/**
+ * En un trabajador recién creado: cierra todos los descriptores heredados
+ * (ficheros y sockets del intérprete, trabajadores de otros grafos) salvo
+ * la entrada y salida estándar y `propios`.
+ */
+void cerrarDescriptoresAjenos(const std::vector<int>& propios) {
+    auto esPropio = [&propios](int fd) {
+        return fd <= STDERR_FILENO || std::find(propios.begin(), propios.end(), fd) != propios.end();
+    };
+#ifdef __linux__
+    if (DIR* directorio = opendir("/proc/self/fd")) {
+        std::vector<int> abiertos;
+        while (dirent* entrada = readdir(directorio)) {
+            if (entrada->d_name[0] != '.') {
+                abiertos.push_back(std::atoi(entrada->d_name));
+            }
+        }
+        closedir(directorio);   // su descriptor figura en la lista: cerrarlo otra vez es inocuo
+        for (int fd : abiertos) {
+            if (!esPropio(fd)) {
+                close(fd);
+            }
+        }
+        return;
+    }
+#endif
+    long limite = sysconf(_SC_OPEN_MAX);
+    if (limite < 0 || limite > 65536) {
+        limite = 65536;
+    }
+    for (int fd = STDERR_FILENO + 1; fd < limite; fd++) {
+        if (!esPropio(fd)) {
+            close(fd);
+        }
+    }
+}
+
+} // namespace
+
+#endif
+
+GrafoParticionado::~GrafoParticionado() {
+    detener();
+}
+
+#ifdef _WIN32
+
+bool GrafoParticionado::iniciar(const GrafoDisperso&, int, EsquemaParticion, const std::vector<int>&) {
+    std::cerr << "[C++ Core] Error: El grafo particionado requiere un sistema POSIX." << std::endl;
+    return false;
+}
+
+std::vector<std::pair<int, int>> GrafoParticionado::BFS(int, int) {
+    return {};
+}
+
+void GrafoParticionado::detener() {}
+
+bool GrafoParticionado::enviarATodos(const int64_t*, int) {
+    return false;
+}
+
+bool GrafoParticionado::recibirDeTodos(int64_t*, int) {
+    return false;
+}
+
+#else
+
+bool GrafoParticionado::iniciar(const GrafoDisperso& grafo, int particiones, EsquemaParticion esquema,
+                                const std::vector<int>& asignacion) {
+    detener();
+    VistaCSR csr = grafo.vistaCSR();
+    if (particiones < 1 || particiones > csr.numNodos) {
+        std::cerr << "[C++ Core] Error: Numero de particiones invalido (debe estar entre 1 y el "
+                  << "numero de nodos)." << std::endl;
+        return false;
+    }
+    if (!asignacion.empty()) {
+        bool valida = static_cast<int64_t>(asignacion.size()) == csr.numNodos;
+        for (size_t v = 0; valida && v < asignacion.size(); v++) {
+            valida = asignacion[v] >= 0 && asignacion[v] < particiones;
+        }
+        if (!valida) {
+            std::cerr << "[C++ Core] Error: La asignacion debe dar a cada nodo una particion entre 0 y "
+                      << particiones - 1 << "." << std::endl;
+            return false;
+        }
+    }
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Malla R x C lo más cuadrada posible (R = 1 en 1D)
+    filas = 1;
+    if (esquema == EsquemaParticion::Bloques2D) {
+        for (int r = 1; r * r <= particiones; r++) {
+            if (particiones % r == 0) {
+                filas = r;
+            }
+        }
+    }
+    columnas = particiones / filas;
+    numNodos = csr.numNodos;
+    RepartoNodos reparto(numNodos, particiones, asignacion);
+
+    // Un socketpair con el coordinador por trabajador y uno por cada par de trabajadores
+    std::vector<int> extremoCoordinador(particiones, -1);
+    std::vector<int> extremoTrabajador(particiones, -1);
+    std::vector<std::vector<int>> malla(particiones, std::vector<int>(particiones, -1));
+    auto cerrarTodo = [&]() {
+        for (int p = 0; p < particiones; p++) {
+            for (int fd : {extremoCoordinador[p], extremoTrabajador[p]}) {
+                if (fd >= 0) {
+                    close(fd);
+                }
+            }
+            for (int fd : malla[p]) {
+                if (fd >= 0) {
+                    close(fd);
+                }
+            }
+        }
+    };
+    bool creados = true;
+    for (int p = 0; p < particiones && creados; p++) {
+        int par[2];
+        creados = crearParSockets(par);
+        if (creados) {
+            extremoCoordinador[p] = par[0];
+            extremoTrabajador[p] = par[1];
+        }
+        for (int q = p + 1; q < particiones && creados; q++) {
+            creados = crearParSockets(par);
+            if (creados) {
+                malla[p][q] = par[0];
+                malla[q][p] = par[1];
+            }
+        }
+    }
+    if (!creados) {
+        std::cerr << "[C++ Core] Error: No se pudieron crear los sockets de las particiones ("
+                  << std::strerror(errno) << ")." << std::endl;
+        cerrarTodo();
+        return false;
+    }
+
+    // Lo pendiente en los búferes de salida se imprimiría una vez por proceso
+    std::cout.flush();
+    std::cerr.flush();
+    std::fflush(nullptr);
+
+    for (int p = 0; p < particiones; p++) {
+        pid_t pid = fork();
+        if (pid < 0) {
+            std::cerr << "[C++ Core] Error: No se pudo crear el proceso de la particion " << p
+                      << " (" << std::strerror(errno) << ")." << std::endl;
+            cerrarTodo();
+            detener();
+            return false;
+        }
+        if (pid == 0) {
+            // Trabajador: conserva solo sus extremos. Nunca vuelve al
+            // llamador (ni a Python): termina con _exit
+            std::vector<int> propios = malla[p];
+            propios.push_back(extremoTrabajador[p]);
+            cerrarDescriptoresAjenos(propios);
+            propios.pop_back();
+            {
+                ProcesoParticion proceso(csr, reparto, p, filas, extremoTrabajador[p], propios);
+                proceso.ejecutar();
+            }
+            _exit(0);
+        }
+        trabajadores.push_back({static_cast<long>(pid), extremoCoordinador[p]});
+        extremoCoordinador[p] = -1;
+    }
+    for (int p = 0; p < particiones; p++) {
+        close(extremoTrabajador[p]);
+        extremoTrabajador[p] = -1;
+    }
+    cerrarTodo();
+
+    std::vector<int64_t> listos(2 * particiones);
+    if (!recibirDeTodos(listos.data(), 2)) {
+        std::cerr << "[C++ Core] Error: Algun trabajador no pudo cargar su particion." << std::endl;
+        detener();
+        return false;
+    }
+    aristasLocales.resize(particiones);
+    nodosPropios.resize(particiones);
+    for (int p = 0; p < particiones; p++) {
+        aristasLocales[p] = listos[2 * p];
+        nodosPropios[p] = listos[2 * p + 1];
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+
+    auto extremos = std::minmax_element(aristasLocales.begin(), aristasLocales.end());
+    std::cout << "[C++ Core] Grafo particionado en " << particiones << " procesos ("
+              << (esquema == EsquemaParticion::Bloques2D ? "2D " : "1D ") << filas << "x" << columnas
+              << "). Aristas por particion: " << *extremos.first << " - " << *extremos.second
+              << ". Tiempo ejecucion: " << duration.count() << " ms." << std::endl;
+
+    return true;
+}
+
+bool GrafoParticionado::enviarATodos(const int64_t* orden, int cantidad) {
+    for (const Trabajador& t : trabajadores) {
+        if (!enviarCompleto(t.socket, orden, cantidad * sizeof(int64_t))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool GrafoParticionado::recibirDeTodos(int64_t* valores, int porTrabajador) {
+    for (size_t p = 0; p < trabajadores.size(); p++) {
+        if (!recibirCompleto(trabajadores[p].socket, valores + p * porTrabajador,
+                             porTrabajador * sizeof(int64_t))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<std::pair<int, int>> GrafoParticionado::BFS(int nodoInicio, int profundidadMaxima) {
+    std::cout << "[C++ Core] Ejecutando BFS particionado desde nodo " << nodoInicio
+              << " con profundidad maxima " << profundidadMaxima << "..." << std::endl;
+
+    std::vector<std::pair<int, int>> resultado;
+    if (!estaActivo()) {
+        std::cerr << "[C++ Core] Error: El grafo particionado no tiene trabajadores activos." << std::endl;
+        return resultado;
+    }
+    if (nodoInicio < 0 || nodoInicio >= numNodos) {
+        std::cerr << "[C++ Core] Error: Nodo de inicio invalido." << std::endl;
+        return resultado;
+    }
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    ultimoBFS = EstadisticasBFSParticionado();
+
+    // Los trabajadores expanden un nivel por orden; el coordinador suma
+    // las fronteras nuevas y decide si hay otro
+    const int64_t orden[3] = {ORDEN_BFS, nodoInicio, 0};
+    const int64_t expandir[3] = {ORDEN_NIVEL, 1, 0};
+    const int64_t terminar[3] = {ORDEN_NIVEL, 0, 0};
+    std::vector<int64_t> tamanos(trabajadores.size());
+    bool ok = enviarATodos(orden, 3);
+    int64_t frontera = 1;
+    while (ok && ultimoBFS.niveles < profundidadMaxima && frontera > 0) {
+        ok = enviarATodos(expandir, 3) && recibirDeTodos(tamanos.data(), 1);
+        frontera = 0;
+        for (int64_t t : tamanos) {
+            frontera += t;
+        }
+        ultimoBFS.niveles++;
+    }
+    ok = ok && enviarATodos(terminar, 3);
+
+    std::vector<int> pares;
+    for (size_t p = 0; ok && p < trabajadores.size(); p++) {
+        int64_t cabecera[3];
+        ok = recibirCompleto(trabajadores[p].socket, cabecera, sizeof(cabecera));
+        if (ok) {
+            pares.resize(2 * cabecera[0]);
+            ok = recibirCompleto(trabajadores[p].socket, pares.data(), pares.size() * sizeof(int));
+            for (size_t k = 0; ok && k < pares.size(); k += 2) {
+                resultado.emplace_back(pares[k], pares[k + 1]);
+            }
+            ultimoBFS.bytesIntercambiados += cabecera[1];
+            ultimoBFS.mensajes += cabecera[2];
+        }
+    }
+    if (!ok) {
+        std::cerr << "[C++ Core] Error: Se perdio la comunicacion con un trabajador." << std::endl;
+        detener();
+        return {};
+    }
+
+    std::sort(resultado.begin(), resultado.end(), [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+        return a.second != b.second ? a.second < b.second : a.first < b.first;
+    });
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+    ultimoBFS.segundos = duration.count() / 1e6;
+
+    std::cout << "[C++ Core] BFS particionado completado. Nodos encontrados: " << resultado.size()
+              << " | Niveles: " << ultimoBFS.niveles << " | Intercambiado: "
+              << ultimoBFS.bytesIntercambiados / (1024.0 * 1024.0) << " MB. Tiempo ejecucion: "
+              << duration.count() / 1000.0 << " ms." << std::endl;
+
+    return resultado;
+}
+
+void GrafoParticionado::detener() {
+    const int64_t fin[3] = {ORDEN_FIN, 0, 0};
+    for (const Trabajador& t : trabajadores) {
+        if (t.socket >= 0) {
+            enviarCompleto(t.socket, fin, sizeof(fin));
+            close(t.socket);
+        }
+    }
+    for (const Trabajador& t : trabajadores) {
+        waitpid(static_cast<pid_t>(t.pid), nullptr, 0);
+    }
+    trabajadores.clear();
+    aristasLocales.clear();
+    nodosPropios.clear();
+}
+
+#endif
@@ -0,0 +1,124 @@
+/**
+ * @file GrafoParticionado.h
+ * @brief Grafo repartido entre procesos con BFS distribuido por niveles
+ * @author NeuroNet Team
+ *
+ * Cada partición vive en un proceso trabajador propio (creado con fork),
+ * así que el recorrido usa el ancho de banda de memoria de varios
+ * procesos en lugar del de uno solo. Los trabajadores se comunican por
+ * sockets de dominio Unix: cada par de trabajadores comparte un
+ * socketpair y el proceso que crea el grafo coordina los niveles.
+ *
+ * Las particiones son tramos contiguos de IDs o una asignación de nodos
+ * dada (ParticionadorGrafo). Esquemas (P particiones):
+ * - Filas1D: el proceso k posee los nodos de la partición k y todas sus
+ *   aristas de salida. Un nivel del BFS expande la frontera local y
+ *   envía cada destino remoto a su dueño (intercambio entre todos).
+ * - Bloques2D: malla de R x C procesos; la partición k corresponde al
+ *   proceso (k mod R, k / R). El proceso (i, j) guarda las aristas
+ *   (u, v) con u en una partición de la columna j y v en una de la
+ *   fila i. Un nivel reparte la frontera por la columna de procesos
+ *   (expandir) y entrega los destinos por la fila (plegar): cada proceso
+ *   solo habla con R + C - 2 compañeros en lugar de P - 1.
+ *
+ * Solo disponible en sistemas POSIX.
+ */
+
+#ifndef GRAFO_PARTICIONADO_H
+#define GRAFO_PARTICIONADO_H
+
+#include "GrafoDisperso.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @enum EsquemaParticion
+ * @brief Cómo se reparten nodos y aristas entre los procesos
+ */
+enum class EsquemaParticion {
+    Filas1D = 0,     ///< Tramos de nodos con sus aristas de salida
+    Bloques2D = 1    ///< Bloques de la matriz de adyacencia en una malla R x C
+};
+
+/**
+ * @struct EstadisticasBFSParticionado
+ * @brief Coste de comunicación del último BFS distribuido
+ */
+struct EstadisticasBFSParticionado {
+    int niveles = 0;                  ///< Niveles expandidos
+    int64_t bytesIntercambiados = 0;  ///< Bytes enviados entre trabajadores
+    int64_t mensajes = 0;             ///< Mensajes entre trabajadores
+    double segundos = 0.0;
+};
+
+/**
+ * @class GrafoParticionado
+ * @brief Coordinador de los procesos que guardan las particiones
+ *
+ * Los trabajadores copian su partición del grafo de origen al arrancar;
+ * después el grafo de origen puede modificarse o destruirse. Los
+ * trabajadores terminan con detener() o al destruir el coordinador (y,
+ * si el coordinador muere, al cerrarse su socket).
+ */
+class GrafoParticionado {
+public:
+    GrafoParticionado() = default;
+    ~GrafoParticionado();
+
+    GrafoParticionado(const GrafoParticionado&) = delete;
+    GrafoParticionado& operator=(const GrafoParticionado&) = delete;
+
+    /**
+     * @brief Reparte el grafo y arranca un proceso por partición
+     * @param particiones Número de procesos (2D: se usa la malla R x C más cuadrada)
+     * @param asignacion Partición de cada nodo (por ejemplo, de ParticionadorGrafo);
+     *        vacía para repartir tramos contiguos de IDs
+     * @return false si los parámetros son inválidos o no se pudo crear algún proceso
+     */
+    bool iniciar(const GrafoDisperso& grafo, int particiones, EsquemaParticion esquema,
+                 const std::vector<int>& asignacion = {});
+
+    /**
+     * @brief BFS distribuido por niveles
+     * @return Pares (nodo, distancia) ordenados por distancia y, dentro de
+     *         cada nivel, por ID: los mismos que GrafoDisperso::BFS
+     */
+    std::vector<std::pair<int, int>> BFS(int nodoInicio, int profundidadMaxima);
+
+    /** Termina los trabajadores (idempotente) */
+    void detener();
+
+    bool estaActivo() const { return !trabajadores.empty(); }
+    int getNumParticiones() const { return static_cast<int>(trabajadores.size()); }
+    int getNumNodos() const { return numNodos; }
+    int filasMalla() const { return filas; }
+    int columnasMalla() const { return columnas; }
+
+    /** Aristas guardadas por cada trabajador */
+    const std::vector<int64_t>& aristasPorParticion() const { return aristasLocales; }
+
+    /** Nodos que posee cada trabajador */
+    const std::vector<int64_t>& nodosPorParticion() const { return nodosPropios; }
+
+    const EstadisticasBFSParticionado& estadisticasUltimoBFS() const { return ultimoBFS; }
+
+private:
+    struct Trabajador {
+        long pid;
+        int socket;     ///< Extremo del coordinador
+    };
+
+    std::vector<Trabajador> trabajadores;
+    std::vector<int64_t> aristasLocales;
+    std::vector<int64_t> nodosPropios;
+    EstadisticasBFSParticionado ultimoBFS;
+    int numNodos = 0;
+    int filas = 1;
+    int columnas = 1;
+
+    bool enviarATodos(const int64_t* orden, int cantidad);
+    bool recibirDeTodos(int64_t* valores, int porTrabajador);
+};
+
+#endif // GRAFO_PARTICIONADO_H
@@ -0,0 +1,189 @@
+/**
+ * @file LecturaAristas.cpp
+ * @brief Implementación de la lectura por bloques de Edge Lists
+ * @author NeuroNet Team
+ */
+
+#include "LecturaAristas.h"
+#include "Paralelo.h"
+#include "Trabajos.h"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstring>
+#include <fstream>
+
+namespace {
+
+// Bytes leídos del archivo por bloque y bytes por fragmento de análisis paralelo
+const size_t BLOQUE_LECTURA = size_t(64) << 20;
+const int64_t FRAGMENTO_ANALISIS = int64_t(1) << 20;
+
+bool esEspacio(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/**
+ * Lee un entero con las mismas reglas que `istream >> int`: espacios
+ * iniciales, signo opcional, al menos un dígito, y falla si desborda
+ */
+bool leerEntero(const char*& c, const char* fin, int& valor) {
+    while (c < fin && esEspacio(*c)) {
+        c++;
+    }
+    bool negativo = false;
+    if (c < fin && (*c == '-' || *c == '+')) {
+        negativo = *c == '-';
+        c++;
+    }
+    if (c == fin || *c < '0' || *c > '9') {
+        return false;
+    }
+    int64_t acumulado = 0;
+    const int64_t limite = negativo ? -static_cast<int64_t>(INT_MIN) : INT_MAX;
+    while (c < fin && *c >= '0' && *c <= '9') {
+        acumulado = acumulado * 10 + (*c - '0');
+        if (acumulado > limite) {
+            return false;
+        }
+        c++;
+    }
+    valor = static_cast<int>(negativo ? -acumulado : acumulado);
+    return true;
+}
+
+/**
+ * Analiza las líneas que empiezan en [inicio, limite); la última puede
+ * continuar hasta `fin`. Se ignoran líneas vacías, comentarios (#) y
+ * líneas sin dos enteros, igual que la lectura línea a línea.
+ */
+void analizarLineas(const char* inicio, const char* limite, const char* fin,
+                    ListaAristas& aristas, int& maxNodo) {
+    const char* p = inicio;
+    while (p < limite) {
+        const char* finLinea = static_cast<const char*>(std::memchr(p, '\n', fin - p));
+        if (finLinea == nullptr) {
+            finLinea = fin;
+        }
+        if (finLinea != p && *p != '#') {
+            const char* c = p;
+            int origen, destino;
+            if (leerEntero(c, finLinea, origen) && leerEntero(c, finLinea, destino)) {
+                aristas.emplace_back(origen, destino);
+                maxNodo = std::max(maxNodo, std::max(origen, destino));
+            }
+        }
+        p = finLinea + 1;
+    }
+}
+
+/**
+ * Analiza en paralelo un bloque de líneas completas y añade sus aristas
+ * en el orden del archivo. Devuelve false si se canceló.
+ */
+bool analizarBloque(const char* datos, size_t longitud, ListaAristas& aristas,
+                    int& maxNodo, ControlTrabajo* control) {
+    int64_t total = static_cast<int64_t>(longitud);
+    int64_t numFragmentos = (total + FRAGMENTO_ANALISIS - 1) / FRAGMENTO_ANALISIS;
+    std::vector<ListaAristas> porFragmento(numFragmentos);
+    std::vector<int> maxPorFragmento(numFragmentos, 0);
+    std::atomic<bool> cancelado(false);
+    
+    paraleloPara(numFragmentos, 1, [&](int64_t desde, int64_t hasta, int) {
+        for (int64_t f = desde; f < hasta; f++) {
+            if (control != nullptr && control->estaCancelado()) {
+                cancelado.store(true);
+                return;
+            }
+            // Cada fragmento procesa las líneas que empiezan en su tramo
+            const char* inicio = datos + f * FRAGMENTO_ANALISIS;
+            const char* limite = datos + std::min(total, (f + 1) * FRAGMENTO_ANALISIS);
+            if (f > 0) {
+                while (inicio < limite && inicio[-1] != '\n') {
+                    inicio++;
+                }
+            }
+            analizarLineas(inicio, limite, datos + total, porFragmento[f], maxPorFragmento[f]);
+        }
+    }, "GrafoDisperso::cargarDatos");
+    
+    if (cancelado.load()) {
+        return false;
+    }
+    
+    size_t nuevas = 0;
+    for (const auto& parcial : porFragmento) {
+        nuevas += parcial.size();
+    }
+    aristas.reserve(aristas.size() + nuevas);
+    for (int64_t f = 0; f < numFragmentos; f++) {
+        aristas.insert(aristas.end(), porFragmento[f].begin(), porFragmento[f].end());
+        ListaAristas().swap(porFragmento[f]);
+        maxNodo = std::max(maxNodo, maxPorFragmento[f]);
+    }
+    return true;
+}
+
+} // namespace
+
+ResultadoLectura leerListaAristas(
+    const std::string& archivo, ListaAristas& aristas, int& maxNodo, ControlTrabajo* control,
+    const std::function<void(ListaAristas&)>& trasBloque) {
+    std::ifstream file(archivo, std::ios::binary);
+    if (!file.is_open()) {
+        return ResultadoLectura::NoEncontrado;
+    }
+    
+    file.seekg(0, std::ios::end);
+    int64_t bytesTotales = static_cast<int64_t>(file.tellg());
+    file.seekg(0, std::ios::beg);
+    if (control != nullptr) {
+        control->reportar(0, bytesTotales);
+    }
+    
+    // Lectura por bloques grandes; cada bloque (hasta su último salto de
+    // línea) se analiza en paralelo y la línea incompleta pasa al siguiente
+    std::vector<char> buffer;
+    size_t arrastre = 0;
+    int64_t bytesLeidos = 0;
+    
+    while (true) {
+        int64_t restantes = bytesTotales - bytesLeidos - static_cast<int64_t>(arrastre);
+        // +1: la lectura que alcanza el final del archivo se queda corta y lo detecta
+        size_t pedidos = bytesTotales > 0
+            ? static_cast<size_t>(std::min<int64_t>(BLOQUE_LECTURA, std::max<int64_t>(restantes, 0) + 1))
+            : BLOQUE_LECTURA;
+        buffer.resize(arrastre + pedidos);
+        file.read(buffer.data() + arrastre, pedidos);
+        size_t disponibles = arrastre + static_cast<size_t>(file.gcount());
+        bool finArchivo = static_cast<size_t>(file.gcount()) < pedidos;
+        
+        size_t corte = disponibles;
+        if (!finArchivo) {
+            while (corte > 0 && buffer[corte - 1] != '\n') {
+                corte--;
+            }
+        }
+        if (corte > 0) {
+            if (!analizarBloque(buffer.data(), corte, aristas, maxNodo, control)) {
+                return ResultadoLectura::Cancelada;
+            }
+            if (trasBloque) {
+                trasBloque(aristas);
+            }
+            bytesLeidos += static_cast<int64_t>(corte);
+            if (control != nullptr) {
+                control->reportar(bytesLeidos, bytesTotales);
+            }
+        }
+        if (finArchivo) {
+            break;
+        }
+        
+        // Línea incompleta (o más larga que el bloque): al inicio del siguiente
+        std::copy(buffer.begin() + corte, buffer.begin() + disponibles, buffer.begin());
+        arrastre = disponibles - corte;
+    }
+    
+    return ResultadoLectura::Completa;
+}
@@ -0,0 +1,53 @@
+/**
+ * @file LecturaAristas.h
+ * @brief Lectura por bloques de archivos Edge List
+ * @author NeuroNet Team
+ *
+ * El archivo se lee en bloques grandes y cada bloque se analiza en
+ * paralelo. Quien lee decide qué hacer con las aristas de cada bloque:
+ * GrafoDisperso las acumula todas para construir el CSR en memoria y
+ * GrafoExterno las consume bloque a bloque sin retenerlas.
+ */
+
+#ifndef LECTURA_ARISTAS_H
+#define LECTURA_ARISTAS_H
+
+#include "ContabilidadMemoria.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+class ControlTrabajo;
+
+/** Aristas leídas (origen, destino); su memoria cuenta como temporal */
+using ListaAristas = VectorTemporal<std::pair<int, int>>;
+
+/**
+ * @enum ResultadoLectura
+ * @brief Cómo terminó una lectura de Edge List
+ */
+enum class ResultadoLectura {
+    Completa,       ///< Se leyó el archivo entero
+    NoEncontrado,   ///< No se pudo abrir el archivo
+    Cancelada       ///< El control de trabajo pidió cancelar
+};
+
+/**
+ * @brief Lee un Edge List añadiendo sus aristas en el orden del archivo
+ * @param archivo Ruta del archivo (NodoOrigen NodoDestino por línea)
+ * @param aristas Destino de las aristas leídas
+ * @param maxNodo Mayor ID visto (se actualiza; el llamador fija el valor inicial)
+ * @param control Token de cancelación y progreso en bytes (puede ser nulo)
+ * @param trasBloque Se llama tras añadir las aristas de cada bloque; puede
+ *        consumirlas y vaciar el vector para que la memoria no crezca
+ * @return Completa, NoEncontrado o Cancelada
+ *
+ * Se ignoran líneas vacías, comentarios (#) y líneas sin dos enteros.
+ */
+ResultadoLectura leerListaAristas(
+    const std::string& archivo, ListaAristas& aristas, int& maxNodo, ControlTrabajo* control,
+    const std::function<void(ListaAristas&)>& trasBloque = nullptr);
+
+#endif // LECTURA_ARISTAS_H
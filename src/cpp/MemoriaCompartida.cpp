@@ -0,0 +1,217 @@
+/**
+ * @file MemoriaCompartida.cpp
+ * @brief Implementación de los segmentos compartidos (POSIX y Windows)
+ * @author NeuroNet Team
+ */
+
+#include "MemoriaCompartida.h"
+#include <cstdint>
+#include <iostream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+#ifdef _WIN32
+// Los objetos de mapeo con nombre viven en el espacio de la sesión
+std::string nombreSistema(const std::string& nombre) {
+    std::string base = nombre;
+    while (!base.empty() && base[0] == '/') {
+        base.erase(0, 1);
+    }
+    return "Local\\" + base;
+}
+#else
+// shm_open exige un único '/' inicial
+std::string nombreSistema(const std::string& nombre) {
+    return nombre.empty() || nombre[0] != '/' ? "/" + nombre : nombre;
+}
+#endif
+
+} // namespace
+
+#ifdef _WIN32
+
+std::unique_ptr<SegmentoCompartido> SegmentoCompartido::crear(const std::string& nombre,
+                                                              size_t bytes, bool enArchivo) {
+    std::unique_ptr<SegmentoCompartido> segmento(new SegmentoCompartido());
+    segmento->nombreSegmento = nombre;
+    segmento->bytes = bytes;
+    segmento->escribible = true;
+    segmento->enArchivo = enArchivo;
+
+    HANDLE archivo = INVALID_HANDLE_VALUE;
+    if (enArchivo) {
+        archivo = CreateFileA(nombre.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ,
+                              nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (archivo == INVALID_HANDLE_VALUE) {
+            std::cerr << "[C++ Core] Error: No se pudo crear " << nombre << std::endl;
+            return nullptr;
+        }
+        segmento->archivo = archivo;
+    }
+    uint64_t tamano = static_cast<uint64_t>(bytes);
+    HANDLE mapeo = CreateFileMappingA(archivo, nullptr, PAGE_READWRITE,
+                                      static_cast<DWORD>(tamano >> 32),
+                                      static_cast<DWORD>(tamano & 0xFFFFFFFFu),
+                                      enArchivo ? nullptr : nombreSistema(nombre).c_str());
+    if (mapeo == nullptr || (!enArchivo && GetLastError() == ERROR_ALREADY_EXISTS)) {
+        std::cerr << "[C++ Core] Error: No se pudo crear el segmento " << nombre << std::endl;
+        if (mapeo != nullptr) {
+            CloseHandle(mapeo);
+        }
+        return nullptr;
+    }
+    segmento->mapeo = mapeo;
+    segmento->direccion = MapViewOfFile(mapeo, FILE_MAP_ALL_ACCESS, 0, 0, bytes);
+    if (segmento->direccion == nullptr) {
+        std::cerr << "[C++ Core] Error: No se pudo mapear " << nombre << std::endl;
+        return nullptr;
+    }
+    return segmento;
+}
+
+std::unique_ptr<SegmentoCompartido> SegmentoCompartido::abrir(const std::string& nombre,
+                                                              bool enArchivo) {
+    std::unique_ptr<SegmentoCompartido> segmento(new SegmentoCompartido());
+    segmento->nombreSegmento = nombre;
+    segmento->enArchivo = enArchivo;
+
+    HANDLE mapeo = nullptr;
+    if (enArchivo) {
+        HANDLE archivo = CreateFileA(nombre.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                     OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (archivo == INVALID_HANDLE_VALUE) {
+            return nullptr;
+        }
+        segmento->archivo = archivo;
+        LARGE_INTEGER tamano;
+        GetFileSizeEx(archivo, &tamano);
+        segmento->bytes = static_cast<size_t>(tamano.QuadPart);
+        mapeo = CreateFileMappingA(archivo, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    } else {
+        mapeo = OpenFileMappingA(FILE_MAP_READ, FALSE, nombreSistema(nombre).c_str());
+    }
+    if (mapeo == nullptr) {
+        return nullptr;
+    }
+    segmento->mapeo = mapeo;
+    segmento->direccion = MapViewOfFile(mapeo, FILE_MAP_READ, 0, 0, 0);
+    if (segmento->direccion == nullptr) {
+        return nullptr;
+    }
+    if (!enArchivo) {
+        MEMORY_BASIC_INFORMATION info;
+        VirtualQuery(segmento->direccion, &info, sizeof(info));
+        segmento->bytes = info.RegionSize;
+    }
+    return segmento;
+}
+
+bool SegmentoCompartido::eliminar(const std::string& nombre) {
+    // El objeto de mapeo desaparece al cerrarse su último handle
+    (void)nombre;
+    return false;
+}
+
+SegmentoCompartido::~SegmentoCompartido() {
+    if (direccion != nullptr) {
+        UnmapViewOfFile(direccion);
+    }
+    if (mapeo != nullptr) {
+        CloseHandle(static_cast<HANDLE>(mapeo));
+    }
+    if (archivo != nullptr) {
+        CloseHandle(static_cast<HANDLE>(archivo));
+    }
+}
+
+#else
+
+std::unique_ptr<SegmentoCompartido> SegmentoCompartido::crear(const std::string& nombre,
+                                                              size_t bytes, bool enArchivo) {
+    int fd = enArchivo ? open(nombre.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644)
+                       : shm_open(nombreSistema(nombre).c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) {
+        std::cerr << "[C++ Core] Error: No se pudo crear el segmento " << nombre << " ("
+                  << std::strerror(errno) << ")." << std::endl;
+        return nullptr;
+    }
+
+    std::unique_ptr<SegmentoCompartido> segmento(new SegmentoCompartido());
+    segmento->nombreSegmento = nombre;
+    segmento->bytes = bytes;
+    segmento->escribible = true;
+    segmento->enArchivo = enArchivo;
+    // Un hijo creado con fork hereda el objeto pero no la propiedad del nombre
+    segmento->pidPropietario = enArchivo ? 0 : static_cast<long>(getpid());
+
+    if (ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+        std::cerr << "[C++ Core] Error: No se pudo dimensionar el segmento " << nombre << " ("
+                  << std::strerror(errno) << ")." << std::endl;
+        close(fd);
+        return nullptr;
+    }
+    void* direccion = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (direccion == MAP_FAILED) {
+        std::cerr << "[C++ Core] Error: No se pudo mapear el segmento " << nombre << std::endl;
+        return nullptr;
+    }
+    segmento->direccion = direccion;
+    return segmento;
+}
+
+std::unique_ptr<SegmentoCompartido> SegmentoCompartido::abrir(const std::string& nombre,
+                                                              bool enArchivo) {
+    int fd = enArchivo ? open(nombre.c_str(), O_RDONLY)
+                       : shm_open(nombreSistema(nombre).c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return nullptr;
+    }
+    size_t bytes = static_cast<size_t>(info.st_size);
+    void* direccion = mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (direccion == MAP_FAILED) {
+        return nullptr;
+    }
+
+    std::unique_ptr<SegmentoCompartido> segmento(new SegmentoCompartido());
+    segmento->nombreSegmento = nombre;
+    segmento->bytes = bytes;
+    segmento->enArchivo = enArchivo;
+    segmento->direccion = direccion;
+    return segmento;
+}
+
+SegmentoCompartido::~SegmentoCompartido() {
+    if (direccion != nullptr) {
+        munmap(direccion, bytes);
+    }
+    if (pidPropietario != 0 && pidPropietario == static_cast<long>(getpid())) {
+        shm_unlink(nombreSistema(nombreSegmento).c_str());
+    }
+}
+
+bool SegmentoCompartido::eliminar(const std::string& nombre) {
+    return shm_unlink(nombreSistema(nombre).c_str()) == 0;
+}
+
+#endif
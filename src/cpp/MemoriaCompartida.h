@@ -0,0 +1,77 @@
+/**
+ * @file MemoriaCompartida.h
+ * @brief Segmentos de memoria compartida con nombre y archivos mapeados
+ * @author NeuroNet Team
+ *
+ * Envoltorio mínimo y portable sobre shm_open/mmap (POSIX) y
+ * CreateFileMapping/MapViewOfFile (Windows). Un segmento se crea de
+ * lectura/escritura por el proceso que publica y se abre de solo
+ * lectura por los demás; un archivo de instantánea se comporta igual
+ * pero persiste en disco.
+ */
+
+#ifndef MEMORIA_COMPARTIDA_H
+#define MEMORIA_COMPARTIDA_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+/**
+ * @class SegmentoCompartido
+ * @brief Región de memoria mapeada; se desmapea al destruirse
+ */
+class SegmentoCompartido {
+public:
+    ~SegmentoCompartido();
+
+    SegmentoCompartido(const SegmentoCompartido&) = delete;
+    SegmentoCompartido& operator=(const SegmentoCompartido&) = delete;
+
+    /**
+     * @brief Crea un segmento nuevo de lectura/escritura
+     * @param nombre Nombre del segmento o ruta del archivo
+     * @param bytes Tamaño del segmento
+     * @param enArchivo true para un archivo de instantánea en disco
+     * @return nullptr si ya existe o no se pudo crear
+     *
+     * Un segmento con nombre se elimina del sistema cuando se destruye el
+     * objeto que lo creó; los procesos que ya lo tienen abierto conservan
+     * su mapeo. Un archivo de instantánea permanece en disco.
+     */
+    static std::unique_ptr<SegmentoCompartido> crear(const std::string& nombre, size_t bytes,
+                                                     bool enArchivo);
+
+    /**
+     * @brief Abre de solo lectura un segmento o archivo existente
+     * @return nullptr si no existe
+     */
+    static std::unique_ptr<SegmentoCompartido> abrir(const std::string& nombre, bool enArchivo);
+
+    /**
+     * @brief Elimina el nombre de un segmento (los mapeos existentes siguen válidos)
+     * @return false si no existía
+     */
+    static bool eliminar(const std::string& nombre);
+
+    void* datos() const { return direccion; }
+    size_t tamano() const { return bytes; }
+    const std::string& nombre() const { return nombreSegmento; }
+    bool esEscribible() const { return escribible; }
+
+private:
+    SegmentoCompartido() = default;
+
+    void* direccion = nullptr;
+    size_t bytes = 0;
+    std::string nombreSegmento;
+    bool escribible = false;
+    bool enArchivo = false;
+    long pidPropietario = 0;    ///< Proceso que creó el segmento con nombre (lo elimina al destruirse)
+#ifdef _WIN32
+    void* archivo = nullptr;    ///< HANDLE del archivo (solo instantáneas)
+    void* mapeo = nullptr;      ///< HANDLE del objeto de mapeo
+#endif
+};
+
+#endif // MEMORIA_COMPARTIDA_H
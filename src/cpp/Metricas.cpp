@@ -0,0 +1,129 @@
+/**
+ * @file Metricas.cpp
+ * @brief Registro y agregación de los contadores por hilo
+ * @author NeuroNet Team
+ */
+
+#include "Metricas.h"
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+thread_local BloqueMetricas* bloqueMetricasHilo = nullptr;
+
+namespace {
+
+bool activasAlIniciar() {
+    const char* valor = std::getenv("NEURONET_METRICAS");
+    return valor == nullptr || std::strcmp(valor, "0") != 0;
+}
+
+/**
+ * Bloques de todos los hilos que han medido algo. Un bloque sobrevive a
+ * su hilo para que sus cuentas sigan en el total. El registro no se
+ * destruye nunca: un hilo puede medir durante la salida del proceso.
+ */
+struct RegistroMetricas {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<BloqueMetricas>> bloques;
+    std::vector<PerfilNivelBFS> perfilUltimoBFS;
+};
+
+RegistroMetricas& registro() {
+    static RegistroMetricas* instancia = new RegistroMetricas();
+    return *instancia;
+}
+
+} // namespace
+
+std::atomic<bool> metricasEncendidas{activasAlIniciar()};
+
+BloqueMetricas& registrarBloqueMetricas() {
+    RegistroMetricas& r = registro();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.bloques.emplace_back(new BloqueMetricas());
+    bloqueMetricasHilo = r.bloques.back().get();
+    return *bloqueMetricasHilo;
+}
+
+void registrarPerfilBFS(const std::vector<PerfilNivelBFS>& perfil) {
+    if (!metricasActivas()) {
+        return;
+    }
+    RegistroMetricas& r = registro();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.perfilUltimoBFS = perfil;
+}
+
+InstantaneaMetricas obtenerMetricas(bool reiniciar) {
+    InstantaneaMetricas instantanea;
+    RegistroMetricas& r = registro();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    auto leer = [reiniciar](std::atomic<int64_t>& contador) {
+        return reiniciar ? contador.exchange(0, std::memory_order_relaxed)
+                         : contador.load(std::memory_order_relaxed);
+    };
+    for (const auto& bloque : r.bloques) {
+        for (int c = 0; c < static_cast<int>(ContadorMetrica::Cantidad); c++) {
+            instantanea.contadores[c] += leer(bloque->contadores[c]);
+        }
+        for (int m = 0; m < static_cast<int>(MaximoMetrica::Cantidad); m++) {
+            int64_t valor = leer(bloque->maximos[m]);
+            if (valor > instantanea.maximos[m]) {
+                instantanea.maximos[m] = valor;
+            }
+        }
+    }
+    instantanea.perfilUltimoBFS = r.perfilUltimoBFS;
+    instantanea.hilos = static_cast<int>(r.bloques.size());
+    if (reiniciar) {
+        r.perfilUltimoBFS.clear();
+    }
+    return instantanea;
+}
+
+void reiniciarMetricas() {
+    RegistroMetricas& r = registro();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (const auto& bloque : r.bloques) {
+        for (auto& c : bloque->contadores) {
+            c.store(0, std::memory_order_relaxed);
+        }
+        for (auto& m : bloque->maximos) {
+            m.store(0, std::memory_order_relaxed);
+        }
+    }
+    r.perfilUltimoBFS.clear();
+}
+
+void activarMetricas(bool activas) {
+    metricasEncendidas.store(activas, std::memory_order_relaxed);
+}
+
+const char* nombreContadorMetrica(ContadorMetrica contador) {
+    switch (contador) {
+        case ContadorMetrica::LlamadasBFS: return "llamadas_bfs";
+        case ContadorMetrica::NivelesBFS: return "niveles_bfs";
+        case ContadorMetrica::NivelesParalelos: return "niveles_paralelos";
+        case ContadorMetrica::LlamadasDFS: return "llamadas_dfs";
+        case ContadorMetrica::RecorridosInternos: return "recorridos_internos";
+        case ContadorMetrica::NodosVisitados: return "nodos_visitados";
+        case ContadorMetrica::AristasExploradas: return "aristas_exploradas";
+        case ContadorMetrica::BytesReservados: return "bytes_reservados";
+        case ContadorMetrica::NanosPreparacion: return "ns_preparacion";
+        case ContadorMetrica::NanosExpansion: return "ns_expansion";
+        case ContadorMetrica::NanosExpansionParalela: return "ns_expansion_paralela";
+        case ContadorMetrica::Cantidad: break;
+    }
+    return "";
+}
+
+const char* nombreMaximoMetrica(MaximoMetrica maximo) {
+    switch (maximo) {
+        case MaximoMetrica::FronteraMaxima: return "frontera_maxima";
+        case MaximoMetrica::GradoMaximoExpandido: return "grado_maximo_expandido";
+        case MaximoMetrica::Cantidad: break;
+    }
+    return "";
+}
@@ -0,0 +1,201 @@
+/**
+ * @file Metricas.h
+ * @brief Contadores de instrumentación de los recorridos, por hilo
+ * @author NeuroNet Team
+ *
+ * Cada hilo suma en su propio bloque de contadores (sin instrucciones
+ * atómicas con bloqueo ni líneas de caché compartidas) y los bloques se
+ * agregan solo cuando alguien pide las métricas. Los núcleos acumulan
+ * en variables locales y publican una vez por nivel o por llamada, no
+ * por arista.
+ *
+ * Compilación: con NEURONET_METRICAS=0 (por ejemplo, la variable de
+ * entorno del mismo nombre al ejecutar setup.py) todas las llamadas
+ * desaparecen. En ejecución, NEURONET_METRICAS=0 o activarMetricas(false)
+ * las apagan.
+ */
+
+#ifndef METRICAS_H
+#define METRICAS_H
+
+#ifndef NEURONET_METRICAS
+#define NEURONET_METRICAS 1
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @enum ContadorMetrica
+ * @brief Contadores acumulativos
+ */
+enum class ContadorMetrica {
+    LlamadasBFS = 0,          ///< GrafoDisperso::BFS
+    NivelesBFS,               ///< Niveles expandidos por BFS
+    NivelesParalelos,         ///< Niveles expandidos en paralelo
+    LlamadasDFS,
+    RecorridosInternos,       ///< bfsDistancias (diámetro, índices, muestreo)
+    NodosVisitados,           ///< Nodos alcanzados por todos los recorridos
+    AristasExploradas,        ///< Aristas de salida leídas por todos los recorridos
+    BytesReservados,          ///< Memoria de trabajo reservada por los recorridos
+    NanosPreparacion,         ///< BFS: inicializar las marcas
+    NanosExpansion,           ///< BFS: expandir niveles (secuenciales y paralelos)
+    NanosExpansionParalela,   ///< BFS: parte de NanosExpansion en niveles paralelos
+    Cantidad                  ///< Número de contadores (no es un contador)
+};
+
+/**
+ * @enum MaximoMetrica
+ * @brief Máximos observados (los hubs se delatan aquí)
+ */
+enum class MaximoMetrica {
+    FronteraMaxima = 0,       ///< Mayor frontera de un nivel de BFS
+    GradoMaximoExpandido,     ///< Mayor grado de salida de un nodo expandido
+    Cantidad
+};
+
+/**
+ * @struct PerfilNivelBFS
+ * @brief Coste de un nivel del último BFS
+ */
+struct PerfilNivelBFS {
+    int64_t frontera = 0;       ///< Nodos expandidos en el nivel
+    int64_t aristas = 0;        ///< Aristas leídas
+    int64_t nanosegundos = 0;
+};
+
+/**
+ * @struct InstantaneaMetricas
+ * @brief Suma de los bloques de todos los hilos
+ */
+struct InstantaneaMetricas {
+    int64_t contadores[static_cast<int>(ContadorMetrica::Cantidad)] = {};
+    int64_t maximos[static_cast<int>(MaximoMetrica::Cantidad)] = {};
+    std::vector<PerfilNivelBFS> perfilUltimoBFS;  ///< Del BFS terminado más recientemente
+    int hilos = 0;                                ///< Hilos que han registrado métricas
+};
+
+/**
+ * @struct BloqueMetricas
+ * @brief Contadores de un hilo. Solo su hilo escribe; el lector agrega
+ *        con cargas relajadas
+ */
+struct alignas(64) BloqueMetricas {
+    std::atomic<int64_t> contadores[static_cast<int>(ContadorMetrica::Cantidad)] = {};
+    std::atomic<int64_t> maximos[static_cast<int>(MaximoMetrica::Cantidad)] = {};
+};
+
+/** Bloque del hilo actual (nulo hasta su primera métrica) */
+extern thread_local BloqueMetricas* bloqueMetricasHilo;
+
+/** Interruptor global en ejecución */
+extern std::atomic<bool> metricasEncendidas;
+
+/** Crea y registra el bloque del hilo actual */
+BloqueMetricas& registrarBloqueMetricas();
+
+inline bool metricasActivas() {
+#if NEURONET_METRICAS
+    return metricasEncendidas.load(std::memory_order_relaxed);
+#else
+    return false;
+#endif
+}
+
+inline void sumarMetrica(ContadorMetrica contador, int64_t valor) {
+#if NEURONET_METRICAS
+    if (metricasActivas()) {
+        BloqueMetricas* bloque = bloqueMetricasHilo;
+        std::atomic<int64_t>& c = (bloque != nullptr ? *bloque : registrarBloqueMetricas())
+                                      .contadores[static_cast<int>(contador)];
+        c.store(c.load(std::memory_order_relaxed) + valor, std::memory_order_relaxed);
+    }
+#else
+    (void)contador;
+    (void)valor;
+#endif
+}
+
+inline void maximoMetrica(MaximoMetrica maximo, int64_t valor) {
+#if NEURONET_METRICAS
+    if (metricasActivas()) {
+        BloqueMetricas* bloque = bloqueMetricasHilo;
+        std::atomic<int64_t>& m = (bloque != nullptr ? *bloque : registrarBloqueMetricas())
+                                      .maximos[static_cast<int>(maximo)];
+        if (valor > m.load(std::memory_order_relaxed)) {
+            m.store(valor, std::memory_order_relaxed);
+        }
+    }
+#else
+    (void)maximo;
+    (void)valor;
+#endif
+}
+
+/**
+ * @brief Guarda el perfil por niveles de un BFS recién terminado
+ */
+void registrarPerfilBFS(const std::vector<PerfilNivelBFS>& perfil);
+
+/**
+ * @brief Suma los bloques de todos los hilos (los que ya terminaron incluidos)
+ * @param reiniciar Pone cada contador a cero al leerlo: un incremento
+ *        concurrente cae en esta lectura o en la siguiente, nunca se pierde
+ */
+InstantaneaMetricas obtenerMetricas(bool reiniciar = false);
+
+/**
+ * @brief Pone a cero todos los contadores
+ *
+ * Un hilo que esté sumando a la vez puede conservar su último incremento.
+ */
+void reiniciarMetricas();
+
+/** Enciende o apaga la recogida en ejecución (sin efecto si no se compiló) */
+void activarMetricas(bool activas);
+
+/** Nombres de los contadores y máximos, en el orden de los enums */
+const char* nombreContadorMetrica(ContadorMetrica contador);
+const char* nombreMaximoMetrica(MaximoMetrica maximo);
+
+/**
+ * @class CronometroMetrica
+ * @brief Suma al contador indicado los nanosegundos hasta su destrucción
+ *
+ * No lee el reloj si las métricas están apagadas.
+ */
+class CronometroMetrica {
+public:
+    explicit CronometroMetrica(ContadorMetrica contador) : contador(contador), activo(metricasActivas()) {
+        if (activo) {
+            inicio = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~CronometroMetrica() {
+        if (activo) {
+            sumarMetrica(contador, nanosegundos());
+        }
+    }
+
+    /** Nanosegundos transcurridos (0 si las métricas están apagadas) */
+    int64_t nanosegundos() const {
+        if (!activo) {
+            return 0;
+        }
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now() - inicio).count();
+    }
+
+    CronometroMetrica(const CronometroMetrica&) = delete;
+    CronometroMetrica& operator=(const CronometroMetrica&) = delete;
+
+private:
+    ContadorMetrica contador;
+    bool activo;
+    std::chrono::steady_clock::time_point inicio;
+};
+
+#endif // METRICAS_H
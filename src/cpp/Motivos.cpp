@@ -0,0 +1,360 @@
+/**
+ * @file Motivos.cpp
+ * @brief Implementación del censo de tríadas y del conteo de grafletes
+ * @author NeuroNet Team
+ */
+
+#include "Motivos.h"
+#include "Paralelo.h"
+#include <functional>
+#include <iterator>
+#include <memory>
+
+namespace {
+
+// Código de tríada -> tipo en orden MAN. Para la tríada (v, u, w) el
+// código suma 1 si v->u, 2 si u->v, 4 si v->w, 8 si w->v, 16 si u->w y
+// 32 si w->u.
+const int TIPO_POR_CODIGO[64] = {
+     0,  1,  1,  2,  1,  3,  5,  7,  1,  5,  4,  6,  2,  7,  6, 10,
+     1,  5,  3,  7,  4,  8,  8, 12,  5,  9,  8, 13,  6, 13, 11, 14,
+     1,  4,  5,  6,  5,  8,  9, 13,  3,  8,  8, 11,  7, 12, 13, 14,
+     2,  6,  7, 10,  6, 11, 13, 14,  7, 13, 12, 14, 10, 14, 14, 15
+};
+
+int64_t combinaciones2(int64_t x) {
+    return x * (x - 1) / 2;
+}
+
+int64_t combinaciones3(int64_t x) {
+    return x * (x - 1) * (x - 2) / 6;
+}
+
+} // namespace
+
+ContadorMotivos::ContadorMotivos(const GrafoDisperso& grafo)
+    : dirigido(grafo.vistaCSR()), csr(grafo.vistaNoDirigida(rowPtr, columnas)) {
+}
+
+bool ContadorMotivos::tieneArista(const VistaCSR& vista, int u, int v) {
+    const int* inicio = vista.columnas + vista.rowPtr[u];
+    const int* fin = vista.columnas + vista.rowPtr[u + 1];
+    return std::binary_search(inicio, fin, v);
+}
+
+CensoTriadas ContadorMotivos::censoTriadas() const {
+    std::cout << "[C++ Core] Calculando censo de triadas dirigidas..." << std::endl;
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    int n = csr.numNodos;
+    std::vector<CensoTriadas> porHilo(numHilosDisponibles());
+
+    paraleloPara(n, 256, [&](int64_t desde, int64_t hasta, int hilo) {
+        int64_t* cuentas = porHilo[hilo].cuentas;
+
+        for (int64_t v = desde; v < hasta; v++) {
+            const int* vIni = csr.columnas + csr.rowPtr[v];
+            const int* vFin = csr.columnas + csr.rowPtr[v + 1];
+
+            for (const int* pu = vIni; pu != vFin; ++pu) {
+                int u = *pu;
+                if (u <= v) {
+                    continue;
+                }
+                const int* uIni = csr.columnas + csr.rowPtr[u];
+                const int* uFin = csr.columnas + csr.rowPtr[u + 1];
+
+                int codigoVU = (tieneArista(dirigido, v, u) ? 1 : 0) |
+                               (tieneArista(dirigido, u, v) ? 2 : 0);
+
+                // Unión ordenada de N(v) y N(u) sin u ni v
+                int64_t tamanoUnion = 0;
+                const int* a = vIni;
+                const int* b = uIni;
+                while (a != vFin || b != uFin) {
+                    int w;
+                    bool enV;
+                    if (b == uFin || (a != vFin && *a < *b)) {
+                        w = *a++;
+                        enV = true;
+                    } else if (a == vFin || *b < *a) {
+                        w = *b++;
+                        enV = false;
+                    } else {
+                        w = *a++;
+                        ++b;
+                        enV = true;
+                    }
+                    if (w == u || w == v) {
+                        continue;
+                    }
+                    tamanoUnion++;
+
+                    // Cada tríada conexa se cuenta una sola vez
+                    if (u < w || (v < w && w < u && !enV)) {
+                        int codigo = codigoVU |
+                                     (tieneArista(dirigido, v, w) ? 4 : 0) |
+                                     (tieneArista(dirigido, w, v) ? 8 : 0) |
+                                     (tieneArista(dirigido, u, w) ? 16 : 0) |
+                                     (tieneArista(dirigido, w, u) ? 32 : 0);
+                        cuentas[TIPO_POR_CODIGO[codigo]]++;
+                    }
+                }
+
+                // Tríadas con la díada u-v y un tercer nodo aislado
+                cuentas[codigoVU == 3 ? 2 : 1] += n - tamanoUnion - 2;
+            }
+        }
+    }, "ContadorMotivos::censoTriadas", static_cast<int>(porHilo.size()));
+
+    CensoTriadas censo;
+    for (const auto& parcial : porHilo) {
+        for (int t = 1; t < 16; t++) {
+            censo.cuentas[t] += parcial.cuentas[t];
+        }
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+    std::cout << "[C++ Core] Censo de triadas completado. Tiempo ejecucion: "
+              << duration.count() << " ms." << std::endl;
+
+    return censo;
+}
+
+std::vector<int64_t> ContadorMotivos::triangulosPorArista() const {
+    // t[k] = vecinos comunes de los extremos de la arista en la posición k
+    std::vector<int64_t> triangulos(csr.numAristas, 0);
+
+    paraleloPara(csr.numNodos, 256, [&](int64_t desde, int64_t hasta, int) {
+        for (int64_t u = desde; u < hasta; u++) {
+            for (int k = csr.rowPtr[u]; k < csr.rowPtr[u + 1]; k++) {
+                int v = csr.columnas[k];
+                const int* a = csr.columnas + csr.rowPtr[u];
+                const int* aFin = csr.columnas + csr.rowPtr[u + 1];
+                const int* b = csr.columnas + csr.rowPtr[v];
+                const int* bFin = csr.columnas + csr.rowPtr[v + 1];
+                int64_t comunes = 0;
+                while (a != aFin && b != bFin) {
+                    if (*a < *b) {
+                        ++a;
+                    } else if (*b < *a) {
+                        ++b;
+                    } else {
+                        comunes++;
+                        ++a;
+                        ++b;
+                    }
+                }
+                triangulos[k] = comunes;
+            }
+        }
+    }, "ContadorMotivos::triangulosPorArista");
+    return triangulos;
+}
+
+int64_t ContadorMotivos::contarCiclos4(const std::vector<int>& rango) const {
+    // Cada ciclo se cuenta desde su nodo de mayor rango u: pares de
+    // caminos u-v-w con v y w de menor rango que u
+    int n = csr.numNodos;
+    int hilos = numHilosDisponibles();
+    std::vector<std::unique_ptr<std::vector<int>>> caminosPorHilo(hilos);
+    std::vector<int64_t> totalPorHilo(hilos, 0);
+
+    paraleloPara(n, 256, [&](int64_t desde, int64_t hasta, int hilo) {
+        if (!caminosPorHilo[hilo]) {
+            caminosPorHilo[hilo].reset(new std::vector<int>(n, 0));
+        }
+        std::vector<int>& caminos = *caminosPorHilo[hilo];
+        std::vector<int> tocados;
+        int64_t total = 0;
+
+        for (int64_t u = desde; u < hasta; u++) {
+            for (int i = csr.rowPtr[u]; i < csr.rowPtr[u + 1]; i++) {
+                int v = csr.columnas[i];
+                if (rango[v] >= rango[u]) {
+                    continue;
+                }
+                for (int j = csr.rowPtr[v]; j < csr.rowPtr[v + 1]; j++) {
+                    int w = csr.columnas[j];
+                    if (rango[w] >= rango[u]) {
+                        continue;
+                    }
+                    if (caminos[w] == 0) {
+                        tocados.push_back(w);
+                    }
+                    total += caminos[w]++;
+                }
+            }
+            for (int w : tocados) {
+                caminos[w] = 0;
+            }
+            tocados.clear();
+        }
+        totalPorHilo[hilo] += total;
+    }, "ContadorMotivos::contarCiclos4", hilos);
+
+    int64_t total = 0;
+    for (int64_t parcial : totalPorHilo) {
+        total += parcial;
+    }
+    return total;
+}
+
+int64_t ContadorMotivos::contarCliques4(const std::vector<int>& rango) const {
+    // Orientación por rango: cada nodo conserva solo los vecinos de mayor
+    // rango, con lo que cada clique se enumera una vez desde su mínimo
+    int n = csr.numNodos;
+    std::vector<int> rowPtrO(n + 1, 0);
+    for (int u = 0; u < n; u++) {
+        int salientes = 0;
+        for (int i = csr.rowPtr[u]; i < csr.rowPtr[u + 1]; i++) {
+            salientes += rango[csr.columnas[i]] > rango[u];
+        }
+        rowPtrO[u + 1] = rowPtrO[u] + salientes;
+    }
+    std::vector<int> columnasO(rowPtrO[n]);
+    paraleloPara(n, 4096, [&](int64_t desde, int64_t hasta, int) {
+        for (int64_t u = desde; u < hasta; u++) {
+            int pos = rowPtrO[u];
+            for (int i = csr.rowPtr[u]; i < csr.rowPtr[u + 1]; i++) {
+                if (rango[csr.columnas[i]] > rango[u]) {
+                    columnasO[pos++] = csr.columnas[i];
+                }
+            }
+        }
+    }, "ContadorMotivos::contarCliques4");
+
+    auto contarBloque = [&](int64_t desde, int64_t hasta) {
+        std::vector<int> comunes;
+        int64_t total = 0;
+
+        for (int64_t u = desde; u < hasta; u++) {
+            const int* uIni = columnasO.data() + rowPtrO[u];
+            const int* uFin = columnasO.data() + rowPtrO[u + 1];
+            for (const int* pv = uIni; pv != uFin; ++pv) {
+                int v = *pv;
+                comunes.clear();
+                std::set_intersection(uIni, uFin,
+                                      columnasO.data() + rowPtrO[v],
+                                      columnasO.data() + rowPtrO[v + 1],
+                                      std::back_inserter(comunes));
+                for (int w : comunes) {
+                    const int* a = columnasO.data() + rowPtrO[w];
+                    const int* aFin = columnasO.data() + rowPtrO[w + 1];
+                    const int* b = comunes.data();
+                    const int* bFin = b + comunes.size();
+                    while (a != aFin && b != bFin) {
+                        if (*a < *b) {
+                            ++a;
+                        } else if (*b < *a) {
+                            ++b;
+                        } else {
+                            total++;
+                            ++a;
+                            ++b;
+                        }
+                    }
+                }
+            }
+        }
+        return total;
+    };
+    return paraleloReducir<int64_t>(n, 256, 0, contarBloque, std::plus<int64_t>(),
+                                    "ContadorMotivos::contarCliques4");
+}
+
+ConteoGrafletes ContadorMotivos::contarGrafletes(std::vector<int64_t>* orbitas) const {
+    std::cout << "[C++ Core] Contando grafletes de 3 y 4 nodos..." << std::endl;
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    int n = csr.numNodos;
+
+    // Rango por grado creciente (desempate por ID) para acotar el trabajo
+    std::vector<int> orden(n);
+    for (int v = 0; v < n; v++) {
+        orden[v] = v;
+    }
+    std::sort(orden.begin(), orden.end(), [&](int a, int b) {
+        int ga = csr.grado(a);
+        int gb = csr.grado(b);
+        return ga != gb ? ga < gb : a < b;
+    });
+    std::vector<int> rango(n);
+    for (int i = 0; i < n; i++) {
+        rango[orden[i]] = i;
+    }
+
+    std::vector<int64_t> triangulosArista = triangulosPorArista();
+
+    // Conteos no inducidos derivados de grados y triángulos. Las sumas
+    // por posición CSR cuentan cada arista dos veces.
+    std::vector<int64_t> triangulosNodo(n, 0);
+    int64_t sumaEstrellas2 = 0;
+    int64_t sumaEstrellas3 = 0;
+    int64_t sumaCaminos3 = 0;
+    int64_t sumaDiamantes = 0;
+    int64_t sumaColas = 0;
+    for (int u = 0; u < n; u++) {
+        int64_t gu = csr.grado(u);
+        for (int k = csr.rowPtr[u]; k < csr.rowPtr[u + 1]; k++) {
+            int64_t gv = csr.grado(csr.columnas[k]);
+            triangulosNodo[u] += triangulosArista[k];
+            sumaCaminos3 += (gu - 1) * (gv - 1);
+            sumaDiamantes += combinaciones2(triangulosArista[k]);
+        }
+        triangulosNodo[u] /= 2;
+        sumaEstrellas2 += combinaciones2(gu);
+        sumaEstrellas3 += combinaciones3(gu);
+        sumaColas += triangulosNodo[u] * (gu - 2 > 0 ? gu - 2 : 0);
+    }
+
+    ConteoGrafletes conteo;
+    int64_t sumaTriangulos = 0;
+    for (int64_t t : triangulosNodo) {
+        sumaTriangulos += t;
+    }
+    conteo.triangulos = sumaTriangulos / 3;
+    conteo.caminos2 = sumaEstrellas2 - 3 * conteo.triangulos;
+
+    int64_t ciclos = contarCiclos4(rango);
+    int64_t caminos = sumaCaminos3 / 2 - 3 * conteo.triangulos;
+    int64_t diamantes = sumaDiamantes / 2;
+
+    // Paso de conteos no inducidos a inducidos (cada graflete denso
+    // contiene un número fijo de copias de los más ralos)
+    conteo.cliques4 = contarCliques4(rango);
+    conteo.diamantes = diamantes - 6 * conteo.cliques4;
+    conteo.ciclos4 = ciclos - conteo.diamantes - 3 * conteo.cliques4;
+    conteo.colasTriangulo = sumaColas - 4 * conteo.diamantes - 12 * conteo.cliques4;
+    conteo.estrellas3 = sumaEstrellas3 - conteo.colasTriangulo - 2 * conteo.diamantes
+                        - 4 * conteo.cliques4;
+    conteo.caminos3 = caminos - 2 * conteo.colasTriangulo - 4 * conteo.ciclos4
+                      - 6 * conteo.diamantes - 12 * conteo.cliques4;
+
+    if (orbitas != nullptr) {
+        orbitas->assign(static_cast<size_t>(n) * 4, 0);
+        paraleloPara(n, 4096, [&](int64_t desde, int64_t hasta, int) {
+            for (int64_t v = desde; v < hasta; v++) {
+                int64_t gv = csr.grado(static_cast<int>(v));
+                int64_t extremos = 0;
+                for (int k = csr.rowPtr[v]; k < csr.rowPtr[v + 1]; k++) {
+                    extremos += csr.grado(csr.columnas[k]) - 1;
+                }
+                int64_t* fila = orbitas->data() + v * 4;
+                fila[0] = gv;
+                fila[1] = extremos - 2 * triangulosNodo[v];
+                fila[2] = combinaciones2(gv) - triangulosNodo[v];
+                fila[3] = triangulosNodo[v];
+            }
+        }, "ContadorMotivos::contarGrafletes");
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+    std::cout << "[C++ Core] Grafletes contados. Triangulos: " << conteo.triangulos
+              << " | 4-cliques: " << conteo.cliques4
+              << ". Tiempo ejecucion: " << duration.count() << " ms." << std::endl;
+
+    return conteo;
+}
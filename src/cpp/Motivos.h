@@ -0,0 +1,86 @@
+/**
+ * @file Motivos.h
+ * @brief Conteo de motivos dirigidos de 3 nodos y grafletes de 4 nodos
+ * @author NeuroNet Team
+ *
+ * El censo de tríadas dirigidas sigue el algoritmo de Batagelj-Mrvar:
+ * solo se recorren las tríadas conexas y las díadas se cuentan por
+ * fórmula. Los grafletes no dirigidos de 4 nodos se obtienen al estilo
+ * PGD/ESCAPE: se cuentan directamente los triángulos por arista, los
+ * ciclos de 4 y las 4-cliques, y el resto se deriva combinatoriamente de
+ * los grados. Las intersecciones aprovechan que las filas CSR están
+ * ordenadas.
+ */
+
+#ifndef MOTIVOS_H
+#define MOTIVOS_H
+
+#include "GrafoDisperso.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct CensoTriadas
+ * @brief Cuenta de cada uno de los 16 tipos de tríada dirigida
+ *
+ * Orden MAN estándar: 003, 012, 102, 021D, 021U, 021C, 111D, 111U,
+ * 030T, 030C, 201, 120D, 120U, 120C, 210, 300. La entrada 003 (tríadas
+ * vacías) no se calcula y queda en 0: es C(n, 3) menos el resto y puede
+ * exceder int64 en grafos grandes.
+ */
+struct CensoTriadas {
+    int64_t cuentas[16] = {0};
+};
+
+/**
+ * @struct ConteoGrafletes
+ * @brief Grafletes no dirigidos inducidos de 3 y 4 nodos (solo conexos)
+ */
+struct ConteoGrafletes {
+    int64_t caminos2 = 0;        ///< Caminos inducidos de 2 aristas (cuñas abiertas)
+    int64_t triangulos = 0;
+    int64_t caminos3 = 0;        ///< Caminos inducidos de 3 aristas
+    int64_t estrellas3 = 0;      ///< Estrellas de 3 hojas
+    int64_t ciclos4 = 0;         ///< Cuadrados sin cuerdas
+    int64_t colasTriangulo = 0;  ///< Triángulo con una arista colgante
+    int64_t diamantes = 0;       ///< Ciclo de 4 con una cuerda
+    int64_t cliques4 = 0;
+};
+
+/**
+ * @class ContadorMotivos
+ * @brief Conteo paralelo de motivos sobre un GrafoDisperso
+ *
+ * Los grafletes se definen sobre la vista no dirigida (sin lazos ni
+ * aristas repetidas); el censo de tríadas usa las aristas dirigidas.
+ */
+class ContadorMotivos {
+public:
+    explicit ContadorMotivos(const GrafoDisperso& grafo);
+
+    /**
+     * @brief Censo de tríadas dirigidas (los lazos se ignoran)
+     */
+    CensoTriadas censoTriadas() const;
+
+    /**
+     * @brief Cuenta los grafletes conexos de 3 y 4 nodos
+     * @param orbitas Si no es nulo, recibe n x 4 conteos por nodo de las
+     *        órbitas 0-3: grado, extremo de camino, centro de camino y
+     *        vértice de triángulo
+     */
+    ConteoGrafletes contarGrafletes(std::vector<int64_t>* orbitas = nullptr) const;
+
+private:
+    VistaCSR dirigido;
+    VectorIndice<int> rowPtr, columnas;
+    VistaCSR csr;  ///< Vista no dirigida
+
+    static bool tieneArista(const VistaCSR& vista, int u, int v);
+
+    std::vector<int64_t> triangulosPorArista() const;
+    int64_t contarCiclos4(const std::vector<int>& rango) const;
+    int64_t contarCliques4(const std::vector<int>& rango) const;
+};
+
+#endif // MOTIVOS_H
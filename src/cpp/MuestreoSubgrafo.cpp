@@ -0,0 +1,331 @@
+/**
+ * @file MuestreoSubgrafo.cpp
+ * @brief Implementación del muestreo de bolas BFS
+ * @author NeuroNet Team
+ */
+
+#include "MuestreoSubgrafo.h"
+#include "Aleatorio.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+namespace {
+
+/**
+ * @brief Recorre los nodos de la bola en un orden aleatorio fijo
+ *
+ * Sirve para reavivar un fuego o teletransportar una caminata: cada
+ * llamada devuelve el siguiente nodo aún no elegido, con coste total
+ * O(bola) sumado sobre todas las llamadas.
+ */
+class ReservaAleatoria {
+public:
+    ReservaAleatoria(const std::vector<int>& bola, GeneradorAleatorio& rng) : nodos(bola) {
+        for (size_t i = nodos.size(); i > 1; i--) {
+            std::swap(nodos[i - 1], nodos[rng.acotado(static_cast<uint32_t>(i))]);
+        }
+    }
+
+    int siguiente(const std::vector<int>& rango) {
+        while (cursor < nodos.size()) {
+            int v = nodos[cursor++];
+            if (rango[v] < 0) {
+                return v;
+            }
+        }
+        return -1;
+    }
+
+private:
+    std::vector<int> nodos;
+    size_t cursor = 0;
+};
+
+} // namespace
+
+MuestreadorSubgrafo::MuestreadorSubgrafo(const GrafoDisperso& grafo)
+    : csr(grafo.vistaCSR()), espacio(grafo.vistaCSR().numNodos),
+      rango(grafo.vistaCSR().numNodos, -1) {}
+
+void MuestreadorSubgrafo::fuegoForestal(int inicio, const ParametrosMuestreo& parametros,
+                                        std::vector<int>& orden) {
+    GeneradorAleatorio rng(parametros.semilla);
+    ReservaAleatoria reserva(espacio.visitados, rng);
+    const std::vector<int>& distancia = espacio.distancia;
+    const double logQuema = std::log(parametros.probQuema);
+    std::vector<int> candidatos;
+
+    auto elegir = [&](int v) {
+        rango[v] = static_cast<int>(orden.size());
+        orden.push_back(v);
+    };
+
+    elegir(inicio);
+    size_t frente = 0;
+    while (static_cast<int>(orden.size()) < parametros.maxNodos) {
+        if (frente == orden.size()) {
+            // El fuego se extinguió: reavivarlo en otro punto de la bola
+            int v = reserva.siguiente(rango);
+            if (v < 0) {
+                break;
+            }
+            elegir(v);
+        }
+        int u = orden[frente++];
+
+        candidatos.clear();
+        for (int e = csr.rowPtr[u]; e < csr.rowPtr[u + 1]; e++) {
+            int v = csr.columnas[e];
+            if (distancia[v] >= 0 && rango[v] < 0) {
+                candidatos.push_back(v);
+            }
+        }
+        // Vecinos a quemar ~ geométrica de media p / (1 - p) (p = 0 da log = -inf y 0 vecinos)
+        double sorteo = 1.0 - rng.uniforme();
+        double geometrica = std::floor(std::log(sorteo) / logQuema);
+        size_t quemar = std::min(static_cast<size_t>(std::min(geometrica, 1e9)), candidatos.size());
+        for (size_t i = 0; i < quemar && static_cast<int>(orden.size()) < parametros.maxNodos; i++) {
+            size_t j = i + rng.acotado(static_cast<uint32_t>(candidatos.size() - i));
+            std::swap(candidatos[i], candidatos[j]);
+            // Un vecino repetido (multiarista) pudo elegirse ya en esta ronda
+            if (rango[candidatos[i]] < 0) {
+                elegir(candidatos[i]);
+            }
+        }
+    }
+}
+
+void MuestreadorSubgrafo::caminataAleatoria(int inicio, const ParametrosMuestreo& parametros,
+                                            std::vector<int>& orden) {
+    GeneradorAleatorio rng(parametros.semilla);
+    ReservaAleatoria reserva(espacio.visitados, rng);
+    const std::vector<int>& distancia = espacio.distancia;
+
+    rango[inicio] = 0;
+    orden.push_back(inicio);
+
+    // Si la caminata deja de descubrir nodos (región agotada o atrapada),
+    // salta a un nodo libre de la bola
+    const int64_t pasosSinProgreso = 100 + 10 * static_cast<int64_t>(parametros.maxNodos);
+    int64_t estancados = 0;
+    int actual = inicio;
+    while (static_cast<int>(orden.size()) < parametros.maxNodos) {
+        int siguiente = -1;
+        if (rng.uniforme() >= parametros.probReinicio) {
+            int grado = csr.rowPtr[actual + 1] - csr.rowPtr[actual];
+            if (grado > 0) {
+                int v = csr.columnas[csr.rowPtr[actual] + rng.acotado(static_cast<uint32_t>(grado))];
+                if (distancia[v] >= 0) {
+                    siguiente = v;
+                }
+            }
+        }
+        if (siguiente < 0) {
+            siguiente = inicio;
+        }
+        if (rango[siguiente] < 0) {
+            rango[siguiente] = static_cast<int>(orden.size());
+            orden.push_back(siguiente);
+            estancados = 0;
+        } else if (++estancados > pasosSinProgreso) {
+            siguiente = reserva.siguiente(rango);
+            if (siguiente < 0) {
+                break;
+            }
+            rango[siguiente] = static_cast<int>(orden.size());
+            orden.push_back(siguiente);
+            estancados = 0;
+        }
+        actual = siguiente;
+    }
+}
+
+void MuestreadorSubgrafo::estratificadoGrado(int inicio, const ParametrosMuestreo& parametros,
+                                             std::vector<int>& orden) {
+    GeneradorAleatorio rng(parametros.semilla);
+    rango[inicio] = 0;
+    orden.push_back(inicio);
+    const int64_t disponibles = static_cast<int64_t>(espacio.visitados.size()) - 1;
+    if (disponibles == 0) {
+        return;
+    }
+
+    // Estrato = floor(log2(grado + 1)), con el grado de salida en el grafo completo
+    std::vector<std::vector<int>> estratos;
+    for (int v : espacio.visitados) {
+        if (v == inicio) {
+            continue;
+        }
+        unsigned grado = static_cast<unsigned>(csr.rowPtr[v + 1] - csr.rowPtr[v]);
+        size_t estrato = 0;
+        while ((grado + 1) >> (estrato + 1)) {
+            estrato++;
+        }
+        if (estrato >= estratos.size()) {
+            estratos.resize(estrato + 1);
+        }
+        estratos[estrato].push_back(v);
+    }
+
+    // Cuotas proporcionales al tamaño del estrato (restos mayores), con al
+    // menos un representante por estrato no vacío mientras alcance
+    const int64_t objetivo = std::min<int64_t>(parametros.maxNodos - 1, disponibles);
+    std::vector<int64_t> cuota(estratos.size(), 0);
+    std::vector<std::pair<double, size_t>> restos;
+    int64_t asignados = 0;
+    for (size_t s = 0; s < estratos.size(); s++) {
+        double exacta = static_cast<double>(objetivo) * estratos[s].size() / disponibles;
+        cuota[s] = static_cast<int64_t>(exacta);
+        if (cuota[s] == 0 && !estratos[s].empty()) {
+            cuota[s] = 1;
+        }
+        cuota[s] = std::min<int64_t>(cuota[s], static_cast<int64_t>(estratos[s].size()));
+        asignados += cuota[s];
+        restos.emplace_back(exacta - std::floor(exacta), s);
+    }
+    std::sort(restos.begin(), restos.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first || (a.first == b.first && a.second < b.second);
+    });
+    for (size_t r = 0; asignados < objetivo; r = (r + 1) % restos.size()) {
+        size_t s = restos[r].second;
+        if (cuota[s] < static_cast<int64_t>(estratos[s].size())) {
+            cuota[s]++;
+            asignados++;
+        }
+    }
+    // Los mínimos de un representante pueden exceder el objetivo: recortar
+    // primero los estratos más grandes
+    while (asignados > objetivo) {
+        size_t mayor = std::max_element(cuota.begin(), cuota.end()) - cuota.begin();
+        cuota[mayor]--;
+        asignados--;
+    }
+
+    std::vector<int> elegidos;
+    for (size_t s = 0; s < estratos.size(); s++) {
+        std::vector<int>& miembros = estratos[s];
+        for (int64_t i = 0; i < cuota[s]; i++) {
+            size_t j = i + rng.acotado(static_cast<uint32_t>(miembros.size() - i));
+            std::swap(miembros[i], miembros[j]);
+            elegidos.push_back(miembros[i]);
+        }
+    }
+    // Orden de prioridad aleatorio para que el recorte por aristas no
+    // favorezca a ningún estrato
+    for (size_t i = elegidos.size(); i > 1; i--) {
+        std::swap(elegidos[i - 1], elegidos[rng.acotado(static_cast<uint32_t>(i))]);
+    }
+
+    for (int v : elegidos) {
+        rango[v] = static_cast<int>(orden.size());
+        orden.push_back(v);
+    }
+}
+
+bool MuestreadorSubgrafo::muestrear(int nodoInicio, int profundidadMaxima,
+                                    const ParametrosMuestreo& parametros, MuestraSubgrafo& muestra) {
+    muestra = MuestraSubgrafo();
+    if (nodoInicio < 0 || nodoInicio >= csr.numNodos || profundidadMaxima < 0) {
+        std::cerr << "[C++ Core] Error: Nodo de inicio invalido." << std::endl;
+        return false;
+    }
+    if (parametros.maxNodos < 1 || parametros.maxAristas < 0 || parametros.probQuema < 0.0 ||
+        parametros.probQuema >= 1.0 || parametros.probReinicio < 0.0 ||
+        parametros.probReinicio >= 1.0) {
+        std::cerr << "[C++ Core] Error: Parametros de muestreo invalidos." << std::endl;
+        return false;
+    }
+
+    auto inicio = std::chrono::high_resolution_clock::now();
+
+    int alcance = bfsDistancias(csr, nodoInicio, espacio, profundidadMaxima);
+    const std::vector<int>& bola = espacio.visitados;
+    const std::vector<int>& distancia = espacio.distancia;
+    muestra.nodosBola = static_cast<int>(bola.size());
+    for (int u : bola) {
+        for (int e = csr.rowPtr[u]; e < csr.rowPtr[u + 1]; e++) {
+            if (distancia[csr.columnas[e]] >= 0) {
+                muestra.aristasBola++;
+            }
+        }
+    }
+
+    std::vector<int> orden;
+    orden.reserve(std::min<size_t>(bola.size(), static_cast<size_t>(parametros.maxNodos)));
+    bool cabeEntera = muestra.nodosBola <= parametros.maxNodos &&
+                      (parametros.maxAristas == 0 || muestra.aristasBola <= parametros.maxAristas);
+    if (cabeEntera) {
+        for (int v : bola) {
+            rango[v] = static_cast<int>(orden.size());
+            orden.push_back(v);
+        }
+    } else if (parametros.estrategia == EstrategiaMuestreo::CaminataAleatoria) {
+        caminataAleatoria(nodoInicio, parametros, orden);
+    } else if (parametros.estrategia == EstrategiaMuestreo::EstratificadoGrado) {
+        estratificadoGrado(nodoInicio, parametros, orden);
+    } else {
+        fuegoForestal(nodoInicio, parametros, orden);
+    }
+
+    // Cada arista inducida aparece cuando entra el último de sus extremos:
+    // el prefijo más largo dentro del presupuesto se obtiene acumulando
+    std::vector<int64_t> aristasPorRango(orden.size(), 0);
+    for (int u : orden) {
+        for (int e = csr.rowPtr[u]; e < csr.rowPtr[u + 1]; e++) {
+            int v = csr.columnas[e];
+            if (distancia[v] >= 0 && rango[v] >= 0) {
+                aristasPorRango[std::max(rango[u], rango[v])]++;
+            }
+        }
+    }
+    size_t conservar = orden.size();
+    int64_t acumuladas = 0;
+    for (size_t r = 0; r < orden.size(); r++) {
+        if (parametros.maxAristas > 0 && r > 0 && acumuladas + aristasPorRango[r] > parametros.maxAristas) {
+            conservar = r;
+            break;
+        }
+        acumuladas += aristasPorRango[r];
+    }
+    muestra.aristasMuestra = acumuladas;
+    for (size_t r = conservar; r < orden.size(); r++) {
+        rango[orden[r]] = -1;
+    }
+    orden.resize(conservar);
+
+    // Salida en orden creciente de ID, con nivel y vecinos ocultos
+    std::sort(orden.begin(), orden.end());
+    muestra.nodos = orden;
+    muestra.niveles.reserve(orden.size());
+    muestra.ocultos.reserve(orden.size());
+    muestra.podadosPorNivel.assign(alcance + 1, 0);
+    for (int v : bola) {
+        if (rango[v] < 0) {
+            muestra.podadosPorNivel[distancia[v]]++;
+        }
+    }
+    for (int u : orden) {
+        muestra.niveles.push_back(distancia[u]);
+        int ocultos = 0;
+        for (int e = csr.rowPtr[u]; e < csr.rowPtr[u + 1]; e++) {
+            int v = csr.columnas[e];
+            if (distancia[v] >= 0 && rango[v] < 0) {
+                ocultos++;
+            }
+        }
+        muestra.ocultos.push_back(ocultos);
+    }
+    for (int u : orden) {
+        rango[u] = -1;
+    }
+
+    auto fin = std::chrono::high_resolution_clock::now();
+    auto duracion = std::chrono::duration_cast<std::chrono::microseconds>(fin - inicio);
+    std::cout << "[C++ Core] Muestra de la bola BFS: " << muestra.nodos.size() << " de "
+              << muestra.nodosBola << " nodos, " << muestra.aristasMuestra << " de "
+              << muestra.aristasBola << " aristas. Tiempo: " << duracion.count() / 1000.0
+              << " ms." << std::endl;
+    return true;
+}
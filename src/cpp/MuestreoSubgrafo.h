@@ -0,0 +1,93 @@
+/**
+ * @file MuestreoSubgrafo.h
+ * @brief Muestreo representativo de la bola BFS de un nodo (nivel de detalle)
+ * @author NeuroNet Team
+ *
+ * Para dibujar la vecindad de un nodo en un grafo masivo no basta con
+ * truncar el recorrido: eso solo muestra lo que se descubrió primero.
+ * El muestreador elige, dentro de la bola BFS, un subconjunto que
+ * respeta un presupuesto de nodos y aristas y conserva la forma del
+ * conjunto (fuego forestal o caminata aleatoria para la conectividad,
+ * estratos de grado para la distribución de grados), y resume lo que
+ * quedó fuera con conteos agregados.
+ */
+
+#ifndef MUESTREO_SUBGRAFO_H
+#define MUESTREO_SUBGRAFO_H
+
+#include "GrafoDisperso.h"
+#include "RecorridoBFS.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Estrategia de selección de nodos dentro de la bola
+ */
+enum class EstrategiaMuestreo {
+    FuegoForestal = 0,      ///< Propagación por vecinos con quema geométrica
+    CaminataAleatoria = 1,  ///< Caminata con reinicio en el nodo central
+    EstratificadoGrado = 2  ///< Cuotas proporcionales por estrato log2(grado + 1)
+};
+
+/**
+ * @struct ParametrosMuestreo
+ * @brief Presupuesto y configuración de un muestreo
+ */
+struct ParametrosMuestreo {
+    EstrategiaMuestreo estrategia = EstrategiaMuestreo::FuegoForestal;
+    int maxNodos = 2000;            ///< Presupuesto de nodos (incluye el central)
+    int64_t maxAristas = 0;         ///< Presupuesto de aristas inducidas (0 = sin límite)
+    double probQuema = 0.7;         ///< Fuego forestal: media de vecinos quemados p / (1 - p)
+    double probReinicio = 0.15;     ///< Caminata: probabilidad de volver al nodo central
+    uint64_t semilla = 42;
+};
+
+/**
+ * @struct MuestraSubgrafo
+ * @brief Nodos elegidos y agregados de la parte podada
+ *
+ * Los arreglos por nodo están alineados con `nodos`, que va en orden
+ * creciente (el mismo orden de los nodos locales de extraerSubgrafo).
+ */
+struct MuestraSubgrafo {
+    std::vector<int> nodos;            ///< IDs elegidos, crecientes
+    std::vector<int> niveles;          ///< Nivel BFS de cada nodo elegido
+    std::vector<int> ocultos;          ///< Vecinos salientes en la bola que no se eligieron
+    std::vector<int> podadosPorNivel;  ///< Nodos de la bola no elegidos, por nivel
+    int nodosBola = 0;                 ///< Nodos de la bola completa
+    int64_t aristasBola = 0;           ///< Aristas con ambos extremos en la bola
+    int64_t aristasMuestra = 0;        ///< Aristas inducidas por la muestra
+};
+
+/**
+ * @class MuestreadorSubgrafo
+ * @brief Muestreo de bolas BFS con espacio de trabajo reutilizable
+ */
+class MuestreadorSubgrafo {
+public:
+    explicit MuestreadorSubgrafo(const GrafoDisperso& grafo);
+
+    /**
+     * @brief Elige una muestra de la bola de radio profundidadMaxima
+     * @return false si el nodo o los parámetros son inválidos
+     *
+     * Si la bola completa cabe en el presupuesto se devuelve entera. Si
+     * no, la estrategia fija un orden de prioridad entre los nodos y se
+     * conserva el prefijo más largo que respeta ambos presupuestos; el
+     * nodo central siempre se conserva. El resultado es reproducible
+     * para una misma semilla.
+     */
+    bool muestrear(int nodoInicio, int profundidadMaxima, const ParametrosMuestreo& parametros,
+                   MuestraSubgrafo& muestra);
+
+private:
+    VistaCSR csr;
+    EspacioBFS espacio;
+    std::vector<int> rango;   ///< Posición de cada nodo en el orden de prioridad (-1 = fuera)
+
+    void fuegoForestal(int inicio, const ParametrosMuestreo& parametros, std::vector<int>& orden);
+    void caminataAleatoria(int inicio, const ParametrosMuestreo& parametros, std::vector<int>& orden);
+    void estratificadoGrado(int inicio, const ParametrosMuestreo& parametros, std::vector<int>& orden);
+};
+
+#endif // MUESTREO_SUBGRAFO_H
@@ -0,0 +1,472 @@
+/**
+ * @file OraculoLandmarks.cpp
+ * @brief Implementación del oráculo de distancias por landmarks
+ * @author NeuroNet Team
+ */
+
+#include "OraculoLandmarks.h"
+#include "Aleatorio.h"
+#include "Paralelo.h"
+#include <climits>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+namespace {
+
+const char MAGIA_ORACULO[4] = {'N', 'N', 'L', 'M'};
+const uint32_t VERSION_ORACULO = 1;
+
+/**
+ * @brief Reduce una tabla uint16 a uint8 conservando el centinela
+ */
+VectorIndice<uint8_t> reducirA8(const VectorIndice<uint16_t>& tabla) {
+    VectorIndice<uint8_t> reducida(tabla.size());
+    for (size_t i = 0; i < tabla.size(); i++) {
+        reducida[i] = tabla[i] == std::numeric_limits<uint16_t>::max()
+            ? std::numeric_limits<uint8_t>::max()
+            : static_cast<uint8_t>(tabla[i]);
+    }
+    return reducida;
+}
+
+template <typename T, typename A>
+void escribirVector(std::ofstream& archivo, const std::vector<T, A>& datos) {
+    archivo.write(reinterpret_cast<const char*>(datos.data()), datos.size() * sizeof(T));
+}
+
+template <typename T, typename A>
+bool leerVector(std::ifstream& archivo, std::vector<T, A>& datos, size_t cantidad) {
+    datos.resize(cantidad);
+    archivo.read(reinterpret_cast<char*>(datos.data()), cantidad * sizeof(T));
+    return static_cast<bool>(archivo);
+}
+
+} // namespace
+
+OraculoLandmarks::OraculoLandmarks()
+    : numNodos(0), numAristas(0), k(0), bytesPorDistancia(0),
+      espacioAdelante(0), espacioAtras(0) {
+}
+
+void OraculoLandmarks::limpiar() {
+    numNodos = 0;
+    numAristas = 0;
+    k = 0;
+    bytesPorDistancia = 0;
+    landmarks.clear();
+    desde8.clear(); desde8.shrink_to_fit();
+    hacia8.clear(); hacia8.shrink_to_fit();
+    desde16.clear(); desde16.shrink_to_fit();
+    hacia16.clear(); hacia16.shrink_to_fit();
+    rowPtrT.clear(); rowPtrT.shrink_to_fit();
+    columnasT.clear(); columnasT.shrink_to_fit();
+    transpuesta = VistaCSR();
+    espacioAdelante = EspacioBFS(0);
+    espacioAtras = EspacioBFS(0);
+}
+
+bool OraculoLandmarks::coincideCon(const GrafoDisperso& grafo) const {
+    VistaCSR csr = grafo.vistaCSR();
+    return csr.numNodos == numNodos && csr.numAristas == numAristas;
+}
+
+size_t OraculoLandmarks::getMemoriaUsada() const {
+    return desde8.capacity() + hacia8.capacity() +
+           (desde16.capacity() + hacia16.capacity()) * sizeof(uint16_t) +
+           landmarks.capacity() * sizeof(int);
+}
+
+std::vector<int> OraculoLandmarks::elegirPorGrado(const VistaCSR& csr, int k) {
+    std::vector<int> nodos(csr.numNodos);
+    for (int v = 0; v < csr.numNodos; v++) {
+        nodos[v] = v;
+    }
+    auto gradoTotal = [&](int v) { return csr.grado(v) + csr.gradoEntrada[v]; };
+    k = std::min(k, csr.numNodos);
+    std::partial_sort(nodos.begin(), nodos.begin() + k, nodos.end(), [&](int a, int b) {
+        return gradoTotal(a) != gradoTotal(b) ? gradoTotal(a) > gradoTotal(b) : a < b;
+    });
+    nodos.resize(k);
+    return nodos;
+}
+
+std::vector<int> OraculoLandmarks::elegirPorCobertura(const VistaCSR& csr, const VistaCSR& transpuesta,
+                                                      int k, uint64_t semilla) {
+    const int destinosPorFuente = 16;
+    const int numFuentes = std::max(8, 2 * k);
+
+    std::vector<int> conAristas;
+    for (int v = 0; v < csr.numNodos; v++) {
+        if (csr.grado(v) > 0) {
+            conAristas.push_back(v);
+        }
+    }
+    if (conAristas.empty()) {
+        return elegirPorGrado(csr, k);
+    }
+
+    // Muestrear caminos mínimos: BFS desde fuentes aleatorias y
+    // reconstrucción hacia atrás con la transpuesta
+    GeneradorAleatorio rng(semilla);
+    EspacioBFS espacio(csr.numNodos);
+    std::vector<std::vector<int>> caminos;
+    for (int f = 0; f < numFuentes; f++) {
+        int fuente = conAristas[rng.acotado(static_cast<uint32_t>(conAristas.size()))];
+        bfsDistancias(csr, fuente, espacio);
+        if (espacio.visitados.size() < 2) {
+            continue;
+        }
+        for (int t = 0; t < destinosPorFuente; t++) {
+            uint32_t indice = 1 + rng.acotado(static_cast<uint32_t>(espacio.visitados.size() - 1));
+            int actual = espacio.visitados[indice];
+            std::vector<int> camino{actual};
+            while (actual != fuente) {
+                int nivel = espacio.distancia[actual];
+                for (int i = transpuesta.rowPtr[actual]; i < transpuesta.rowPtr[actual + 1]; i++) {
+                    if (espacio.distancia[transpuesta.columnas[i]] == nivel - 1) {
+                        actual = transpuesta.columnas[i];
+                        break;
+                    }
+                }
+                camino.push_back(actual);
+            }
+            caminos.push_back(std::move(camino));
+        }
+    }
+
+    // Selección voraz: el nodo presente en más caminos aún no cubiertos
+    std::vector<int> elegidos;
+    std::vector<bool> cubierto(caminos.size(), false);
+    std::vector<int> conteo(csr.numNodos, 0);
+    while (static_cast<int>(elegidos.size()) < k) {
+        std::fill(conteo.begin(), conteo.end(), 0);
+        for (size_t c = 0; c < caminos.size(); c++) {
+            if (!cubierto[c]) {
+                for (int v : caminos[c]) conteo[v]++;
+            }
+        }
+        int mejor = static_cast<int>(std::max_element(conteo.begin(), conteo.end()) - conteo.begin());
+        if (conteo[mejor] == 0) {
+            break;
+        }
+        elegidos.push_back(mejor);
+        for (size_t c = 0; c < caminos.size(); c++) {
+            if (!cubierto[c] && std::find(caminos[c].begin(), caminos[c].end(), mejor) != caminos[c].end()) {
+                cubierto[c] = true;
+            }
+        }
+    }
+
+    // Completar con nodos de mayor grado si los caminos no alcanzaron
+    for (int v : elegirPorGrado(csr, csr.numNodos)) {
+        if (static_cast<int>(elegidos.size()) >= k) {
+            break;
+        }
+        if (std::find(elegidos.begin(), elegidos.end(), v) == elegidos.end()) {
+            elegidos.push_back(v);
+        }
+    }
+    return elegidos;
+}
+
+bool OraculoLandmarks::construir(const GrafoDisperso& grafo, int numLandmarks,
+                                 EstrategiaLandmarks estrategia, uint64_t semilla) {
+    limpiar();
+
+    VistaCSR csr = grafo.vistaCSR();
+    if (csr.numNodos == 0 || numLandmarks <= 0) {
+        std::cerr << "[C++ Core] Error: No se puede construir el oraculo (grafo vacio o k invalido)." << std::endl;
+        return false;
+    }
+
+    std::cout << "[C++ Core] Construyendo oraculo de distancias con " << numLandmarks
+              << " landmarks (" << (estrategia == EstrategiaLandmarks::Grado ? "grado" : "cobertura")
+              << ")..." << std::endl;
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    transpuesta = grafo.vistaTranspuesta(rowPtrT, columnasT);
+    landmarks = estrategia == EstrategiaLandmarks::Grado
+        ? elegirPorGrado(csr, numLandmarks)
+        : elegirPorCobertura(csr, transpuesta, numLandmarks, semilla);
+
+    const int n = csr.numNodos;
+    const int numL = static_cast<int>(landmarks.size());
+    const uint16_t infinito = std::numeric_limits<uint16_t>::max();
+    desde16.assign(static_cast<size_t>(n) * numL, infinito);
+    hacia16.assign(static_cast<size_t>(n) * numL, infinito);
+
+    // Un BFS hacia adelante y otro hacia atrás por landmark, en paralelo
+    std::vector<std::unique_ptr<EspacioBFS>> espacios(numHilosDisponibles());
+    std::vector<int> maximoPorTarea(2 * numL, 0);
+    paraleloPara(2 * numL, 1, [&](int64_t desde, int64_t hasta, int hilo) {
+        if (!espacios[hilo]) {
+            espacios[hilo].reset(new EspacioBFS(n));
+        }
+        for (int64_t tarea = desde; tarea < hasta; tarea++) {
+            int i = static_cast<int>(tarea / 2);
+            bool adelante = tarea % 2 == 0;
+            int excentricidad = bfsDistancias(adelante ? csr : transpuesta, landmarks[i], *espacios[hilo]);
+            maximoPorTarea[tarea] = excentricidad;
+            if (excentricidad >= infinito) {
+                continue; // Se detecta abajo y se aborta la construcción
+            }
+            VectorIndice<uint16_t>& tabla = adelante ? desde16 : hacia16;
+            for (int v : espacios[hilo]->visitados) {
+                tabla[static_cast<size_t>(v) * numL + i] = static_cast<uint16_t>(espacios[hilo]->distancia[v]);
+            }
+        }
+    }, "OraculoLandmarks::construir", static_cast<int>(espacios.size()));
+
+    int maximo = *std::max_element(maximoPorTarea.begin(), maximoPorTarea.end());
+    if (maximo >= infinito) {
+        std::cerr << "[C++ Core] Error: Distancias demasiado largas para el oraculo." << std::endl;
+        limpiar();
+        return false;
+    }
+
+    if (maximo < std::numeric_limits<uint8_t>::max()) {
+        desde8 = reducirA8(desde16);
+        hacia8 = reducirA8(hacia16);
+        desde16.clear(); desde16.shrink_to_fit();
+        hacia16.clear(); hacia16.shrink_to_fit();
+        bytesPorDistancia = 1;
+    } else {
+        bytesPorDistancia = 2;
+    }
+
+    numNodos = n;
+    numAristas = csr.numAristas;
+    k = numL;
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+    std::cout << "[C++ Core] Oraculo construido. Distancias de " << bytesPorDistancia
+              << " byte(s), memoria: " << getMemoriaUsada() / (1024.0 * 1024.0)
+              << " MB. Tiempo: " << duration.count() << " ms." << std::endl;
+    return true;
+}
+
+template <typename T>
+CotasDistancia OraculoLandmarks::estimarCon(const VectorIndice<T>& desde, const VectorIndice<T>& hacia,
+                                            int u, int v) const {
+    const T infinito = std::numeric_limits<T>::max();
+    const T* desdeU = desde.data() + static_cast<size_t>(u) * k;  // d(L, u)
+    const T* haciaU = hacia.data() + static_cast<size_t>(u) * k;  // d(u, L)
+    const T* desdeV = desde.data() + static_cast<size_t>(v) * k;  // d(L, v)
+    const T* haciaV = hacia.data() + static_cast<size_t>(v) * k;  // d(v, L)
+
+    CotasDistancia cotas;
+    cotas.inferior = 1;
+    int mejor = INT_MAX;
+    for (int i = 0; i < k; i++) {
+        // d(u, v) <= d(u, L) + d(L, v)
+        if (haciaU[i] != infinito && desdeV[i] != infinito) {
+            mejor = std::min(mejor, haciaU[i] + desdeV[i]);
+        }
+        // d(L, v) <= d(L, u) + d(u, v)
+        if (desdeU[i] != infinito) {
+            if (desdeV[i] == infinito) {
+                cotas.inalcanzable = true;
+            } else {
+                cotas.inferior = std::max(cotas.inferior, desdeV[i] - desdeU[i]);
+            }
+        }
+        // d(u, L) <= d(u, v) + d(v, L)
+        if (haciaV[i] != infinito) {
+            if (haciaU[i] == infinito) {
+                cotas.inalcanzable = true;
+            } else {
+                cotas.inferior = std::max(cotas.inferior, haciaU[i] - haciaV[i]);
+            }
+        }
+    }
+
+    if (cotas.inalcanzable) {
+        cotas.inferior = -1;
+        cotas.superior = -1;
+    } else if (mejor != INT_MAX) {
+        cotas.superior = mejor;
+    }
+    return cotas;
+}
+
+CotasDistancia OraculoLandmarks::estimar(int u, int v) const {
+    CotasDistancia cotas;
+    if (k == 0 || u < 0 || v < 0 || u >= numNodos || v >= numNodos) {
+        cotas.inferior = -1;
+        return cotas;
+    }
+    if (u == v) {
+        cotas.superior = 0;
+        return cotas;
+    }
+    return bytesPorDistancia == 1 ? estimarCon(desde8, hacia8, u, v)
+                                  : estimarCon(desde16, hacia16, u, v);
+}
+
+CotasDistancia OraculoLandmarks::refinar(const GrafoDisperso& grafo, int u, int v, int64_t presupuesto) {
+    CotasDistancia cotas = estimar(u, v);
+    if (cotas.inferior < 0 || cotas.inalcanzable || cotas.inferior == cotas.superior) {
+        return cotas;
+    }
+    if (!coincideCon(grafo)) {
+        std::cerr << "[C++ Core] Error: El oraculo no corresponde al grafo cargado." << std::endl;
+        return cotas;
+    }
+
+    VistaCSR csr = grafo.vistaCSR();
+    if (transpuesta.rowPtr == nullptr) {
+        transpuesta = grafo.vistaTranspuesta(rowPtrT, columnasT);
+    }
+    if (static_cast<int>(espacioAdelante.distancia.size()) != numNodos) {
+        espacioAdelante = EspacioBFS(numNodos);
+        espacioAtras = EspacioBFS(numNodos);
+    }
+    espacioAdelante.reiniciar();
+    espacioAtras.reiniciar();
+
+    // BFS bidireccional por niveles completos, expandiendo el lado menor
+    espacioAdelante.distancia[u] = 0;
+    espacioAdelante.visitados.push_back(u);
+    espacioAtras.distancia[v] = 0;
+    espacioAtras.visitados.push_back(v);
+
+    size_t inicioAdelante = 0;
+    size_t inicioAtras = 0;
+    int nivelAdelante = 0;
+    int nivelAtras = 0;
+    int mejor = cotas.superior >= 0 ? cotas.superior : INT_MAX;
+    int64_t examinadas = 0;
+
+    while (true) {
+        // Sin encuentro hasta ahora: d(u, v) > nivelAdelante + nivelAtras
+        int minimo = nivelAdelante + nivelAtras + 1;
+        cotas.inferior = std::max(cotas.inferior, std::min(minimo, mejor));
+        if (minimo >= mejor) {
+            cotas.inferior = mejor;
+            cotas.superior = mejor;
+            return cotas;
+        }
+
+        bool frenteAdelanteVacio = inicioAdelante == espacioAdelante.visitados.size();
+        bool frenteAtrasVacio = inicioAtras == espacioAtras.visitados.size();
+        if (frenteAdelanteVacio || frenteAtrasVacio) {
+            // Un lado agotado ya etiquetó todo lo alcanzable: el mejor encuentro es exacto
+            if (mejor == INT_MAX) {
+                cotas.inferior = -1;
+                cotas.superior = -1;
+                cotas.inalcanzable = true;
+            } else {
+                cotas.inferior = mejor;
+                cotas.superior = mejor;
+            }
+            return cotas;
+        }
+        if (examinadas > presupuesto) {
+            if (mejor != INT_MAX) cotas.superior = mejor;
+            return cotas;
+        }
+
+        bool adelante = espacioAdelante.visitados.size() - inicioAdelante <=
+                        espacioAtras.visitados.size() - inicioAtras;
+        const VistaCSR& vista = adelante ? csr : transpuesta;
+        EspacioBFS& propio = adelante ? espacioAdelante : espacioAtras;
+        const EspacioBFS& otro = adelante ? espacioAtras : espacioAdelante;
+        size_t& inicioNivel = adelante ? inicioAdelante : inicioAtras;
+        int& nivel = adelante ? nivelAdelante : nivelAtras;
+
+        size_t finNivel = propio.visitados.size();
+        for (size_t idx = inicioNivel; idx < finNivel; idx++) {
+            int x = propio.visitados[idx];
+            for (int i = vista.rowPtr[x]; i < vista.rowPtr[x + 1]; i++) {
+                int y = vista.columnas[i];
+                examinadas++;
+                if (otro.distancia[y] >= 0) {
+                    mejor = std::min(mejor, nivel + 1 + otro.distancia[y]);
+                }
+                if (propio.distancia[y] < 0) {
+                    propio.distancia[y] = nivel + 1;
+                    propio.visitados.push_back(y);
+                }
+            }
+        }
+        inicioNivel = finNivel;
+        nivel++;
+    }
+}
+
+bool OraculoLandmarks::guardar(const std::string& ruta) const {
+    if (k == 0) {
+        std::cerr << "[C++ Core] Error: No hay oraculo construido para guardar." << std::endl;
+        return false;
+    }
+
+    std::ofstream archivo(ruta, std::ios::binary);
+    if (!archivo.is_open()) {
+        std::cerr << "[C++ Core] Error: No se pudo crear el archivo " << ruta << std::endl;
+        return false;
+    }
+
+    int32_t cabecera[4] = {numNodos, numAristas, k, bytesPorDistancia};
+    archivo.write(MAGIA_ORACULO, sizeof(MAGIA_ORACULO));
+    archivo.write(reinterpret_cast<const char*>(&VERSION_ORACULO), sizeof(VERSION_ORACULO));
+    archivo.write(reinterpret_cast<const char*>(cabecera), sizeof(cabecera));
+    escribirVector(archivo, landmarks);
+    if (bytesPorDistancia == 1) {
+        escribirVector(archivo, desde8);
+        escribirVector(archivo, hacia8);
+    } else {
+        escribirVector(archivo, desde16);
+        escribirVector(archivo, hacia16);
+    }
+
+    std::cout << "[C++ Core] Oraculo guardado en '" << ruta << "'." << std::endl;
+    return static_cast<bool>(archivo);
+}
+
+bool OraculoLandmarks::cargar(const std::string& ruta, const GrafoDisperso& grafo) {
+    std::ifstream archivo(ruta, std::ios::binary);
+    if (!archivo.is_open()) {
+        std::cerr << "[C++ Core] Error: No se pudo abrir el archivo " << ruta << std::endl;
+        return false;
+    }
+
+    char magia[4];
+    uint32_t version = 0;
+    int32_t cabecera[4];
+    archivo.read(magia, sizeof(magia));
+    archivo.read(reinterpret_cast<char*>(&version), sizeof(version));
+    archivo.read(reinterpret_cast<char*>(cabecera), sizeof(cabecera));
+    if (!archivo || std::memcmp(magia, MAGIA_ORACULO, sizeof(magia)) != 0 || version != VERSION_ORACULO) {
+        std::cerr << "[C++ Core] Error: '" << ruta << "' no es un oraculo valido." << std::endl;
+        return false;
+    }
+
+    limpiar();
+    numNodos = cabecera[0];
+    numAristas = cabecera[1];
+    bytesPorDistancia = cabecera[3];
+    if (!coincideCon(grafo) || cabecera[2] <= 0 || (bytesPorDistancia != 1 && bytesPorDistancia != 2)) {
+        std::cerr << "[C++ Core] Error: El oraculo no corresponde al grafo cargado." << std::endl;
+        limpiar();
+        return false;
+    }
+
+    size_t celdas = static_cast<size_t>(numNodos) * cabecera[2];
+    bool ok = leerVector(archivo, landmarks, cabecera[2]);
+    if (bytesPorDistancia == 1) {
+        ok = ok && leerVector(archivo, desde8, celdas) && leerVector(archivo, hacia8, celdas);
+    } else {
+        ok = ok && leerVector(archivo, desde16, celdas) && leerVector(archivo, hacia16, celdas);
+    }
+    if (!ok) {
+        std::cerr << "[C++ Core] Error: Archivo de oraculo truncado." << std::endl;
+        limpiar();
+        return false;
+    }
+
+    k = cabecera[2];
+    std::cout << "[C++ Core] Oraculo cargado desde '" << ruta << "' (" << k << " landmarks)." << std::endl;
+    return true;
+}
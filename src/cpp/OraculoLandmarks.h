@@ -0,0 +1,134 @@
+/**
+ * @file OraculoLandmarks.h
+ * @brief Oráculo de distancias aproximadas basado en landmarks
+ * @author NeuroNet Team
+ *
+ * Se precalculan las distancias dirigidas desde y hacia k nodos
+ * "landmark". Por la desigualdad triangular, cualquier consulta
+ * distancia(u, v) queda acotada en O(k) leyendo dos bloques contiguos
+ * de k distancias. Las cotas pueden refinarse con un BFS bidireccional
+ * con presupuesto, que se detiene en cuanto las cotas se cierran.
+ */
+
+#ifndef ORACULO_LANDMARKS_H
+#define ORACULO_LANDMARKS_H
+
+#include "GrafoDisperso.h"
+#include "RecorridoBFS.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Criterio de selección de landmarks
+ */
+enum class EstrategiaLandmarks {
+    Grado = 0,     ///< Los k nodos de mayor grado total
+    Cobertura = 1  ///< Los nodos que cubren más caminos mínimos muestreados
+};
+
+/**
+ * @struct CotasDistancia
+ * @brief Intervalo que contiene la distancia dirigida d(u, v)
+ *
+ * superior = -1 indica que no se conoce cota superior. Si se demostró
+ * que v no es alcanzable desde u, inalcanzable = true.
+ */
+struct CotasDistancia {
+    int inferior = 0;
+    int superior = -1;
+    bool inalcanzable = false;
+};
+
+/**
+ * @class OraculoLandmarks
+ * @brief Índice compacto de distancias a k landmarks
+ *
+ * Las distancias se guardan como uint8 si la mayor distancia cabe en un
+ * byte y como uint16 en otro caso, en disposición nodo-mayor (las k
+ * distancias de un nodo son contiguas).
+ */
+class OraculoLandmarks {
+public:
+    OraculoLandmarks();
+
+    /**
+     * @brief Construye el índice para un grafo
+     * @param grafo Grafo a indexar
+     * @param k Número de landmarks
+     * @param estrategia Criterio de selección
+     * @param semilla Semilla del muestreo (estrategia Cobertura)
+     * @return true si la construcción fue exitosa
+     */
+    bool construir(const GrafoDisperso& grafo, int k, EstrategiaLandmarks estrategia,
+                   uint64_t semilla = 42);
+
+    /**
+     * @brief Cotas de d(u, v) en O(k) usando solo el índice
+     */
+    CotasDistancia estimar(int u, int v) const;
+
+    /**
+     * @brief Refina las cotas con un BFS bidireccional acotado
+     * @param grafo Grafo indexado (se valida que coincida con el índice)
+     * @param u Nodo origen
+     * @param v Nodo destino
+     * @param presupuesto Máximo de aristas a examinar
+     * @return Cotas refinadas; inferior == superior si la distancia es exacta
+     */
+    CotasDistancia refinar(const GrafoDisperso& grafo, int u, int v, int64_t presupuesto);
+
+    /**
+     * @brief Guarda el índice en un archivo binario
+     */
+    bool guardar(const std::string& ruta) const;
+
+    /**
+     * @brief Carga un índice guardado, validando que corresponda al grafo
+     */
+    bool cargar(const std::string& ruta, const GrafoDisperso& grafo);
+
+    /**
+     * @brief Descarta el índice (por ejemplo, al recargar el grafo)
+     */
+    void limpiar();
+
+    bool estaConstruido() const { return k > 0; }
+    int getNumLandmarks() const { return k; }
+    int getBytesPorDistancia() const { return bytesPorDistancia; }
+    const std::vector<int>& getLandmarks() const { return landmarks; }
+
+    /**
+     * @brief Memoria ocupada por las tablas de distancias
+     */
+    size_t getMemoriaUsada() const;
+
+private:
+    int numNodos;
+    int numAristas;
+    int k;
+    int bytesPorDistancia;
+    std::vector<int> landmarks;
+
+    // Tablas nodo-mayor: [v * k + i] = distancia entre v y el landmark i
+    VectorIndice<uint8_t> desde8, hacia8;
+    VectorIndice<uint16_t> desde16, hacia16;
+
+    // Transpuesta y espacios del refinamiento (se crean al construir o al primer uso)
+    VectorIndice<int> rowPtrT, columnasT;
+    VistaCSR transpuesta;
+    EspacioBFS espacioAdelante;
+    EspacioBFS espacioAtras;
+
+    bool coincideCon(const GrafoDisperso& grafo) const;
+
+    template <typename T>
+    CotasDistancia estimarCon(const VectorIndice<T>& desde, const VectorIndice<T>& hacia,
+                              int u, int v) const;
+
+    static std::vector<int> elegirPorGrado(const VistaCSR& csr, int k);
+    static std::vector<int> elegirPorCobertura(const VistaCSR& csr, const VistaCSR& transpuesta,
+                                               int k, uint64_t semilla);
+};
+
+#endif // ORACULO_LANDMARKS_H
@@ -0,0 +1,95 @@
+/**
+ * @file Paralelo.h
+ * @brief Utilidades mínimas de paralelismo para los motores de análisis
+ * @author NeuroNet Team
+ *
+ * Reparte un rango de iteraciones en bloques sobre el pool de hilos del
+ * proceso (PoolHilos), que equilibra la carga robando bloques entre
+ * hilos, de modo que nodos con grados muy distintos no desbalanceen el
+ * trabajo y ninguna llamada crea hilos propios.
+ */
+
+#ifndef PARALELO_H
+#define PARALELO_H
+
+#include "PoolHilos.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Número de hilos de trabajo a utilizar por los núcleos paralelos
+ * @return Participantes del pool del proceso (al menos 1)
+ */
+inline int numHilosDisponibles() {
+    return PoolHilos::instancia().getNumHilos();
+}
+
+/**
+ * @brief Ejecuta cuerpo(inicio, fin, hilo) sobre bloques de [0, total)
+ * @param total Número de iteraciones
+ * @param bloque Tamaño de cada bloque (los bloques empiezan en múltiplos de bloque)
+ * @param cuerpo Función invocada con el subrango y el índice del hilo
+ * @param nombre Nombre de la región para el gancho de medición del pool
+ * @param maxHilos Si es > 0, el índice de hilo queda en [0, maxHilos)
+ *
+ * El hilo que llama participa como hilo 0. Para indexar espacios de
+ * trabajo por hilo, pasar su tamaño en maxHilos: el pool se puede
+ * redimensionar entre la llamada a numHilosDisponibles() que los
+ * dimensionó y el comienzo de la región.
+ */
+template <typename Funcion>
+void paraleloPara(int64_t total, int64_t bloque, Funcion cuerpo,
+                  const char* nombre = "paraleloPara", int maxHilos = 0) {
+    if (total <= 0) {
+        return;
+    }
+    bloque = std::max<int64_t>(1, bloque);
+
+    struct Datos {
+        Funcion* cuerpo;
+        int64_t total;
+        int64_t bloque;
+    } datos{&cuerpo, total, bloque};
+
+    auto trampolin = [](void* puntero, int64_t b, int hilo) {
+        Datos* d = static_cast<Datos*>(puntero);
+        int64_t inicio = b * d->bloque;
+        (*d->cuerpo)(inicio, std::min(d->total, inicio + d->bloque), hilo);
+    };
+    PoolHilos::instancia().ejecutar((total + bloque - 1) / bloque, trampolin, &datos, nombre,
+                                    maxHilos);
+}
+
+/**
+ * @brief Reducción paralela: combina cuerpo(inicio, fin) de cada bloque
+ * @param identidad Valor neutro de combinar
+ * @param cuerpo Función T(inicio, fin) que reduce un bloque
+ * @param combinar Función T(T, T) asociativa
+ * @return Reducción de todos los bloques
+ *
+ * Los parciales se combinan en el orden de los bloques, así que el
+ * resultado no depende del reparto entre hilos (ni siquiera con sumas
+ * en coma flotante).
+ */
+template <typename T, typename Funcion, typename Combinar>
+T paraleloReducir(int64_t total, int64_t bloque, T identidad, Funcion cuerpo, Combinar combinar,
+                  const char* nombre = "paraleloReducir") {
+    if (total <= 0) {
+        return identidad;
+    }
+    bloque = std::max<int64_t>(1, bloque);
+
+    std::vector<T> parciales((total + bloque - 1) / bloque, identidad);
+    paraleloPara(total, bloque, [&](int64_t desde, int64_t hasta, int) {
+        parciales[desde / bloque] = cuerpo(desde, hasta);
+    }, nombre);
+
+    T resultado = identidad;
+    for (const T& parcial : parciales) {
+        resultado = combinar(resultado, parcial);
+    }
+    return resultado;
+}
+
+#endif // PARALELO_H
@@ -0,0 +1,642 @@
+/**
+ * @file ParticionGrafo.cpp
+ * @brief Implementación de los particionadores y sus métricas
+ * @author NeuroNet Team
+ */
+
+#include "ParticionGrafo.h"
+#include "Aleatorio.h"
+#include "Paralelo.h"
+#include <algorithm>
+#include <bitset>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <numeric>
+
+namespace {
+
+const char* nombreMetodo(MetodoParticion metodo) {
+    switch (metodo) {
+        case MetodoParticion::LDG: return "LDG";
+        case MetodoParticion::Fennel: return "Fennel";
+        case MetodoParticion::HDRF: return "HDRF";
+        case MetodoParticion::Multinivel: return "Multinivel";
+    }
+    return "?";
+}
+
+/**
+ * @brief Capacidad de cada partición: ceil(desbalance * total / P), nunca menor que ceil(total / P)
+ */
+int64_t capacidad(int64_t total, int particiones, double desbalance) {
+    int64_t minima = (total + particiones - 1) / particiones;
+    int64_t pedida = static_cast<int64_t>(std::ceil(desbalance * static_cast<double>(total) / particiones));
+    return std::max(minima, pedida);
+}
+
+void barajar(std::vector<int>& valores, GeneradorAleatorio& rng) {
+    for (size_t i = valores.size(); i > 1; i--) {
+        std::swap(valores[i - 1], valores[rng.acotado(static_cast<uint32_t>(i))]);
+    }
+}
+
+/**
+ * @brief Peso de los vecinos en cada partición, con lista de las particiones tocadas
+ */
+struct ConteoParticiones {
+    std::vector<int64_t> cuenta;
+    std::vector<int> tocadas;
+
+    explicit ConteoParticiones(int particiones) : cuenta(particiones, 0) {}
+
+    void sumar(int p, int64_t peso) {
+        if (cuenta[p] == 0) {
+            tocadas.push_back(p);
+        }
+        cuenta[p] += peso;
+    }
+
+    void limpiar() {
+        for (int p : tocadas) {
+            cuenta[p] = 0;
+        }
+        tocadas.clear();
+    }
+};
+
+/**
+ * @brief Grafo no dirigido con pesos en nodos y aristas (niveles del multinivel)
+ */
+struct GrafoPonderado {
+    std::vector<int> rowPtr;
+    std::vector<int> adyacentes;
+    std::vector<int> pesoArista;
+    std::vector<int> pesoNodo;
+
+    int numNodos() const { return static_cast<int>(pesoNodo.size()); }
+};
+
+/**
+ * @brief Contrae un emparejamiento de aristas pesadas
+ * @param mapa Salida: nodo grueso de cada nodo fino
+ * @return false si el grafo apenas se reduce (el engrosamiento se detiene)
+ *
+ * Los nodos se visitan en orden aleatorio y cada uno se empareja con el
+ * vecino libre de arista más pesada, sin que la pareja supere pesoMaximo.
+ */
+bool engrosar(const GrafoPonderado& fino, int64_t pesoMaximo, GeneradorAleatorio& rng,
+              GrafoPonderado& grueso, std::vector<int>& mapa) {
+    int n = fino.numNodos();
+    std::vector<int> orden(n);
+    std::iota(orden.begin(), orden.end(), 0);
+    barajar(orden, rng);
+
+    std::vector<int> pareja(n, -1);
+    for (int v : orden) {
+        if (pareja[v] >= 0) {
+            continue;
+        }
+        int mejor = v;
+        int mejorPeso = 0;
+        for (int k = fino.rowPtr[v]; k < fino.rowPtr[v + 1]; k++) {
+            int u = fino.adyacentes[k];
+            if (pareja[u] < 0 && u != v && fino.pesoArista[k] > mejorPeso &&
+                int64_t(fino.pesoNodo[v]) + fino.pesoNodo[u] <= pesoMaximo) {
+                mejor = u;
+                mejorPeso = fino.pesoArista[k];
+            }
+        }
+        pareja[v] = mejor;
+        pareja[mejor] = v;
+    }
+
+    mapa.assign(n, -1);
+    std::vector<int> primero;
+    std::vector<int> segundo;
+    for (int v = 0; v < n; v++) {
+        if (mapa[v] < 0) {
+            mapa[v] = mapa[pareja[v]] = static_cast<int>(primero.size());
+            primero.push_back(v);
+            segundo.push_back(pareja[v] != v ? pareja[v] : -1);
+        }
+    }
+    int nc = static_cast<int>(primero.size());
+    if (nc > 0.95 * n) {
+        return false;
+    }
+
+    // Aristas gruesas: se suman los pesos hacia cada nodo grueso vecino
+    grueso.rowPtr.assign(nc + 1, 0);
+    grueso.pesoNodo.resize(nc);
+    grueso.adyacentes.clear();
+    grueso.pesoArista.clear();
+    ConteoParticiones acumulado(nc);
+    for (int c = 0; c < nc; c++) {
+        grueso.pesoNodo[c] = fino.pesoNodo[primero[c]];
+        if (segundo[c] >= 0) {
+            grueso.pesoNodo[c] += fino.pesoNodo[segundo[c]];
+        }
+        for (int miembro : {primero[c], segundo[c]}) {
+            if (miembro < 0) {
+                continue;
+            }
+            for (int k = fino.rowPtr[miembro]; k < fino.rowPtr[miembro + 1]; k++) {
+                int d = mapa[fino.adyacentes[k]];
+                if (d != c) {
+                    acumulado.sumar(d, fino.pesoArista[k]);
+                }
+            }
+        }
+        for (int d : acumulado.tocadas) {
+            grueso.adyacentes.push_back(d);
+            grueso.pesoArista.push_back(static_cast<int>(acumulado.cuenta[d]));
+        }
+        acumulado.limpiar();
+        grueso.rowPtr[c + 1] = static_cast<int>(grueso.adyacentes.size());
+    }
+    return true;
+}
+
+/**
+ * @brief Partición del grafo más grueso: LDG ponderado en orden BFS
+ *
+ * Recorrer en anchura hace que cada partición crezca como una región
+ * conexa hasta llenarse; las semillas se eligen al azar.
+ */
+void particionInicial(const GrafoPonderado& g, int particiones, int64_t limite, GeneradorAleatorio& rng,
+                      std::vector<int>& asignacion, std::vector<int64_t>& carga) {
+    int n = g.numNodos();
+    std::vector<int> semillas(n);
+    std::iota(semillas.begin(), semillas.end(), 0);
+    barajar(semillas, rng);
+
+    std::vector<int> orden;
+    std::vector<char> visto(n, 0);
+    for (int s : semillas) {
+        if (visto[s]) {
+            continue;
+        }
+        visto[s] = 1;
+        size_t cabeza = orden.size();
+        orden.push_back(s);
+        while (cabeza < orden.size()) {
+            int v = orden[cabeza++];
+            for (int k = g.rowPtr[v]; k < g.rowPtr[v + 1]; k++) {
+                int u = g.adyacentes[k];
+                if (!visto[u]) {
+                    visto[u] = 1;
+                    orden.push_back(u);
+                }
+            }
+        }
+    }
+
+    asignacion.assign(n, -1);
+    carga.assign(particiones, 0);
+    ConteoParticiones conteo(particiones);
+    for (int v : orden) {
+        for (int k = g.rowPtr[v]; k < g.rowPtr[v + 1]; k++) {
+            int p = asignacion[g.adyacentes[k]];
+            if (p >= 0) {
+                conteo.sumar(p, g.pesoArista[k]);
+            }
+        }
+        int mejor = -1;
+        double mejorValor = -1.0;
+        int menosCargada = 0;
+        for (int p = 0; p < particiones; p++) {
+            if (carga[p] < carga[menosCargada]) {
+                menosCargada = p;
+            }
+            if (carga[p] + g.pesoNodo[v] > limite) {
+                continue;
+            }
+            double valor = conteo.cuenta[p] * (1.0 - static_cast<double>(carga[p]) / limite);
+            if (valor > mejorValor || (valor == mejorValor && carga[p] < carga[mejor])) {
+                mejor = p;
+                mejorValor = valor;
+            }
+        }
+        if (mejor < 0) {
+            mejor = menosCargada;
+        }
+        asignacion[v] = mejor;
+        carga[mejor] += g.pesoNodo[v];
+        conteo.limpiar();
+    }
+}
+
+/**
+ * @brief Refinamiento voraz de la frontera
+ *
+ * Cada nodo se mueve a la partición vecina que más reduce el corte sin
+ * pasar del límite; con ganancia nula solo si mejora el balance. Se
+ * detiene cuando una pasada mueve menos del 0.1% de los nodos. Un
+ * nodo de una partición sobrecargada puede moverse aunque empeore el
+ * corte, para recuperar el balance al proyectar niveles gruesos.
+ */
+void refinar(const GrafoPonderado& g, int particiones, int64_t limite, int pasadas, GeneradorAleatorio& rng,
+             std::vector<int>& asignacion, std::vector<int64_t>& carga) {
+    int n = g.numNodos();
+    std::vector<int> orden(n);
+    std::iota(orden.begin(), orden.end(), 0);
+    barajar(orden, rng);
+    ConteoParticiones conteo(particiones);
+
+    for (int pasada = 0; pasada < pasadas; pasada++) {
+        int64_t movidos = 0;
+        for (int v : orden) {
+            int propio = asignacion[v];
+            int64_t peso = g.pesoNodo[v];
+            bool exceso = carga[propio] > limite;
+            for (int k = g.rowPtr[v]; k < g.rowPtr[v + 1]; k++) {
+                conteo.sumar(asignacion[g.adyacentes[k]], g.pesoArista[k]);
+            }
+            if (exceso) {
+                int menosCargada = static_cast<int>(
+                    std::min_element(carga.begin(), carga.end()) - carga.begin());
+                if (conteo.cuenta[menosCargada] == 0) {
+                    conteo.tocadas.push_back(menosCargada);
+                }
+            }
+
+            int mejor = exceso ? -1 : propio;
+            int64_t mejorGanancia = exceso ? std::numeric_limits<int64_t>::min() : 0;
+            int64_t mejorCarga = carga[propio];
+            for (int p : conteo.tocadas) {
+                if (p == propio || carga[p] + peso > limite) {
+                    continue;
+                }
+                int64_t ganancia = conteo.cuenta[p] - conteo.cuenta[propio];
+                int64_t cargaTras = carga[p] + peso;
+                if (ganancia > mejorGanancia || (ganancia == mejorGanancia && cargaTras < mejorCarga)) {
+                    mejor = p;
+                    mejorGanancia = ganancia;
+                    mejorCarga = cargaTras;
+                }
+            }
+            if (mejor >= 0 && mejor != propio) {
+                asignacion[v] = mejor;
+                carga[propio] -= peso;
+                carga[mejor] += peso;
+                movidos++;
+            }
+            conteo.limpiar();
+        }
+        if (movidos <= n / 1000) {
+            break;
+        }
+    }
+}
+
+} // namespace
+
+ParticionadorGrafo::ParticionadorGrafo(const GrafoDisperso& grafo) : csr(grafo.vistaCSR()) {
+    grafo.vistaNoDirigida(rowPtrND, columnasND);
+}
+
+std::vector<int> ParticionadorGrafo::ordenNodos(const ParametrosParticion& parametros) const {
+    std::vector<int> orden(csr.numNodos);
+    std::iota(orden.begin(), orden.end(), 0);
+    if (parametros.ordenAleatorio) {
+        GeneradorAleatorio rng(parametros.semilla, 1);
+        barajar(orden, rng);
+    }
+    return orden;
+}
+
+void ParticionadorGrafo::streamingNodos(const ParametrosParticion& parametros,
+                                        std::vector<int>& asignacion) const {
+    const int P = parametros.particiones;
+    const int n = csr.numNodos;
+    const int64_t limite = capacidad(n, P, parametros.desbalanceMaximo);
+    const bool fennel = parametros.metodo == MetodoParticion::Fennel;
+
+    // Fennel: coste alpha * gamma * |P_i|^(gamma - 1), con alpha = m * P^(gamma - 1) / n^gamma
+    const double gamma = parametros.gamma;
+    const double aristas = static_cast<double>(columnasND.size()) / 2.0;
+    const double alpha = aristas * std::pow(P, gamma - 1.0) / std::pow(std::max(n, 1), gamma);
+    std::vector<int64_t> carga(P, 0);
+    std::vector<double> penalizacion(P, 0.0);
+
+    asignacion.assign(n, -1);
+    ConteoParticiones conteo(P);
+    for (int v : ordenNodos(parametros)) {
+        for (int k = rowPtrND[v]; k < rowPtrND[v + 1]; k++) {
+            int p = asignacion[columnasND[k]];
+            if (p >= 0) {
+                conteo.sumar(p, 1);
+            }
+        }
+        int mejor = -1;
+        double mejorValor = -std::numeric_limits<double>::infinity();
+        for (int p = 0; p < P; p++) {
+            if (carga[p] >= limite) {
+                continue;
+            }
+            double valor = fennel ? conteo.cuenta[p] - penalizacion[p]
+                                  : conteo.cuenta[p] * (1.0 - static_cast<double>(carga[p]) / limite);
+            if (valor > mejorValor || (valor == mejorValor && carga[p] < carga[mejor])) {
+                mejor = p;
+                mejorValor = valor;
+            }
+        }
+        asignacion[v] = mejor;
+        carga[mejor]++;
+        if (fennel) {
+            penalizacion[mejor] = alpha * gamma * std::pow(static_cast<double>(carga[mejor]), gamma - 1.0);
+        }
+        conteo.limpiar();
+    }
+}
+
+void ParticionadorGrafo::hdrf(const ParametrosParticion& parametros, std::vector<int>& asignacionAristas,
+                              std::vector<int>& asignacionNodos) const {
+    const int P = parametros.particiones;
+    const int n = csr.numNodos;
+    const int palabras = (P + 63) / 64;
+    const double epsilon = 1.0;
+
+    // Réplicas de cada nodo: palabras bits por nodo
+    std::vector<uint64_t> replicas(static_cast<size_t>(n) * palabras, 0);
+    auto tiene = [&](int v, int p) {
+        return (replicas[static_cast<size_t>(v) * palabras + p / 64] >> (p % 64)) & 1;
+    };
+    std::vector<int> gradoParcial(n, 0);
+    std::vector<int64_t> carga(P, 0);
+    int64_t cargaMaxima = 0;
+    int64_t cargaMinima = 0;
+    int enMinimo = P;   // particiones con carga == cargaMinima
+
+    asignacionAristas.assign(csr.numAristas, -1);
+    for (int u : ordenNodos(parametros)) {
+        for (int k = csr.rowPtr[u]; k < csr.rowPtr[u + 1]; k++) {
+            int v = csr.columnas[k];
+            gradoParcial[u]++;
+            if (v != u) {
+                gradoParcial[v]++;
+            }
+            double thetaU = static_cast<double>(gradoParcial[u]) / (gradoParcial[u] + gradoParcial[v]);
+            double thetaV = 1.0 - thetaU;
+
+            int mejor = 0;
+            double mejorValor = -std::numeric_limits<double>::infinity();
+            for (int p = 0; p < P; p++) {
+                double replicacion = (tiene(u, p) ? 2.0 - thetaU : 0.0) + (tiene(v, p) ? 2.0 - thetaV : 0.0);
+                double balance = parametros.pesoBalance * (cargaMaxima - carga[p]) /
+                                 (epsilon + cargaMaxima - cargaMinima);
+                double valor = replicacion + balance;
+                if (valor > mejorValor || (valor == mejorValor && carga[p] < carga[mejor])) {
+                    mejor = p;
+                    mejorValor = valor;
+                }
+            }
+
+            asignacionAristas[k] = mejor;
+            replicas[static_cast<size_t>(u) * palabras + mejor / 64] |= uint64_t(1) << (mejor % 64);
+            replicas[static_cast<size_t>(v) * palabras + mejor / 64] |= uint64_t(1) << (mejor % 64);
+            if (carga[mejor] == cargaMinima && --enMinimo == 0) {
+                carga[mejor]++;
+                cargaMinima = *std::min_element(carga.begin(), carga.end());
+                enMinimo = static_cast<int>(std::count(carga.begin(), carga.end(), cargaMinima));
+            } else {
+                carga[mejor]++;
+            }
+            cargaMaxima = std::max(cargaMaxima, carga[mejor]);
+        }
+    }
+
+    // Réplica maestra: una de las réplicas elegida por el ID (reparte los
+    // nodos sin favorecer las particiones bajas); sin aristas, v mod P
+    asignacionNodos.assign(n, 0);
+    for (int v = 0; v < n; v++) {
+        int total = 0;
+        for (int w = 0; w < palabras; w++) {
+            total += static_cast<int>(std::bitset<64>(replicas[static_cast<size_t>(v) * palabras + w]).count());
+        }
+        if (total == 0) {
+            asignacionNodos[v] = v % P;
+            continue;
+        }
+        int elegida = v % total;
+        for (int p = 0; p < P; p++) {
+            if (tiene(v, p) && elegida-- == 0) {
+                asignacionNodos[v] = p;
+                break;
+            }
+        }
+    }
+}
+
+void ParticionadorGrafo::multinivel(const ParametrosParticion& parametros, std::vector<int>& asignacion) const {
+    const int P = parametros.particiones;
+    const int n = csr.numNodos;
+    const int64_t limite = capacidad(n, P, parametros.desbalanceMaximo);
+    GeneradorAleatorio rng(parametros.semilla);
+
+    std::vector<GrafoPonderado> niveles(1);
+    niveles[0].rowPtr.assign(rowPtrND.begin(), rowPtrND.end());
+    niveles[0].adyacentes.assign(columnasND.begin(), columnasND.end());
+    niveles[0].pesoArista.assign(columnasND.size(), 1);
+    niveles[0].pesoNodo.assign(n, 1);
+    std::vector<std::vector<int>> mapas;
+
+    // Engrosar hasta unas decenas de nodos por partición; ningún nodo
+    // grueso pesa más de un cuarto de la capacidad
+    const int umbral = std::max(20 * P, 200);
+    const int64_t pesoMaximo = std::max<int64_t>(1, limite / 4);
+    while (niveles.back().numNodos() > umbral) {
+        GrafoPonderado grueso;
+        std::vector<int> mapa;
+        if (!engrosar(niveles.back(), pesoMaximo, rng, grueso, mapa)) {
+            break;
+        }
+        niveles.push_back(std::move(grueso));
+        mapas.push_back(std::move(mapa));
+    }
+
+    std::vector<int64_t> carga;
+    particionInicial(niveles.back(), P, limite, rng, asignacion, carga);
+    refinar(niveles.back(), P, limite, 8, rng, asignacion, carga);
+
+    // Deshacer el engrosamiento: proyectar y refinar en cada nivel
+    for (size_t nivel = mapas.size(); nivel > 0; nivel--) {
+        const std::vector<int>& mapa = mapas[nivel - 1];
+        std::vector<int> fina(mapa.size());
+        for (size_t v = 0; v < mapa.size(); v++) {
+            fina[v] = asignacion[mapa[v]];
+        }
+        asignacion.swap(fina);
+        niveles.pop_back();
+        refinar(niveles.back(), P, limite, 8, rng, asignacion, carga);
+    }
+}
+
+bool ParticionadorGrafo::particionar(const ParametrosParticion& parametros, ResultadoParticion& resultado) {
+    std::cout << "[C++ Core] Particionando grafo con " << nombreMetodo(parametros.metodo) << " en "
+              << parametros.particiones << " particiones..." << std::endl;
+
+    if (csr.numNodos == 0) {
+        std::cerr << "[C++ Core] Error: El grafo esta vacio." << std::endl;
+        return false;
+    }
+    if (parametros.particiones < 1 || parametros.particiones > csr.numNodos) {
+        std::cerr << "[C++ Core] Error: Numero de particiones invalido (debe estar entre 1 y el "
+                  << "numero de nodos)." << std::endl;
+        return false;
+    }
+    if (!(parametros.desbalanceMaximo >= 1.0) || !(parametros.gamma > 1.0) || !(parametros.pesoBalance >= 0.0)) {
+        std::cerr << "[C++ Core] Error: Parametros de particion invalidos (desbalance >= 1, gamma > 1, "
+                  << "peso de balance >= 0)." << std::endl;
+        return false;
+    }
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    resultado = ResultadoParticion();
+    bool ok;
+    switch (parametros.metodo) {
+        case MetodoParticion::HDRF:
+            hdrf(parametros, resultado.asignacionAristas, resultado.asignacionNodos);
+            ok = evaluarAristas(resultado.asignacionAristas, parametros.particiones, resultado.metricas);
+            break;
+        case MetodoParticion::Multinivel:
+            multinivel(parametros, resultado.asignacionNodos);
+            ok = evaluarNodos(resultado.asignacionNodos, parametros.particiones, resultado.metricas);
+            break;
+        default:
+            streamingNodos(parametros, resultado.asignacionNodos);
+            ok = evaluarNodos(resultado.asignacionNodos, parametros.particiones, resultado.metricas);
+            break;
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+
+    const MetricasParticion& m = resultado.metricas;
+    std::cout << "[C++ Core] Particion completada. Corte: " << m.aristasCortadas << " ("
+              << m.fraccionCorte * 100.0 << "%) | Replicacion: " << m.factorReplicacion
+              << " | Desbalance: " << m.desbalance << ". Tiempo ejecucion: " << duration.count()
+              << " ms." << std::endl;
+
+    return ok;
+}
+
+bool ParticionadorGrafo::evaluarNodos(const std::vector<int>& asignacion, int particiones,
+                                      MetricasParticion& metricas) const {
+    const int n = csr.numNodos;
+    if (static_cast<int64_t>(asignacion.size()) != n || particiones < 1) {
+        std::cerr << "[C++ Core] Error: La asignacion debe tener una entrada por nodo." << std::endl;
+        return false;
+    }
+    metricas = MetricasParticion();
+    metricas.particiones = particiones;
+    metricas.carga.assign(particiones, 0);
+    for (int p : asignacion) {
+        if (p < 0 || p >= particiones) {
+            std::cerr << "[C++ Core] Error: Particion fuera de rango en la asignacion." << std::endl;
+            return false;
+        }
+        metricas.carga[p]++;
+    }
+
+    metricas.aristasCortadas = paraleloReducir<int64_t>(n, 4096, 0, [&](int64_t desde, int64_t hasta) {
+        int64_t cortadas = 0;
+        for (int64_t u = desde; u < hasta; u++) {
+            for (int k = csr.rowPtr[u]; k < csr.rowPtr[u + 1]; k++) {
+                cortadas += asignacion[csr.columnas[k]] != asignacion[u];
+            }
+        }
+        return cortadas;
+    }, [](int64_t a, int64_t b) { return a + b; }, "ParticionadorGrafo::evaluarNodos");
+    metricas.fraccionCorte = csr.numAristas > 0
+        ? static_cast<double>(metricas.aristasCortadas) / csr.numAristas : 0.0;
+
+    // Copias de cada nodo: su partición y las de sus vecinos (fantasmas)
+    std::vector<int> marca(particiones, -1);
+    int64_t copias = 0;
+    for (int v = 0; v < n; v++) {
+        int distintas = 1;
+        marca[asignacion[v]] = v;
+        for (int k = rowPtrND[v]; k < rowPtrND[v + 1]; k++) {
+            int p = asignacion[columnasND[k]];
+            if (marca[p] != v) {
+                marca[p] = v;
+                distintas++;
+            }
+        }
+        copias += distintas;
+        metricas.nodosFrontera += distintas > 1;
+    }
+    metricas.factorReplicacion = n > 0 ? static_cast<double>(copias) / n : 1.0;
+    metricas.desbalance = n > 0
+        ? *std::max_element(metricas.carga.begin(), metricas.carga.end()) *
+              static_cast<double>(particiones) / n
+        : 1.0;
+    return true;
+}
+
+bool ParticionadorGrafo::evaluarAristas(const std::vector<int>& asignacion, int particiones,
+                                        MetricasParticion& metricas) const {
+    const int n = csr.numNodos;
+    if (static_cast<int64_t>(asignacion.size()) != csr.numAristas || particiones < 1) {
+        std::cerr << "[C++ Core] Error: La asignacion debe tener una entrada por arista." << std::endl;
+        return false;
+    }
+    metricas = MetricasParticion();
+    metricas.particiones = particiones;
+    metricas.carga.assign(particiones, 0);
+    for (int p : asignacion) {
+        if (p < 0 || p >= particiones) {
+            std::cerr << "[C++ Core] Error: Particion fuera de rango en la asignacion." << std::endl;
+            return false;
+        }
+        metricas.carga[p]++;
+    }
+
+    const int palabras = (particiones + 63) / 64;
+    std::vector<uint64_t> replicas(static_cast<size_t>(n) * palabras, 0);
+    for (int u = 0; u < n; u++) {
+        for (int k = csr.rowPtr[u]; k < csr.rowPtr[u + 1]; k++) {
+            int p = asignacion[k];
+            replicas[static_cast<size_t>(u) * palabras + p / 64] |= uint64_t(1) << (p % 64);
+            replicas[static_cast<size_t>(csr.columnas[k]) * palabras + p / 64] |= uint64_t(1) << (p % 64);
+        }
+    }
+    int64_t copias = 0;
+    int64_t conAristas = 0;
+    for (int v = 0; v < n; v++) {
+        int64_t total = 0;
+        for (int w = 0; w < palabras; w++) {
+            total += static_cast<int64_t>(std::bitset<64>(replicas[static_cast<size_t>(v) * palabras + w]).count());
+        }
+        copias += total;
+        conAristas += total > 0;
+        metricas.nodosFrontera += total > 1;
+    }
+    metricas.factorReplicacion = conAristas > 0 ? static_cast<double>(copias) / conAristas : 1.0;
+    metricas.desbalance = csr.numAristas > 0
+        ? *std::max_element(metricas.carga.begin(), metricas.carga.end()) *
+              static_cast<double>(particiones) / csr.numAristas
+        : 1.0;
+    return true;
+}
+
+bool ParticionadorGrafo::escribirAsignacion(const std::vector<int>& asignacion, const std::string& ruta) {
+    std::ofstream salida(ruta);
+    if (!salida) {
+        std::cerr << "[C++ Core] Error: No se pudo escribir la asignacion en '" << ruta << "'." << std::endl;
+        return false;
+    }
+    std::string texto;
+    texto.reserve(asignacion.size() * 3);
+    for (int p : asignacion) {
+        texto += std::to_string(p);
+        texto += '\n';
+    }
+    salida.write(texto.data(), static_cast<std::streamsize>(texto.size()));
+    return static_cast<bool>(salida);
+}
@@ -0,0 +1,134 @@
+/**
+ * @file ParticionGrafo.h
+ * @brief Particionadores de grafo (por nodos y por aristas) y métricas de calidad
+ * @author NeuroNet Team
+ *
+ * Antes de repartir un grafo entre procesos (GrafoParticionado) conviene
+ * una partición mejor que el orden de IDs del archivo. Los métodos:
+ * - LDG y Fennel: particionado de nodos en streaming (una pasada en el
+ *   orden de los nodos; cada nodo va a la partición donde ya están más
+ *   vecinos suyos, penalizada por su tamaño).
+ * - HDRF: particionado de aristas en streaming (vertex-cut); replica
+ *   primero los nodos de grado alto, que son los que más aristas comparten.
+ * - Multinivel: engrosa el grafo con emparejamientos de aristas pesadas,
+ *   parte el grafo más grueso y refina la frontera en cada nivel al
+ *   deshacer el engrosamiento.
+ *
+ * Los métodos de nodos trabajan sobre la vista no dirigida del CSR.
+ */
+
+#ifndef PARTICION_GRAFO_H
+#define PARTICION_GRAFO_H
+
+#include "GrafoDisperso.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @enum MetodoParticion
+ * @brief Algoritmo de particionado
+ */
+enum class MetodoParticion {
+    LDG = 0,          ///< Linear Deterministic Greedy (nodos, streaming)
+    Fennel = 1,       ///< Fennel (nodos, streaming)
+    HDRF = 2,         ///< High-Degree Replicated First (aristas, streaming)
+    Multinivel = 3    ///< Engrosamiento + refinamiento de frontera (nodos)
+};
+
+/**
+ * @struct ParametrosParticion
+ * @brief Configuración de un particionado
+ */
+struct ParametrosParticion {
+    MetodoParticion metodo = MetodoParticion::Fennel;
+    int particiones = 4;
+    double desbalanceMaximo = 1.1;  ///< Nodos: capacidad = desbalanceMaximo * n / P
+    double gamma = 1.5;             ///< Fennel: exponente del coste de tamaño
+    double pesoBalance = 1.0;       ///< HDRF: peso del término de balance (lambda)
+    bool ordenAleatorio = false;    ///< Recorrer los nodos en un orden aleatorio en lugar de por ID
+    uint64_t semilla = 42;
+};
+
+/**
+ * @struct MetricasParticion
+ * @brief Calidad de una asignación
+ *
+ * En particiones de nodos `carga` cuenta nodos y una arista está cortada
+ * si sus extremos están en particiones distintas; cada nodo se replica
+ * en su partición y en las de sus vecinos (nodos fantasma). En
+ * particiones de aristas `carga` cuenta aristas, ninguna arista se
+ * corta y cada nodo se replica en las particiones de sus aristas.
+ */
+struct MetricasParticion {
+    int particiones = 0;
+    int64_t aristasCortadas = 0;     ///< Aristas dirigidas entre particiones distintas
+    double fraccionCorte = 0.0;      ///< aristasCortadas / aristas
+    int64_t nodosFrontera = 0;       ///< Nodos presentes en más de una partición
+    double factorReplicacion = 1.0;  ///< Copias por nodo (nodos sin aristas excluidos en aristas)
+    double desbalance = 1.0;         ///< Carga máxima / carga media
+    std::vector<int64_t> carga;      ///< Carga de cada partición
+};
+
+/**
+ * @struct ResultadoParticion
+ * @brief Asignación calculada y sus métricas
+ */
+struct ResultadoParticion {
+    std::vector<int> asignacionNodos;    ///< Partición de cada nodo (HDRF: réplica maestra)
+    std::vector<int> asignacionAristas;  ///< HDRF: partición de cada arista en orden CSR
+    MetricasParticion metricas;
+};
+
+/**
+ * @class ParticionadorGrafo
+ * @brief Calcula y evalúa particiones de un GrafoDisperso
+ */
+class ParticionadorGrafo {
+public:
+    explicit ParticionadorGrafo(const GrafoDisperso& grafo);
+
+    /**
+     * @brief Calcula una partición con el método indicado
+     * @return false si los parámetros son inválidos
+     *
+     * El resultado es reproducible para una misma semilla. Los métodos de
+     * nodos nunca superan la capacidad desbalanceMaximo * n / P
+     * (redondeada hacia arriba); HDRF equilibra las aristas con pesoBalance.
+     */
+    bool particionar(const ParametrosParticion& parametros, ResultadoParticion& resultado);
+
+    /**
+     * @brief Métricas de una asignación de nodos arbitraria (por ejemplo, bloques de IDs)
+     * @param asignacion Partición de cada nodo, en [0, particiones)
+     * @return false si el tamaño o algún valor son inválidos
+     */
+    bool evaluarNodos(const std::vector<int>& asignacion, int particiones,
+                      MetricasParticion& metricas) const;
+
+    /**
+     * @brief Métricas de una asignación de aristas (una entrada por arista, orden CSR)
+     * @return false si el tamaño o algún valor son inválidos
+     */
+    bool evaluarAristas(const std::vector<int>& asignacion, int particiones,
+                        MetricasParticion& metricas) const;
+
+    /**
+     * @brief Escribe una asignación como texto: una partición por línea (formato METIS)
+     * @return false si no se pudo escribir el archivo
+     */
+    static bool escribirAsignacion(const std::vector<int>& asignacion, const std::string& ruta);
+
+private:
+    VistaCSR csr;                  ///< Grafo dirigido original
+    VectorIndice<int> rowPtrND;    ///< Vista no dirigida (sin lazos ni duplicados)
+    VectorIndice<int> columnasND;
+
+    std::vector<int> ordenNodos(const ParametrosParticion& parametros) const;
+    void streamingNodos(const ParametrosParticion& parametros, std::vector<int>& asignacion) const;
+    void hdrf(const ParametrosParticion& parametros, std::vector<int>& asignacionAristas,
+              std::vector<int>& asignacionNodos) const;
+    void multinivel(const ParametrosParticion& parametros, std::vector<int>& asignacion) const;
+};
+
+#endif // PARTICION_GRAFO_H
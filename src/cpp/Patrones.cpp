@@ -0,0 +1,377 @@
+/**
+ * @file Patrones.cpp
+ * @brief Implementación del emparejamiento de patrones por backtracking
+ * @author NeuroNet Team
+ */
+
+#include "Patrones.h"
+#include "Paralelo.h"
+#include <atomic>
+#include <mutex>
+
+namespace {
+
+const int MAX_K = BuscadorPatrones::MAX_NODOS_PATRON;
+
+/**
+ * Orden de emparejamiento y restricciones precalculadas. Todo se indexa
+ * por posición en el orden, no por nodo del patrón.
+ */
+struct PlanBusqueda {
+    int k = 0;
+    int orden[MAX_K];           ///< Posición -> nodo del patrón
+    int gradoSalida[MAX_K];
+    int gradoEntrada[MAX_K];
+    // Aristas hacia posiciones anteriores: (posición, true si va de ella a esta)
+    std::vector<std::pair<int, bool>> restricciones[MAX_K];
+};
+
+/**
+ * Backtracking de un hilo. Las vistas de entrada/salida coinciden en
+ * modo no dirigido.
+ */
+struct Emparejador {
+    const PlanBusqueda& plan;
+    const VistaCSR& salida;
+    const VistaCSR& entrada;
+    const std::atomic<bool>& detener;         ///< Parada de toda la búsqueda
+    const std::atomic<bool>& detenerBloque;   ///< Parada del bloque de raíces de este hilo
+    int asignacion[MAX_K];
+
+    Emparejador(const PlanBusqueda& p, const VistaCSR& s, const VistaCSR& e,
+                const std::atomic<bool>& d, const std::atomic<bool>& db)
+        : plan(p), salida(s), entrada(e), detener(d), detenerBloque(db) {}
+
+    bool detenido() const {
+        return detener.load(std::memory_order_relaxed) || detenerBloque.load(std::memory_order_relaxed);
+    }
+
+    static bool tieneArista(const VistaCSR& vista, int u, int v) {
+        const int* inicio = vista.columnas + vista.rowPtr[u];
+        const int* fin = vista.columnas + vista.rowPtr[u + 1];
+        return std::binary_search(inicio, fin, v);
+    }
+
+    /**
+     * Comprueba un candidato. Las restricciones omitidas ya se cumplen
+     * porque el candidato salió de esas filas; el filtro de grado va al
+     * final porque toca la fila del candidato (un fallo de caché seguro)
+     */
+    bool admite(int pos, int candidato, int omitidaA, int omitidaB) const {
+        for (int j = 0; j < pos; j++) {
+            if (asignacion[j] == candidato) {
+                return false;
+            }
+        }
+        const auto& restricciones = plan.restricciones[pos];
+        for (int r = 0; r < static_cast<int>(restricciones.size()); r++) {
+            if (r == omitidaA || r == omitidaB) {
+                continue;
+            }
+            int otro = asignacion[restricciones[r].first];
+            bool existe = restricciones[r].second ? tieneArista(salida, otro, candidato)
+                                                  : tieneArista(salida, candidato, otro);
+            if (!existe) {
+                return false;
+            }
+        }
+        return salida.grado(candidato) >= plan.gradoSalida[pos] &&
+               entrada.grado(candidato) >= plan.gradoEntrada[pos];
+    }
+
+    template <typename Reportar>
+    void probar(int pos, int candidato, int omitidaA, int omitidaB, Reportar& reportar) {
+        if (admite(pos, candidato, omitidaA, omitidaB)) {
+            asignacion[pos] = candidato;
+            extender(pos + 1, reportar);
+        }
+    }
+
+    template <typename Reportar>
+    void extender(int pos, Reportar& reportar) {
+        if (pos == plan.k) {
+            reportar(asignacion);
+            return;
+        }
+
+        // Estilo join de peor caso óptimo: los candidatos salen de las
+        // filas más cortas entre las de los vecinos ya asignados
+        const auto& restricciones = plan.restricciones[pos];
+        int primera = -1;
+        int segunda = -1;
+        const int* ini[2] = {nullptr, nullptr};
+        const int* fin[2] = {nullptr, nullptr};
+        for (int r = 0; r < static_cast<int>(restricciones.size()); r++) {
+            const VistaCSR& vista = restricciones[r].second ? salida : entrada;
+            int base = asignacion[restricciones[r].first];
+            const int* a = vista.columnas + vista.rowPtr[base];
+            const int* b = vista.columnas + vista.rowPtr[base + 1];
+            if (primera < 0 || b - a < fin[0] - ini[0]) {
+                segunda = primera;
+                ini[1] = ini[0];
+                fin[1] = fin[0];
+                primera = r;
+                ini[0] = a;
+                fin[0] = b;
+            } else if (segunda < 0 || b - a < fin[1] - ini[1]) {
+                segunda = r;
+                ini[1] = a;
+                fin[1] = b;
+            }
+        }
+
+        int anterior = -1;
+        if (segunda < 0) {
+            for (const int* p = ini[0]; p != fin[0]; ++p) {
+                if (detenido()) {
+                    return;
+                }
+                // Filas ordenadas: las aristas repetidas son contiguas
+                if (*p != anterior) {
+                    anterior = *p;
+                    probar(pos, *p, primera, -1, reportar);
+                }
+            }
+            return;
+        }
+
+        // Intersección por mezcla de las dos filas más cortas
+        const int* a = ini[0];
+        const int* b = ini[1];
+        while (a != fin[0] && b != fin[1]) {
+            if (*a < *b) {
+                ++a;
+            } else if (*b < *a) {
+                ++b;
+            } else {
+                if (detenido()) {
+                    return;
+                }
+                if (*a != anterior) {
+                    anterior = *a;
+                    probar(pos, *a, primera, segunda, reportar);
+                }
+                ++a;
+                ++b;
+            }
+        }
+    }
+};
+
+/**
+ * Valida el patrón y calcula el orden de emparejamiento
+ */
+bool planificar(int k, const std::vector<std::pair<int, int>>& aristas, bool noDirigido,
+                PlanBusqueda& plan) {
+    if (k < 1 || k > MAX_K) {
+        std::cerr << "[C++ Core] Error: El patron debe tener entre 1 y " << MAX_K
+                  << " nodos." << std::endl;
+        return false;
+    }
+
+    // Matriz de adyacencia del patrón (sin duplicados)
+    bool arista[MAX_K][MAX_K] = {};
+    for (const auto& a : aristas) {
+        if (a.first < 0 || a.first >= k || a.second < 0 || a.second >= k) {
+            std::cerr << "[C++ Core] Error: Arista del patron fuera de rango." << std::endl;
+            return false;
+        }
+        if (a.first == a.second) {
+            std::cerr << "[C++ Core] Error: El patron no admite lazos." << std::endl;
+            return false;
+        }
+        arista[a.first][a.second] = true;
+        if (noDirigido) {
+            arista[a.second][a.first] = true;
+        }
+    }
+
+    int gradoSal[MAX_K] = {};
+    int gradoEnt[MAX_K] = {};
+    for (int a = 0; a < k; a++) {
+        for (int b = 0; b < k; b++) {
+            gradoSal[a] += arista[a][b];
+            gradoEnt[b] += arista[a][b];
+        }
+    }
+    auto conectados = [&](int a, int b) { return arista[a][b] || arista[b][a]; };
+
+    // Raíz: nodo de mayor grado; luego, el más conectado con los ya elegidos
+    bool elegido[MAX_K] = {};
+    plan.k = k;
+    for (int pos = 0; pos < k; pos++) {
+        int mejor = -1;
+        int mejorEnlaces = -1;
+        int mejorGrado = -1;
+        for (int a = 0; a < k; a++) {
+            if (elegido[a]) {
+                continue;
+            }
+            int enlaces = 0;
+            for (int j = 0; j < pos; j++) {
+                enlaces += conectados(a, plan.orden[j]);
+            }
+            int grado = gradoSal[a] + gradoEnt[a];
+            if (enlaces > mejorEnlaces || (enlaces == mejorEnlaces && grado > mejorGrado)) {
+                mejor = a;
+                mejorEnlaces = enlaces;
+                mejorGrado = grado;
+            }
+        }
+        if (pos > 0 && mejorEnlaces == 0) {
+            std::cerr << "[C++ Core] Error: El patron debe ser conexo." << std::endl;
+            return false;
+        }
+
+        elegido[mejor] = true;
+        plan.orden[pos] = mejor;
+        plan.gradoSalida[pos] = gradoSal[mejor];
+        plan.gradoEntrada[pos] = gradoEnt[mejor];
+        plan.restricciones[pos].clear();
+
+        for (int j = 0; j < pos; j++) {
+            int previo = plan.orden[j];
+            if (arista[previo][mejor]) {
+                plan.restricciones[pos].emplace_back(j, true);
+            }
+            if (!noDirigido && arista[mejor][previo]) {
+                plan.restricciones[pos].emplace_back(j, false);
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+BuscadorPatrones::BuscadorPatrones(const GrafoDisperso& g)
+    : grafo(g), directo(g.vistaCSR()) {
+    transpuesto = grafo.vistaTranspuesta(rowPtrT, columnasT);
+}
+
+int64_t BuscadorPatrones::buscar(int numNodosPatron,
+                                 const std::vector<std::pair<int, int>>& aristasPatron,
+                                 bool noDirigido, int64_t limite, std::vector<int>& coincidencias,
+                                 CallbackCoincidencia callback, void* contexto) {
+    coincidencias.clear();
+
+    PlanBusqueda plan;
+    if (!planificar(numNodosPatron, aristasPatron, noDirigido, plan)) {
+        return -1;
+    }
+
+    std::cout << "[C++ Core] Buscando patron de " << numNodosPatron << " nodos y "
+              << aristasPatron.size() << " aristas..." << std::endl;
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    if (noDirigido && simetrico.rowPtr == nullptr) {
+        simetrico = grafo.vistaNoDirigida(rowPtrND, columnasND);
+    }
+    const VistaCSR& salida = noDirigido ? simetrico : directo;
+    const VistaCSR& entrada = noDirigido ? simetrico : transpuesto;
+
+    int k = numNodosPatron;
+    int n = directo.numNodos;
+    const int64_t bloque = 64;
+    const int64_t numBloques = (n + bloque - 1) / bloque;
+    std::vector<std::vector<int>> porBloque(numBloques);
+
+    std::atomic<bool> detener(false);
+    std::atomic<int64_t> reportadas(0);
+    std::mutex mutexCallback;
+
+    // Sin callback, el límite conserva las primeras coincidencias en orden
+    // de raíz, las mismas que una búsqueda secuencial: cada bloque se corta
+    // al llenar el límite por sí solo, y los bloques posteriores al primer
+    // prefijo completo que lo llena dejan de buscar
+    std::vector<int64_t> cuentaBloque(numBloques, -1);   // -1: bloque pendiente
+    std::mutex mutexPrefijo;
+    int64_t prefijoBloques = 0;
+    int64_t prefijoCuenta = 0;
+    std::atomic<int64_t> corte(numBloques);
+
+    auto terminarBloque = [&](int64_t indice, int64_t cuenta) {
+        std::lock_guard<std::mutex> candado(mutexPrefijo);
+        cuentaBloque[indice] = cuenta;
+        while (corte.load() == numBloques && prefijoBloques < numBloques &&
+               cuentaBloque[prefijoBloques] >= 0) {
+            prefijoCuenta += cuentaBloque[prefijoBloques];
+            if (prefijoCuenta >= limite) {
+                corte.store(prefijoBloques);
+            }
+            prefijoBloques++;
+        }
+    };
+
+    paraleloPara(n, bloque, [&](int64_t desde, int64_t hasta, int) {
+        const int64_t indice = desde / bloque;
+        if (indice > corte.load()) {
+            return;
+        }
+        std::atomic<bool> detenerBloque(false);
+        Emparejador emparejador(plan, salida, entrada, detener, detenerBloque);
+        std::vector<int>& local = porBloque[indice];
+        int enOrdenPatron[MAX_K];
+
+        auto reportar = [&](const int* asignacion) {
+            for (int pos = 0; pos < k; pos++) {
+                enOrdenPatron[plan.orden[pos]] = asignacion[pos];
+            }
+            if (callback != nullptr) {
+                std::lock_guard<std::mutex> candado(mutexCallback);
+                if (detener.load()) {
+                    return;
+                }
+                int64_t cuenta = ++reportadas;
+                if (!callback(contexto, enOrdenPatron, k) || (limite > 0 && cuenta >= limite)) {
+                    detener.store(true);
+                }
+                return;
+            }
+            reportadas.fetch_add(1, std::memory_order_relaxed);
+            local.insert(local.end(), enOrdenPatron, enOrdenPatron + k);
+            if (limite > 0 && (static_cast<int64_t>(local.size()) >= limite * k ||
+                               indice > corte.load(std::memory_order_relaxed))) {
+                detenerBloque.store(true);
+            }
+        };
+
+        for (int64_t raiz = desde; raiz < hasta && !emparejador.detenido(); raiz++) {
+            if (limite > 0 && indice > corte.load(std::memory_order_relaxed)) {
+                break;
+            }
+            int candidato = static_cast<int>(raiz);
+            if (emparejador.admite(0, candidato, -1, -1)) {
+                emparejador.asignacion[0] = candidato;
+                emparejador.extender(1, reportar);
+            }
+        }
+        if (limite > 0 && callback == nullptr) {
+            terminarBloque(indice, static_cast<int64_t>(local.size()) / k);
+        }
+    }, "BuscadorPatrones::buscar");
+
+    int64_t total = reportadas.load();
+    if (limite > 0 && total > limite) {
+        total = limite;
+    }
+
+    if (callback == nullptr) {
+        // Hasta el bloque de corte todos los bloques terminaron; se
+        // concatenan en orden y se recorta al límite
+        coincidencias.reserve(total * k);
+        const size_t maximo = static_cast<size_t>(total) * k;
+        for (auto& parcial : porBloque) {
+            size_t cabe = std::min(parcial.size(), maximo - coincidencias.size());
+            coincidencias.insert(coincidencias.end(), parcial.begin(), parcial.begin() + cabe);
+            std::vector<int>().swap(parcial);
+        }
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+    std::cout << "[C++ Core] Busqueda de patron completada. Coincidencias: " << total
+              << ". Tiempo ejecucion: " << duration.count() / 1000.0 << " ms." << std::endl;
+
+    return total;
+}
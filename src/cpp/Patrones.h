@@ -0,0 +1,75 @@
+/**
+ * @file Patrones.h
+ * @brief Búsqueda de ocurrencias de patrones pequeños (isomorfismo de subgrafos)
+ * @author NeuroNet Team
+ *
+ * Dado un patrón conexo de hasta MAX_NODOS_PATRON nodos, se enumeran las
+ * asignaciones inyectivas de sus nodos a nodos del grafo que preservan
+ * todas sus aristas (monomorfismos, al estilo VF2/VF3). El orden de
+ * emparejamiento empieza por el nodo del patrón de mayor grado y añade
+ * siempre el nodo más conectado con los ya asignados. Los candidatos de
+ * cada nodo salen de la fila CSR más corta entre sus vecinos ya
+ * asignados (como en un join de peor caso óptimo) y se filtran por
+ * grado; las demás aristas se verifican con búsqueda binaria en las
+ * filas ordenadas. La búsqueda se reparte entre hilos por candidato
+ * raíz.
+ *
+ * Un patrón con automorfismos (por ejemplo un ciclo) aparece una vez por
+ * cada automorfismo: se reportan asignaciones, no conjuntos de nodos.
+ */
+
+#ifndef PATRONES_H
+#define PATRONES_H
+
+#include "GrafoDisperso.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Callback de streaming: recibe cada coincidencia (k nodos, en el
+ *        orden de los nodos del patrón); devolver false detiene la búsqueda
+ *
+ * Se invoca desde los hilos de trabajo, pero nunca de forma concurrente.
+ */
+using CallbackCoincidencia = bool (*)(void* contexto, const int* coincidencia, int k);
+
+/**
+ * @class BuscadorPatrones
+ * @brief Motor de emparejamiento de patrones sobre un GrafoDisperso
+ */
+class BuscadorPatrones {
+public:
+    static const int MAX_NODOS_PATRON = 16;
+
+    explicit BuscadorPatrones(const GrafoDisperso& grafo);
+
+    /**
+     * @brief Busca las ocurrencias de un patrón
+     * @param numNodosPatron Nodos del patrón (IDs 0..k-1)
+     * @param aristasPatron Aristas (origen, destino) del patrón
+     * @param noDirigido Si es true, patrón y grafo se tratan como no dirigidos
+     * @param limite Máximo de coincidencias a reportar (0 = sin límite).
+     *        Sin callback se conservan las primeras en orden de raíz, sea
+     *        cual sea el número de hilos; con callback, las que lleguen
+     *        primero
+     * @param coincidencias Salida: k nodos por coincidencia, ordenadas por
+     *        nodo raíz; no se llena si hay callback
+     * @param callback Callback de streaming (puede ser nulo)
+     * @param contexto Puntero opaco para el callback
+     * @return Número de coincidencias reportadas, o -1 si el patrón es inválido
+     */
+    int64_t buscar(int numNodosPatron, const std::vector<std::pair<int, int>>& aristasPatron,
+                   bool noDirigido, int64_t limite, std::vector<int>& coincidencias,
+                   CallbackCoincidencia callback = nullptr, void* contexto = nullptr);
+
+private:
+    const GrafoDisperso& grafo;
+    VistaCSR directo;
+    VectorIndice<int> rowPtrT, columnasT;
+    VistaCSR transpuesto;
+    VectorIndice<int> rowPtrND, columnasND;
+    VistaCSR simetrico;    ///< Vista no dirigida, se construye al primer uso
+};
+
+#endif // PATRONES_H
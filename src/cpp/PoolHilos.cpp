@@ -0,0 +1,407 @@
+/**
+ * @file PoolHilos.cpp
+ * @brief Implementación del pool de hilos con robo de trabajo
+ * @author NeuroNet Team
+ */
+
+#include "PoolHilos.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+
+// El hilo actual está ejecutando el cuerpo de una región
+thread_local bool enRegion = false;
+
+/**
+ * Rango de bloques pendientes de un participante. El dueño consume por
+ * el frente; los ladrones se llevan la mitad final.
+ */
+struct alignas(64) Ranura {
+    std::mutex mutex;
+    int64_t inicio = 0;
+    int64_t fin = 0;
+};
+
+int hilosIniciales() {
+    const char* valor = std::getenv("NEURONET_HILOS");
+    if (valor != nullptr) {
+        int hilos = std::atoi(valor);
+        if (hilos > 0) {
+            return hilos;
+        }
+    }
+    unsigned int hardware = std::thread::hardware_concurrency();
+    return hardware == 0 ? 1 : static_cast<int>(hardware);
+}
+
+double segundosDesde(std::chrono::steady_clock::time_point inicio) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+} // namespace
+
+struct PoolHilos::Region {
+    int64_t numBloques;
+    CuerpoRegion cuerpo;
+    void* datos;
+    int numRanuras;
+    std::unique_ptr<Ranura[]> ranuras;
+    std::atomic<bool> agotada{false};
+    std::atomic<int64_t> robos{0};
+
+    bool medir;
+    std::vector<double> ocupado;      ///< Por participante
+    std::vector<int64_t> ejecutados;  ///< Bloques por participante
+
+    // Hilos del pool dentro de la región (el que llama no cuenta)
+    std::mutex mutex;
+    std::condition_variable libre;
+    int ocupantes = 0;
+
+    Region(int64_t bloques, CuerpoRegion c, void* d, int participantes, bool conMedicion)
+        : numBloques(bloques), cuerpo(c), datos(d), numRanuras(participantes),
+          ranuras(new Ranura[participantes]), medir(conMedicion),
+          ocupado(participantes, 0.0), ejecutados(participantes, 0) {
+        // Reparto inicial contiguo: cada participante empieza por su tramo
+        for (int r = 0; r < numRanuras; r++) {
+            ranuras[r].inicio = numBloques * r / numRanuras;
+            ranuras[r].fin = numBloques * (r + 1) / numRanuras;
+        }
+    }
+
+    /**
+     * Siguiente bloque para el participante `hilo`: de su ranura o robado
+     */
+    bool tomar(int hilo, int64_t& bloque) {
+        Ranura& propia = ranuras[hilo];
+        {
+            std::lock_guard<std::mutex> candado(propia.mutex);
+            if (propia.inicio < propia.fin) {
+                bloque = propia.inicio++;
+                return true;
+            }
+        }
+        for (int k = 1; k < numRanuras; k++) {
+            Ranura& otra = ranuras[(hilo + k) % numRanuras];
+            int64_t desde, hasta;
+            {
+                std::lock_guard<std::mutex> candado(otra.mutex);
+                int64_t restantes = otra.fin - otra.inicio;
+                if (restantes <= 0) {
+                    continue;
+                }
+                hasta = otra.fin;
+                desde = hasta - (restantes + 1) / 2;
+                otra.fin = desde;
+            }
+            robos.fetch_add(1, std::memory_order_relaxed);
+            bloque = desde;
+            if (desde + 1 < hasta) {
+                std::lock_guard<std::mutex> candado(propia.mutex);
+                propia.inicio = desde + 1;
+                propia.fin = hasta;
+            }
+            return true;
+        }
+        return false;
+    }
+};
+
+/**
+ * Retira la región de la lista del pool y espera a que salgan los hilos
+ * que estén dentro; como destructor, también si el cuerpo lanza una
+ * excepción en el hilo que llama
+ */
+class PoolHilos::Inscripcion {
+public:
+    Inscripcion(PoolHilos& p, Region* r) : pool(p), region(r) {}
+
+    ~Inscripcion() {
+        if (region == nullptr) {
+            return;
+        }
+        region->agotada.store(true, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> candado(pool.mutex);
+            pool.regiones.erase(std::find(pool.regiones.begin(), pool.regiones.end(), region));
+        }
+        std::unique_lock<std::mutex> candadoRegion(region->mutex);
+        region->libre.wait(candadoRegion, [&] { return region->ocupantes == 0; });
+    }
+
+    Inscripcion(const Inscripcion&) = delete;
+    Inscripcion& operator=(const Inscripcion&) = delete;
+
+private:
+    PoolHilos& pool;
+    Region* region;
+};
+
+PoolHilos& PoolHilos::instancia() {
+    static PoolHilos pool;
+    return pool;
+}
+
+PoolHilos::PoolHilos() : numHilos(hilosIniciales()) {
+    const char* valor = std::getenv("NEURONET_AFINIDAD");
+    afinidad = valor != nullptr && std::atoi(valor) != 0;
+    arrancarHilos();
+}
+
+PoolHilos::~PoolHilos() {
+    detenerHilos();
+}
+
+void PoolHilos::arrancarHilos() {
+    detenido = false;
+    hilos.reserve(numHilos - 1);
+    for (int h = 1; h < numHilos; h++) {
+        hilos.emplace_back(&PoolHilos::bucle, this, h);
+        if (afinidad) {
+            aplicarAfinidad(hilos.back(), h, true);
+        }
+    }
+}
+
+void PoolHilos::detenerHilos() {
+    {
+        std::lock_guard<std::mutex> candado(mutex);
+        detenido = true;
+    }
+    hayRegion.notify_all();
+    for (auto& hilo : hilos) {
+        if (hilo.joinable()) {
+            hilo.join();
+        }
+    }
+    hilos.clear();
+}
+
+bool PoolHilos::redimensionar(int nuevos) {
+    nuevos = std::max(1, nuevos);
+    {
+        std::lock_guard<std::mutex> candado(mutex);
+        if (!regiones.empty() || redimensionando) {
+            return false;
+        }
+        if (nuevos == numHilos) {
+            return true;
+        }
+        // Las regiones que empiecen mientras tanto corren en serie
+        redimensionando = true;
+    }
+    detenerHilos();
+    numHilos = nuevos;
+    arrancarHilos();
+    {
+        std::lock_guard<std::mutex> candado(mutex);
+        redimensionando = false;
+    }
+    return true;
+}
+
+void PoolHilos::aplicarAfinidad(std::thread& hilo, int indice, bool fijar) {
+#ifdef _WIN32
+    DWORD_PTR proceso = 0, sistema = 0;
+    GetProcessAffinityMask(GetCurrentProcess(), &proceso, &sistema);
+    DWORD_PTR mascara = proceso;
+    if (fijar) {
+        // indice-ésimo núcleo permitido al proceso
+        std::vector<int> nucleos;
+        for (int b = 0; b < static_cast<int>(sizeof(DWORD_PTR) * 8); b++) {
+            if (proceso & (static_cast<DWORD_PTR>(1) << b)) {
+                nucleos.push_back(b);
+            }
+        }
+        if (!nucleos.empty()) {
+            mascara = static_cast<DWORD_PTR>(1) << nucleos[indice % nucleos.size()];
+        }
+    }
+    SetThreadAffinityMask(static_cast<HANDLE>(hilo.native_handle()), mascara);
+#elif defined(__linux__)
+    cpu_set_t permitidos;
+    CPU_ZERO(&permitidos);
+    if (sched_getaffinity(0, sizeof(permitidos), &permitidos) != 0) {
+        return;
+    }
+    cpu_set_t conjunto = permitidos;
+    if (fijar) {
+        std::vector<int> nucleos;
+        for (int c = 0; c < CPU_SETSIZE; c++) {
+            if (CPU_ISSET(c, &permitidos)) {
+                nucleos.push_back(c);
+            }
+        }
+        if (nucleos.empty()) {
+            return;
+        }
+        CPU_ZERO(&conjunto);
+        CPU_SET(nucleos[indice % nucleos.size()], &conjunto);
+    }
+    pthread_setaffinity_np(hilo.native_handle(), sizeof(conjunto), &conjunto);
+#else
+    (void)hilo;
+    (void)indice;
+    (void)fijar;
+#endif
+}
+
+bool PoolHilos::fijarAfinidad(bool fijar) {
+#if defined(_WIN32) || defined(__linux__)
+    std::lock_guard<std::mutex> candado(mutex);
+    if (redimensionando) {
+        return false;
+    }
+    afinidad = fijar;
+    for (size_t h = 0; h < hilos.size(); h++) {
+        aplicarAfinidad(hilos[h], static_cast<int>(h) + 1, fijar);
+    }
+    return true;
+#else
+    (void)fijar;
+    return false;
+#endif
+}
+
+void PoolHilos::setGanchoTiempo(GanchoTiempo nuevo, void* contexto) {
+    std::lock_guard<std::mutex> candado(mutex);
+    gancho = nuevo;
+    contextoGancho = contexto;
+}
+
+void PoolHilos::bucle(int hilo) {
+    std::unique_lock<std::mutex> candado(mutex);
+    while (true) {
+        Region* region = nullptr;
+        hayRegion.wait(candado, [&] {
+            if (detenido) {
+                return true;
+            }
+            for (Region* r : regiones) {
+                // Una región con tope de participantes no admite hilos fuera de él
+                if (hilo < r->numRanuras && !r->agotada.load(std::memory_order_relaxed)) {
+                    region = r;
+                    return true;
+                }
+            }
+            return false;
+        });
+        if (detenido) {
+            return;
+        }
+
+        // Registrarse con el mutex del pool tomado: la región no puede
+        // retirarse entre que se encuentra y se entra en ella
+        {
+            std::lock_guard<std::mutex> candadoRegion(region->mutex);
+            region->ocupantes++;
+        }
+        candado.unlock();
+
+        participar(*region, hilo);
+
+        {
+            std::lock_guard<std::mutex> candadoRegion(region->mutex);
+            if (--region->ocupantes == 0) {
+                region->libre.notify_all();
+            }
+        }
+        candado.lock();
+    }
+}
+
+void PoolHilos::participar(Region& region, int hilo) {
+    // Restaura enRegion también si el cuerpo lanza
+    struct Marca {
+        bool anterior = enRegion;
+        Marca() { enRegion = true; }
+        ~Marca() { enRegion = anterior; }
+    } marca;
+    auto inicio = std::chrono::steady_clock::now();
+
+    int64_t bloque;
+    int64_t hechos = 0;
+    while (region.tomar(hilo, bloque)) {
+        region.cuerpo(region.datos, bloque, hilo);
+        hechos++;
+    }
+    region.agotada.store(true, std::memory_order_relaxed);
+
+    region.ejecutados[hilo] += hechos;
+    if (region.medir) {
+        region.ocupado[hilo] += segundosDesde(inicio);
+    }
+}
+
+void PoolHilos::ejecutar(int64_t numBloques, CuerpoRegion cuerpo, void* datos,
+                         const char* nombre, int maxParticipantes) {
+    if (numBloques <= 0) {
+        return;
+    }
+
+    // Las regiones anidadas no vuelven a medirse ni a repartirse
+    if (enRegion) {
+        for (int64_t b = 0; b < numBloques; b++) {
+            cuerpo(datos, b, 0);
+        }
+        return;
+    }
+
+    auto inicio = std::chrono::steady_clock::now();
+    std::unique_ptr<Region> region;
+    GanchoTiempo ganchoActual;
+    void* contextoActual;
+    {
+        std::lock_guard<std::mutex> candado(mutex);
+        ganchoActual = gancho;
+        contextoActual = contextoGancho;
+        int participantes = redimensionando ? 1 : numHilos.load();
+        if (maxParticipantes > 0) {
+            participantes = std::min(participantes, maxParticipantes);
+        }
+        if (numBloques == 1) {
+            participantes = 1;
+        }
+        region.reset(new Region(numBloques, cuerpo, datos, participantes, ganchoActual != nullptr));
+        if (participantes > 1) {
+            regiones.push_back(region.get());
+        }
+    }
+
+    {
+        Inscripcion inscripcion(*this, region->numRanuras > 1 ? region.get() : nullptr);
+        if (region->numRanuras > 1) {
+            hayRegion.notify_all();
+        }
+        participar(*region, 0);
+    }
+
+    if (ganchoActual != nullptr) {
+        EstadisticasRegion estadisticas;
+        estadisticas.nombre = nombre != nullptr ? nombre : "";
+        estadisticas.bloques = numBloques;
+        estadisticas.robos = region->robos.load();
+        estadisticas.segundos = segundosDesde(inicio);
+        for (int h = 0; h < region->numRanuras; h++) {
+            if (region->ejecutados[h] > 0) {
+                estadisticas.participantes++;
+            }
+            estadisticas.segundosOcupados += region->ocupado[h];
+            estadisticas.maxOcupadoHilo = std::max(estadisticas.maxOcupadoHilo, region->ocupado[h]);
+        }
+        ganchoActual(contextoActual, estadisticas);
+    }
+}
@@ -0,0 +1,130 @@
+/**
+ * @file PoolHilos.h
+ * @brief Pool de hilos único del proceso con robo de trabajo
+ * @author NeuroNet Team
+ *
+ * Todos los núcleos paralelos (carga, BFS, análisis) ejecutan sus bucles
+ * sobre este pool en lugar de crear hilos en cada llamada. Un bucle
+ * paralelo es una "región": su rango de bloques se reparte de antemano
+ * entre las ranuras de los participantes; cada uno consume su ranura por
+ * el frente y, al vaciarla, roba la mitad final de la ranura de otro.
+ * El hilo que llama participa siempre como hilo 0.
+ *
+ * Tamaño: variable de entorno NEURONET_HILOS (si no, los hilos de
+ * hardware) o redimensionar() antes de lanzar trabajo. Con
+ * NEURONET_AFINIDAD=1 cada hilo del pool se fija a un núcleo.
+ */
+
+#ifndef POOL_HILOS_H
+#define POOL_HILOS_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @struct EstadisticasRegion
+ * @brief Tiempos de un bucle paralelo, entregados al gancho de medición
+ */
+struct EstadisticasRegion {
+    const char* nombre = "";        ///< Nombre de la región (núcleo que la lanzó)
+    int participantes = 0;          ///< Hilos que ejecutaron al menos un bloque
+    int64_t bloques = 0;            ///< Bloques ejecutados
+    int64_t robos = 0;              ///< Robos entre ranuras
+    double segundos = 0.0;          ///< Tiempo de pared de la región
+    double segundosOcupados = 0.0;  ///< Suma del tiempo dentro del cuerpo, todos los hilos
+    double maxOcupadoHilo = 0.0;    ///< Mayor tiempo ocupado de un hilo (desbalance)
+};
+
+/**
+ * @brief Gancho de medición: se invoca al terminar cada región, desde el
+ *        hilo que la lanzó
+ */
+using GanchoTiempo = void (*)(void* contexto, const EstadisticasRegion& estadisticas);
+
+/**
+ * @brief Cuerpo de una región: ejecuta el bloque `bloque` como el hilo `hilo`
+ */
+using CuerpoRegion = void (*)(void* datos, int64_t bloque, int hilo);
+
+/**
+ * @class PoolHilos
+ * @brief Hilos de trabajo persistentes compartidos por todos los núcleos
+ */
+class PoolHilos {
+public:
+    /**
+     * @brief Pool del proceso (se crea en el primer uso)
+     */
+    static PoolHilos& instancia();
+
+    ~PoolHilos();
+
+    PoolHilos(const PoolHilos&) = delete;
+    PoolHilos& operator=(const PoolHilos&) = delete;
+
+    /**
+     * @brief Participantes de cada región (hilos del pool + el que llama)
+     */
+    int getNumHilos() const { return numHilos; }
+
+    /**
+     * @brief Cambia el número de participantes
+     * @return false si hay regiones en curso (el tamaño no cambia)
+     */
+    bool redimensionar(int hilos);
+
+    /**
+     * @brief Fija (o libera) cada hilo del pool a un núcleo
+     * @return false si la plataforma no lo permite
+     */
+    bool fijarAfinidad(bool fijar);
+
+    /**
+     * @brief Instala el gancho de medición (nulo para desactivarlo)
+     */
+    void setGanchoTiempo(GanchoTiempo gancho, void* contexto);
+
+    /**
+     * @brief Ejecuta cuerpo(datos, b, hilo) para cada b en [0, numBloques)
+     * @param nombre Nombre de la región para el gancho de medición
+     * @param maxParticipantes Si es > 0, tope de participantes: `hilo`
+     *        queda en [0, maxParticipantes) aunque el pool sea mayor
+     *
+     * Bloquea hasta que terminan todos los bloques. Las llamadas anidadas
+     * (desde dentro de un cuerpo) se ejecutan en serie en el hilo actual.
+     */
+    void ejecutar(int64_t numBloques, CuerpoRegion cuerpo, void* datos, const char* nombre,
+                  int maxParticipantes = 0);
+
+private:
+    struct Region;
+    class Inscripcion;
+
+    PoolHilos();
+
+    std::atomic<int> numHilos{1};
+    bool afinidad = false;
+    std::vector<std::thread> hilos;
+
+    std::mutex mutex;
+    std::condition_variable hayRegion;
+    std::vector<Region*> regiones;
+    bool detenido = false;
+    bool redimensionando = false;
+
+    GanchoTiempo gancho = nullptr;
+    void* contextoGancho = nullptr;
+
+    void arrancarHilos();
+    void detenerHilos();
+    void bucle(int hilo);
+    void aplicarAfinidad(std::thread& hilo, int indice, bool fijar);
+    void participar(Region& region, int hilo);
+};
+
+#endif // POOL_HILOS_H
@@ -0,0 +1,86 @@
+/**
+ * @file RecorridoBFS.cpp
+ * @brief Implementación de la primitiva de BFS reutilizable
+ * @author NeuroNet Team
+ */
+
+#include "RecorridoBFS.h"
+#include "ArenaMemoria.h"
+#include "Metricas.h"
+#include <algorithm>
+
+EspacioBFS::EspacioBFS(int numNodos) : reserva(reservaVectoresHilo()) {
+    distancia = tomarVectorTrabajo(*reserva, numNodos);
+    visitados = tomarVectorTrabajo(*reserva, numNodos);
+    distancia.assign(numNodos, -1);
+}
+
+EspacioBFS::EspacioBFS(const EspacioBFS& otro) : EspacioBFS(static_cast<int>(otro.distancia.size())) {
+    // Copia dentro de la capacidad tomada: los arreglos siguen siendo de la reserva
+    std::copy(otro.distancia.begin(), otro.distancia.end(), distancia.begin());
+    visitados.assign(otro.visitados.begin(), otro.visitados.end());
+}
+
+EspacioBFS& EspacioBFS::operator=(const EspacioBFS& otro) {
+    EspacioBFS copia(otro);
+    return *this = std::move(copia);
+}
+
+EspacioBFS::~EspacioBFS() {
+    if (reserva) {
+        devolverVectorTrabajo(*reserva, std::move(distancia));
+        devolverVectorTrabajo(*reserva, std::move(visitados));
+    }
+}
+
+EspacioBFS& EspacioBFS::operator=(EspacioBFS&& otro) noexcept {
+    // Los arreglos anteriores vuelven a la reserva con el destructor de `otro`
+    std::swap(distancia, otro.distancia);
+    std::swap(visitados, otro.visitados);
+    std::swap(reserva, otro.reserva);
+    return *this;
+}
+
+void EspacioBFS::reiniciar() {
+    for (int nodo : visitados) {
+        distancia[nodo] = -1;
+    }
+    visitados.clear();
+}
+
+int bfsDistancias(const VistaCSR& csr, int origen, EspacioBFS& espacio, int profundidadMaxima) {
+    espacio.reiniciar();
+
+    int* distancia = espacio.distancia.data();
+    std::vector<int>& cola = espacio.visitados;
+
+    distancia[origen] = 0;
+    cola.push_back(origen);
+
+    // El propio vector de visitados actúa como cola: cabeza avanza, cola crece
+    size_t cabeza = 0;
+    int64_t aristas = 0;
+    while (cabeza < cola.size()) {
+        int nodoActual = cola[cabeza++];
+        int nivel = distancia[nodoActual];
+        if (nivel >= profundidadMaxima) {
+            continue;
+        }
+
+        const int* vecino = csr.columnas + csr.rowPtr[nodoActual];
+        const int* fin = csr.columnas + csr.rowPtr[nodoActual + 1];
+        aristas += fin - vecino;
+        for (; vecino != fin; ++vecino) {
+            if (distancia[*vecino] < 0) {
+                distancia[*vecino] = nivel + 1;
+                cola.push_back(*vecino);
+            }
+        }
+    }
+
+    sumarMetrica(ContadorMetrica::RecorridosInternos, 1);
+    sumarMetrica(ContadorMetrica::NodosVisitados, static_cast<int64_t>(cola.size()));
+    sumarMetrica(ContadorMetrica::AristasExploradas, aristas);
+
+    return distancia[cola.back()];
+}
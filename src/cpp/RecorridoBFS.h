@@ -0,0 +1,70 @@
+/**
+ * @file RecorridoBFS.h
+ * @brief Primitiva de BFS de origen único con espacio de trabajo reutilizable
+ * @author NeuroNet Team
+ *
+ * Los algoritmos que encadenan muchos BFS (diámetro, excentricidades,
+ * índices de distancia) no pueden permitirse reservar y limpiar O(n)
+ * memoria en cada recorrido. EspacioBFS conserva los arreglos entre
+ * llamadas y solo restablece las posiciones que el último BFS tocó.
+ */
+
+#ifndef RECORRIDO_BFS_H
+#define RECORRIDO_BFS_H
+
+#include "GrafoDisperso.h"
+#include "ArenaMemoria.h"
+#include <climits>
+#include <memory>
+#include <vector>
+
+/**
+ * @class EspacioBFS
+ * @brief Arreglos de trabajo reutilizables para BFS sucesivos
+ *
+ * Tras un recorrido, `visitados` contiene los nodos alcanzados en orden
+ * BFS (por niveles crecientes) y `distancia[v]` su nivel, o -1 si v no
+ * fue alcanzado.
+ */
+class EspacioBFS {
+public:
+    /**
+     * @brief Toma de la reserva del hilo los arreglos para un grafo de numNodos nodos
+     */
+    explicit EspacioBFS(int numNodos);
+
+    /** Devuelve los arreglos a la reserva que los prestó, desde cualquier hilo */
+    ~EspacioBFS();
+
+    /** Copia con arreglos tomados de la reserva del hilo */
+    EspacioBFS(const EspacioBFS& otro);
+    EspacioBFS(EspacioBFS&&) = default;
+    EspacioBFS& operator=(const EspacioBFS& otro);
+    EspacioBFS& operator=(EspacioBFS&& otro) noexcept;
+
+    /**
+     * @brief Restablece las distancias tocadas por el último recorrido
+     *
+     * Cuesta O(nodos visitados), no O(numNodos).
+     */
+    void reiniciar();
+
+    std::vector<int> distancia;  ///< Nivel de cada nodo (-1 = no alcanzado)
+    std::vector<int> visitados;  ///< Nodos alcanzados, en orden BFS (hace de cola)
+
+private:
+    std::shared_ptr<ReservaVectores> reserva;  ///< Reserva de la que salen los arreglos
+};
+
+/**
+ * @brief BFS de origen único sobre una VistaCSR
+ * @param csr Estructura a recorrer
+ * @param origen Nodo inicial (debe ser válido)
+ * @param espacio Espacio de trabajo; se reinicia al comenzar
+ * @param profundidadMaxima Nivel máximo a explorar
+ * @return Excentricidad alcanzada (nivel del último nodo visitado)
+ */
+int bfsDistancias(const VistaCSR& csr, int origen, EspacioBFS& espacio,
+                  int profundidadMaxima = INT_MAX);
+
+#endif // RECORRIDO_BFS_H
@@ -0,0 +1,102 @@
+/**
+ * @file RecorridoIncremental.cpp
+ * @brief Implementación de los recorridos BFS/DFS por bloques
+ * @author NeuroNet Team
+ */
+
+#include "RecorridoIncremental.h"
+#include <iostream>
+
+RecorridoIncremental::RecorridoIncremental(const GrafoDisperso& grafo)
+    : csr(grafo.vistaCSR()), visitado(grafo.vistaCSR().numNodos, false) {}
+
+RecorridoBFSIncremental::RecorridoBFSIncremental(const GrafoDisperso& grafo, int nodoInicio,
+                                                 int profundidadMaxima)
+    : RecorridoIncremental(grafo), profundidadMaxima(profundidadMaxima) {
+    if (nodoInicio < 0 || nodoInicio >= csr.numNodos) {
+        std::cerr << "[C++ Core] Error: Nodo de inicio invalido." << std::endl;
+        return;
+    }
+    visitado[nodoInicio] = true;
+    cola.emplace_back(nodoInicio, 0);
+}
+
+int RecorridoBFSIncremental::siguienteBloque(int* nodos, int* distancias, int capacidad) {
+    int escritos = 0;
+    while (escritos < capacidad && cabeza < cola.size()) {
+        // Emitir al desencolar conserva el orden de descubrimiento del BFS completo
+        int nodo = cola[cabeza].first;
+        int distancia = cola[cabeza].second;
+        cabeza++;
+
+        nodos[escritos] = nodo;
+        if (distancias != nullptr) {
+            distancias[escritos] = distancia;
+        }
+        escritos++;
+
+        if (distancia < profundidadMaxima) {
+            for (int i = csr.rowPtr[nodo]; i < csr.rowPtr[nodo + 1]; i++) {
+                int vecino = csr.columnas[i];
+                if (!visitado[vecino]) {
+                    visitado[vecino] = true;
+                    cola.emplace_back(vecino, distancia + 1);
+                }
+            }
+        }
+    }
+
+    // Compactar cuando la parte ya emitida domina el vector
+    if (cabeza > 4096 && cabeza * 2 > cola.size()) {
+        cola.erase(cola.begin(), cola.begin() + static_cast<std::ptrdiff_t>(cabeza));
+        cabeza = 0;
+    }
+    return escritos;
+}
+
+RecorridoDFSIncremental::RecorridoDFSIncremental(const GrafoDisperso& grafo, int nodoInicio)
+    : RecorridoIncremental(grafo) {
+    if (nodoInicio < 0 || nodoInicio >= csr.numNodos) {
+        std::cerr << "[C++ Core] Error: Nodo de inicio invalido." << std::endl;
+        return;
+    }
+    pendiente = nodoInicio;
+}
+
+int RecorridoDFSIncremental::siguienteBloque(int* nodos, int* distancias, int capacidad) {
+    int escritos = 0;
+    if (pendiente >= 0 && capacidad > 0) {
+        visitado[pendiente] = true;
+        nodos[escritos] = pendiente;
+        if (distancias != nullptr) {
+            distancias[escritos] = 0;
+        }
+        escritos++;
+        pila.emplace_back(pendiente, csr.rowPtr[pendiente]);
+        pendiente = -1;
+    }
+
+    // Descender por el primer vecino no visitado equivale a la versión con
+    // pila de vecinos apilados en orden inverso que descarta los ya visitados
+    while (escritos < capacidad && !pila.empty()) {
+        std::pair<int, int>& tope = pila.back();
+        int fin = csr.rowPtr[tope.first + 1];
+        while (tope.second < fin && visitado[csr.columnas[tope.second]]) {
+            tope.second++;
+        }
+        if (tope.second == fin) {
+            pila.pop_back();
+            continue;
+        }
+        int vecino = csr.columnas[tope.second++];
+        visitado[vecino] = true;
+        nodos[escritos] = vecino;
+        if (distancias != nullptr) {
+            distancias[escritos] = static_cast<int>(pila.size());
+        }
+        escritos++;
+        pila.emplace_back(vecino, csr.rowPtr[vecino]);
+    }
+
+    return escritos;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file RecorridoIncremental.h
+ * @brief Recorridos BFS/DFS que avanzan por bloques bajo demanda
+ * @author NeuroNet Team
+ *
+ * GrafoDisperso::BFS/DFS devuelven el recorrido completo en un vector;
+ * en una componente gigante eso duplica la memoria al copiarlo a Python.
+ * Estos recorridos conservan solo su estado (marcas de visitado y la
+ * frontera o la pila) y escriben los nodos en un búfer del llamador, un
+ * bloque cada vez, en el mismo orden que los recorridos completos.
+ */
+
+#ifndef RECORRIDO_INCREMENTAL_H
+#define RECORRIDO_INCREMENTAL_H
+
+#include "GrafoDisperso.h"
+#include <utility>
+#include <vector>
+
+/**
+ * @class RecorridoIncremental
+ * @brief Interfaz común de los recorridos por bloques
+ *
+ * El grafo debe seguir vivo y sin cambios mientras dure el recorrido.
+ */
+class RecorridoIncremental {
+public:
+    virtual ~RecorridoIncremental() = default;
+
+    /**
+     * @brief Avanza el recorrido hasta llenar un bloque
+     * @param nodos Salida: hasta `capacidad` nodos en orden de recorrido
+     * @param distancias Salida opcional (puede ser nullptr): nivel BFS de
+     *        cada nodo, o su profundidad en el árbol DFS
+     * @param capacidad Tamaño de los búferes de salida
+     * @return Nodos escritos; 0 cuando el recorrido terminó
+     */
+    virtual int siguienteBloque(int* nodos, int* distancias, int capacidad) = 0;
+
+protected:
+    explicit RecorridoIncremental(const GrafoDisperso& grafo);
+
+    VistaCSR csr;
+    std::vector<bool> visitado;
+};
+
+/**
+ * @class RecorridoBFSIncremental
+ * @brief BFS limitado por profundidad; mismo orden que GrafoDisperso::BFS
+ *
+ * Solo retiene la cola de nodos descubiertos y aún no emitidos (a lo
+ * sumo dos niveles consecutivos); lo ya emitido se descarta al compactar.
+ */
+class RecorridoBFSIncremental : public RecorridoIncremental {
+public:
+    /**
+     * @param grafo Grafo a recorrer
+     * @param nodoInicio Nodo inicial (si es inválido el recorrido queda vacío)
+     * @param profundidadMaxima Nivel máximo a explorar
+     */
+    RecorridoBFSIncremental(const GrafoDisperso& grafo, int nodoInicio, int profundidadMaxima);
+
+    int siguienteBloque(int* nodos, int* distancias, int capacidad) override;
+
+private:
+    int profundidadMaxima;
+    std::vector<std::pair<int, int>> cola;   ///< (nodo, distancia) pendientes de emitir
+    size_t cabeza = 0;
+};
+
+/**
+ * @class RecorridoDFSIncremental
+ * @brief DFS en preorden; mismo orden que GrafoDisperso::DFS
+ *
+ * La pila guarda (nodo, siguiente arista por examinar), así que ocupa
+ * O(profundidad) en lugar de una entrada por arista apilada.
+ */
+class RecorridoDFSIncremental : public RecorridoIncremental {
+public:
+    /**
+     * @param grafo Grafo a recorrer
+     * @param nodoInicio Nodo inicial (si es inválido el recorrido queda vacío)
+     */
+    RecorridoDFSIncremental(const GrafoDisperso& grafo, int nodoInicio);
+
+    int siguienteBloque(int* nodos, int* distancias, int capacidad) override;
+
+private:
+    std::vector<std::pair<int, int>> pila;
+    int pendiente = -1;   ///< Nodo inicial aún no emitido
+};
+
+#endif // RECORRIDO_INCREMENTAL_H
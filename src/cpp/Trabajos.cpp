@@ -0,0 +1,117 @@
+/**
+ * @file Trabajos.cpp
+ * @brief Implementación del ejecutor de trabajos asíncronos
+ * @author NeuroNet Team
+ */
+
+#include "Trabajos.h"
+#include "Paralelo.h"
+
+void TrabajoCarga::ejecutar() {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    exito = grafo.cargarDatos(archivo, &control);
+    auto endTime = std::chrono::high_resolution_clock::now();
+    segundos = std::chrono::duration<double>(endTime - startTime).count();
+}
+
+void TrabajoBFS::ejecutar() {
+    resultado = grafo.BFS(nodoInicio, profundidadMaxima, &control);
+}
+
+void TrabajoDFS::ejecutar() {
+    resultado = grafo.DFS(nodoInicio, &control);
+}
+
+EjecutorTrabajos::EjecutorTrabajos(int numHilos) {
+    numHilos = std::max(1, numHilos);
+    hilos.reserve(numHilos);
+    for (int h = 0; h < numHilos; h++) {
+        hilos.emplace_back(&EjecutorTrabajos::bucle, this);
+    }
+}
+
+EjecutorTrabajos::~EjecutorTrabajos() {
+    detener();
+}
+
+EjecutorTrabajos& EjecutorTrabajos::instancia() {
+    // Los trabajos son mayormente secuenciales (E/S, recorridos): unos
+    // pocos hilos bastan para que no se bloqueen entre sí
+    static EjecutorTrabajos ejecutor(std::max(2, std::min(4, numHilosDisponibles())));
+    return ejecutor;
+}
+
+bool EjecutorTrabajos::enviar(Trabajo* trabajo) {
+    {
+        std::lock_guard<std::mutex> candado(mutex);
+        if (detenido) {
+            return false;
+        }
+        trabajo->control.setEstado(EstadoTrabajo::Pendiente);
+        cola.push_back(trabajo);
+    }
+    hayTrabajo.notify_one();
+    return true;
+}
+
+void EjecutorTrabajos::detener() {
+    std::deque<Trabajo*> pendientes;
+    {
+        std::lock_guard<std::mutex> candado(mutex);
+        if (detenido) {
+            return;
+        }
+        detenido = true;
+        pendientes.swap(cola);
+        for (Trabajo* trabajo : activos) {
+            trabajo->control.cancelar();
+        }
+    }
+    hayTrabajo.notify_all();
+
+    for (Trabajo* trabajo : pendientes) {
+        trabajo->control.cancelar();
+        trabajo->control.setEstado(EstadoTrabajo::Cancelado);
+        if (trabajo->alTerminar != nullptr) {
+            trabajo->alTerminar(trabajo->contexto);
+        }
+    }
+
+    for (auto& hilo : hilos) {
+        if (hilo.joinable()) {
+            hilo.join();
+        }
+    }
+}
+
+void EjecutorTrabajos::bucle() {
+    while (true) {
+        Trabajo* trabajo;
+        {
+            std::unique_lock<std::mutex> candado(mutex);
+            hayTrabajo.wait(candado, [this] { return detenido || !cola.empty(); });
+            if (cola.empty()) {
+                return;
+            }
+            trabajo = cola.front();
+            cola.pop_front();
+            activos.push_back(trabajo);
+        }
+
+        if (!trabajo->control.estaCancelado()) {
+            trabajo->control.setEstado(EstadoTrabajo::Ejecutando);
+            trabajo->ejecutar();
+        }
+
+        {
+            std::lock_guard<std::mutex> candado(mutex);
+            activos.erase(std::find(activos.begin(), activos.end(), trabajo));
+        }
+        trabajo->control.setEstado(trabajo->control.estaCancelado() ? EstadoTrabajo::Cancelado
+                                                                     : EstadoTrabajo::Completado);
+        // Último acceso al trabajo: el callback puede liberarlo
+        if (trabajo->alTerminar != nullptr) {
+            trabajo->alTerminar(trabajo->contexto);
+        }
+    }
+}
@@ -0,0 +1,195 @@
+/**
+ * @file Trabajos.h
+ * @brief Trabajos asíncronos: ejecutor nativo, progreso y cancelación
+ * @author NeuroNet Team
+ *
+ * Las operaciones largas (carga de archivos, BFS, DFS) se envían a un
+ * ejecutor con hilos propios y devuelven el control de inmediato. Cada
+ * trabajo lleva un ControlTrabajo que el núcleo actualiza desde los
+ * bucles internos (bytes leídos, nivel de la frontera, nodos visitados)
+ * y que sirve de token de cancelación cooperativa: los bucles lo
+ * consultan periódicamente y terminan antes si se pidió cancelar.
+ *
+ * Al terminar, el hilo del ejecutor invoca el callback del trabajo; es
+ * el punto de enganche con los futures del lado Python.
+ */
+
+#ifndef TRABAJOS_H
+#define TRABAJOS_H
+
+#include "GrafoDisperso.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Estado de un trabajo asíncrono
+ */
+enum class EstadoTrabajo : int {
+    Pendiente = 0,   ///< En la cola del ejecutor
+    Ejecutando = 1,  ///< Tomado por un hilo
+    Completado = 2,  ///< Terminó normalmente (el resultado puede indicar error)
+    Cancelado = 3    ///< Se canceló antes de empezar o durante la ejecución
+};
+
+/**
+ * @class ControlTrabajo
+ * @brief Progreso y token de cancelación compartidos entre hilos
+ *
+ * Todas las operaciones son atómicas y sin bloqueo, de modo que los
+ * bucles calientes pueden consultarlas sin coste apreciable.
+ */
+class ControlTrabajo {
+public:
+    void cancelar() { cancelado.store(true, std::memory_order_relaxed); }
+    bool estaCancelado() const { return cancelado.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Publica el avance (unidades propias de cada operación)
+     */
+    void reportar(int64_t actual, int64_t totalEstimado) {
+        progreso.store(actual, std::memory_order_relaxed);
+        total.store(totalEstimado, std::memory_order_relaxed);
+    }
+
+    int64_t getProgreso() const { return progreso.load(std::memory_order_relaxed); }
+    int64_t getTotal() const { return total.load(std::memory_order_relaxed); }
+
+    EstadoTrabajo getEstado() const {
+        return static_cast<EstadoTrabajo>(estado.load(std::memory_order_acquire));
+    }
+    void setEstado(EstadoTrabajo nuevo) {
+        estado.store(static_cast<int>(nuevo), std::memory_order_release);
+    }
+
+private:
+    std::atomic<bool> cancelado{false};
+    std::atomic<int64_t> progreso{0};
+    std::atomic<int64_t> total{0};
+    std::atomic<int> estado{static_cast<int>(EstadoTrabajo::Pendiente)};
+};
+
+/**
+ * @brief Callback de finalización; se invoca desde el hilo del ejecutor
+ *        (o desde el que llama a detener() si el trabajo no llegó a correr)
+ *
+ * Después de invocarlo el ejecutor no vuelve a tocar el trabajo, así
+ * que el callback puede liberarlo.
+ */
+using CallbackTrabajo = void (*)(void* contexto);
+
+/**
+ * @class Trabajo
+ * @brief Unidad de trabajo asíncrona; el resultado lo guarda cada subclase
+ */
+class Trabajo {
+public:
+    virtual ~Trabajo() = default;
+
+    /**
+     * @brief Ejecuta la operación consultando `control` en los bucles internos
+     */
+    virtual void ejecutar() = 0;
+
+    ControlTrabajo control;
+    CallbackTrabajo alTerminar = nullptr;
+    void* contexto = nullptr;
+};
+
+/**
+ * @brief Carga de un Edge List; progreso en bytes leídos del archivo
+ */
+class TrabajoCarga : public Trabajo {
+public:
+    TrabajoCarga(GrafoDisperso& g, const std::string& ruta) : grafo(g), archivo(ruta) {}
+    void ejecutar() override;
+
+    GrafoDisperso& grafo;
+    std::string archivo;
+    bool exito = false;
+    double segundos = 0.0;   ///< Duración de la carga
+};
+
+/**
+ * @brief BFS limitado; progreso en niveles completados sobre la profundidad máxima
+ */
+class TrabajoBFS : public Trabajo {
+public:
+    TrabajoBFS(GrafoDisperso& g, int inicio, int profundidad)
+        : grafo(g), nodoInicio(inicio), profundidadMaxima(profundidad) {}
+    void ejecutar() override;
+
+    GrafoDisperso& grafo;
+    int nodoInicio;
+    int profundidadMaxima;
+    std::vector<std::pair<int, int>> resultado;
+};
+
+/**
+ * @brief DFS completo; progreso en nodos visitados sobre el total de nodos
+ */
+class TrabajoDFS : public Trabajo {
+public:
+    TrabajoDFS(GrafoDisperso& g, int inicio) : grafo(g), nodoInicio(inicio) {}
+    void ejecutar() override;
+
+    GrafoDisperso& grafo;
+    int nodoInicio;
+    std::vector<int> resultado;
+};
+
+/**
+ * @class EjecutorTrabajos
+ * @brief Pool de hilos con cola FIFO para trabajos asíncronos
+ *
+ * Los trabajos no son propiedad del ejecutor: quien los envía los libera
+ * desde su callback de finalización (o después de él).
+ */
+class EjecutorTrabajos {
+public:
+    explicit EjecutorTrabajos(int numHilos);
+    ~EjecutorTrabajos();
+
+    EjecutorTrabajos(const EjecutorTrabajos&) = delete;
+    EjecutorTrabajos& operator=(const EjecutorTrabajos&) = delete;
+
+    /**
+     * @brief Ejecutor compartido del proceso (se crea en el primer uso)
+     */
+    static EjecutorTrabajos& instancia();
+
+    /**
+     * @brief Encola un trabajo
+     * @return false si el ejecutor ya se detuvo (el trabajo no se encola)
+     */
+    bool enviar(Trabajo* trabajo);
+
+    /**
+     * @brief Cancela todo y espera a que terminen los hilos
+     *
+     * Los trabajos pendientes se marcan como cancelados y reciben su
+     * callback; los que están en ejecución reciben la señal de
+     * cancelación. Es idempotente.
+     */
+    void detener();
+
+    int getNumHilos() const { return static_cast<int>(hilos.size()); }
+
+private:
+    std::mutex mutex;
+    std::condition_variable hayTrabajo;
+    std::deque<Trabajo*> cola;
+    std::vector<Trabajo*> activos;
+    std::vector<std::thread> hilos;
+    bool detenido = false;
+
+    void bucle();
+};
+
+#endif // TRABAJOS_H
@@ -4,9 +4,18 @@
 from libcpp.string cimport string
 from libcpp.vector cimport vector
 from libcpp.pair cimport pair
+from libcpp cimport bool
+from libc.stdint cimport int32_t, int64_t, uint64_t
 
 # Declaración de la clase C++ GrafoDisperso
 cdef extern from "GrafoDisperso.h":
+    cdef cppclass VistaCSR:
+        const int* rowPtr
+        const int* columnas
+        const int* valores
+        const int* gradoEntrada
+        int numNodos
+        int numAristas
     cdef cppclass GrafoDisperso:
         GrafoDisperso() except +
         bint cargarDatos(string filename)
@@ -20,4 +29,390 @@ cdef extern from "GrafoDisperso.h":
         pair[int, int] getNodoMayorGrado()
         size_t getMemoriaUsada()
         vector[pair[int, int]] getAristasSubgrafo(int nodoInicio, int profundidadMaxima)
+        bint extraerSubgrafo(const vector[int]& nodos, GrafoDisperso& destino) nogil
+        bint extraerSubgrafoBFS(int nodoInicio, int profundidadMaxima, GrafoDisperso& destino) nogil
+        int64_t aristasSubgrafoLote(const vector[int]& semillas, int profundidadMaxima,
+                                    vector[int64_t]& offsets, vector[int]& aristas) nogil
+        VistaCSR vistaCSR()
+        vector[int] getIdsOriginales()
+        const int* datosIdsOriginales()
+        bint importarCSR(const int* rowPtr, const int* columnas, const int* pesos, const int* ids,
+                         int numNodos, int numAristas) nogil
+        bint construirDesdeAristas(const int32_t* origenes, const int32_t* destinos,
+                                   const int* pesos, int64_t cantidad) nogil
+        bint construirDesdeAristas(const int64_t* origenes, const int64_t* destinos,
+                                   const int* pesos, int64_t cantidad) nogil
+        bint adoptarCSR(const int* rowPtr, const int* columnas, const int* pesos,
+                        int nodos, int aristas) nogil
+        bint publicarCompartido(const string& nombre, bint enArchivo) nogil
+        bint adjuntarCompartido(const string& nombre, bint enArchivo) nogil
+        @staticmethod
+        bint eliminarCompartido(const string& nombre)
+        bint esCompartido()
         void printDebugInfo()
+
+# Motor de caminatas aleatorias sobre la estructura CSR
+cdef extern from "CaminatasAleatorias.h" nogil:
+    cdef cppclass ParametrosCaminata:
+        ParametrosCaminata()
+        int longitud
+        int caminatasPorNodo
+        double p
+        double q
+        uint64_t semilla
+    cdef cppclass GeneradorCaminatas:
+        GeneradorCaminatas(const GrafoDisperso& grafo) except +
+        int64_t generar(const vector[int]& nodosInicio,
+                        const ParametrosCaminata& parametros,
+                        vector[int]& salida)
+
+# Diámetro (iFUB) y excentricidades (Takes-Kosters)
+cdef extern from "Diametro.h" nogil:
+    cdef cppclass ProgresoDiametro:
+        int bfsRealizados
+        int cotaInferior
+        int cotaSuperior
+        int pendientes
+    ctypedef bool (*CallbackProgreso)(void* contexto, const ProgresoDiametro& progreso)
+    cdef cppclass ResultadoDiametro:
+        int diametro
+        int cotaInferior
+        int cotaSuperior
+        int bfsRealizados
+        int nodosComponente
+        bint exacto
+    cdef cppclass AnalizadorDiametro:
+        AnalizadorDiametro(const GrafoDisperso& grafo) except +
+        ResultadoDiametro calcularDiametro(CallbackProgreso callback, void* contexto)
+        int calcularExcentricidades(vector[int]& inferior, vector[int]& superior,
+                                    int maxBFS, CallbackProgreso callback, void* contexto)
+
+# Oráculo de distancias por landmarks
+cdef extern from "OraculoLandmarks.h" nogil:
+    cdef enum class EstrategiaLandmarks:
+        Grado
+        Cobertura
+    cdef cppclass CotasDistancia:
+        int inferior
+        int superior
+        bint inalcanzable
+    cdef cppclass OraculoLandmarks:
+        OraculoLandmarks() except +
+        bint construir(const GrafoDisperso& grafo, int k, EstrategiaLandmarks estrategia,
+                       uint64_t semilla)
+        CotasDistancia estimar(int u, int v)
+        CotasDistancia refinar(const GrafoDisperso& grafo, int u, int v, int64_t presupuesto)
+        bint guardar(string ruta)
+        bint cargar(string ruta, const GrafoDisperso& grafo)
+        void limpiar()
+        bint estaConstruido()
+        int getNumLandmarks()
+        int getBytesPorDistancia()
+        const vector[int]& getLandmarks()
+        size_t getMemoriaUsada()
+
+# Índice de distancias exactas por etiquetado podado (PLL)
+cdef extern from "EtiquetadoPodado.h" nogil:
+    cdef cppclass EstadisticasPLL:
+        int numNodos
+        int numRaicesBP
+        int64_t entradasEtiqueta
+        double promedioEtiqueta
+        size_t bytesIndice
+        double segundosConstruccion
+    cdef cppclass IndicePLL:
+        IndicePLL() except +
+        bint construir(const GrafoDisperso& grafo, int numRaicesBP)
+        int consultar(int u, int v)
+        void consultarLote(const int* u, const int* v, int64_t cantidad, int* salida)
+        bint guardar(string ruta)
+        bint cargar(string ruta, const GrafoDisperso& grafo)
+        void limpiar()
+        bint estaConstruido()
+        EstadisticasPLL getEstadisticas()
+
+# Censo de tríadas dirigidas y grafletes de 3 y 4 nodos
+cdef extern from "Motivos.h" nogil:
+    cdef cppclass CensoTriadas:
+        int64_t cuentas[16]
+    cdef cppclass ConteoGrafletes:
+        int64_t caminos2
+        int64_t triangulos
+        int64_t caminos3
+        int64_t estrellas3
+        int64_t ciclos4
+        int64_t colasTriangulo
+        int64_t diamantes
+        int64_t cliques4
+    cdef cppclass ContadorMotivos:
+        ContadorMotivos(const GrafoDisperso& grafo) except +
+        CensoTriadas censoTriadas()
+        ConteoGrafletes contarGrafletes(vector[int64_t]* orbitas)
+
+# Búsqueda de patrones (isomorfismo de subgrafos)
+cdef extern from "Patrones.h" nogil:
+    ctypedef bool (*CallbackCoincidencia)(void* contexto, const int* coincidencia, int k)
+    cdef cppclass BuscadorPatrones:
+        BuscadorPatrones(const GrafoDisperso& grafo) except +
+        int64_t buscar(int numNodosPatron, const vector[pair[int, int]]& aristasPatron,
+                       bint noDirigido, int64_t limite, vector[int]& coincidencias,
+                       CallbackCoincidencia callback, void* contexto)
+
+# k caminos simples más cortos (Yen)
+cdef extern from "CaminosK.h" nogil:
+    cdef cppclass BuscadorCaminosK:
+        BuscadorCaminosK(const GrafoDisperso& grafo) except +
+        int calcular(int origen, int destino, int k, bint bidireccional,
+                     vector[int]& offsets, vector[int]& nodos)
+
+# Flujo máximo / corte mínimo (Dinic)
+cdef extern from "FlujoMaximo.h" nogil:
+    cdef cppclass ResultadoFlujo:
+        int64_t valor
+        vector[int] corte
+        int fases
+        int nodosLadoFuente
+    cdef cppclass FlujoMaximo:
+        FlujoMaximo(const GrafoDisperso& grafo) except +
+        bint calcular(const vector[int]& fuentes, const vector[int]& sumideros,
+                      bint usarPesos, ResultadoFlujo& resultado)
+
+# Trabajos asíncronos con progreso y cancelación cooperativa
+cdef extern from "Trabajos.h" nogil:
+    cdef enum class EstadoTrabajo:
+        Pendiente
+        Ejecutando
+        Completado
+        Cancelado
+    ctypedef void (*CallbackTrabajo)(void* contexto)
+    cdef cppclass ControlTrabajo:
+        void cancelar()
+        bint estaCancelado()
+        int64_t getProgreso()
+        int64_t getTotal()
+        EstadoTrabajo getEstado()
+    cdef cppclass Trabajo:
+        ControlTrabajo control
+        CallbackTrabajo alTerminar
+        void* contexto
+    cdef cppclass TrabajoCarga(Trabajo):
+        TrabajoCarga(GrafoDisperso& grafo, const string& ruta) except +
+        string archivo
+        bint exito
+        double segundos
+    cdef cppclass TrabajoBFS(Trabajo):
+        TrabajoBFS(GrafoDisperso& grafo, int inicio, int profundidad) except +
+        vector[pair[int, int]] resultado
+    cdef cppclass TrabajoDFS(Trabajo):
+        TrabajoDFS(GrafoDisperso& grafo, int inicio) except +
+        vector[int] resultado
+    cdef cppclass EjecutorTrabajos:
+        @staticmethod
+        EjecutorTrabajos& instancia()
+        bint enviar(Trabajo* trabajo)
+        void detener()
+        int getNumHilos()
+
+# Pool de hilos compartido por todos los núcleos paralelos
+cdef extern from "PoolHilos.h" nogil:
+    cdef cppclass EstadisticasRegion:
+        const char* nombre
+        int participantes
+        int64_t bloques
+        int64_t robos
+        double segundos
+        double segundosOcupados
+        double maxOcupadoHilo
+    ctypedef void (*GanchoTiempo)(void* contexto, const EstadisticasRegion& estadisticas)
+    cdef cppclass PoolHilos:
+        @staticmethod
+        PoolHilos& instancia()
+        int getNumHilos()
+        bint redimensionar(int hilos)
+        bint fijarAfinidad(bint fijar)
+        void setGanchoTiempo(GanchoTiempo gancho, void* contexto)
+
+# Recorridos BFS/DFS que avanzan por bloques
+cdef extern from "RecorridoIncremental.h" nogil:
+    cdef cppclass RecorridoIncremental:
+        int siguienteBloque(int* nodos, int* distancias, int capacidad)
+    cdef cppclass RecorridoBFSIncremental(RecorridoIncremental):
+        RecorridoBFSIncremental(const GrafoDisperso& grafo, int nodoInicio,
+                                int profundidadMaxima) except +
+    cdef cppclass RecorridoDFSIncremental(RecorridoIncremental):
+        RecorridoDFSIncremental(const GrafoDisperso& grafo, int nodoInicio) except +
+
+# Disposición dirigida por fuerzas para dibujar subgrafos
+cdef extern from "DisposicionFuerzas.h" nogil:
+    cdef cppclass ParametrosDisposicion:
+        ParametrosDisposicion()
+        int iteraciones
+        double theta
+        double gravedad
+        uint64_t semilla
+    cdef cppclass DisposicionFuerzas:
+        DisposicionFuerzas(const GrafoDisperso& grafo) except +
+        bint calcular(const ParametrosDisposicion& parametros, vector[double]& posiciones)
+
+# Muestreo de bolas BFS para visualización por nivel de detalle
+cdef extern from "MuestreoSubgrafo.h" nogil:
+    cdef enum class EstrategiaMuestreo:
+        FuegoForestal
+        CaminataAleatoria
+        EstratificadoGrado
+    cdef cppclass ParametrosMuestreo:
+        ParametrosMuestreo()
+        EstrategiaMuestreo estrategia
+        int maxNodos
+        int64_t maxAristas
+        double probQuema
+        double probReinicio
+        uint64_t semilla
+    cdef cppclass MuestraSubgrafo:
+        vector[int] nodos
+        vector[int] niveles
+        vector[int] ocultos
+        vector[int] podadosPorNivel
+        int nodosBola
+        int64_t aristasBola
+        int64_t aristasMuestra
+    cdef cppclass MuestreadorSubgrafo:
+        MuestreadorSubgrafo(const GrafoDisperso& grafo) except +
+        bint muestrear(int nodoInicio, int profundidadMaxima, const ParametrosMuestreo& parametros,
+                       MuestraSubgrafo& muestra)
+
+# Grafo semiexterno: punteros de fila en memoria y aristas en disco
+cdef extern from "GrafoExterno.h" nogil:
+    cdef cppclass GrafoExterno:
+        GrafoExterno() except +
+        @staticmethod
+        bint convertirListaAristas(const string& listaAristas, const string& destino,
+                                   size_t memoriaMaxima)
+        bint abrir(const string& rutaArchivo, bint usarMmap)
+        bint cargarDatos(const string& filename)
+        vector[pair[int, int]] BFS(int nodoInicio, int profundidadMaxima)
+        vector[int] DFS(int nodoInicio)
+        int obtenerGrado(int nodo)
+        int obtenerGradoEntrada(int nodo)
+        vector[int] getVecinos(int nodo)
+        int getNumNodos()
+        int64_t getNumAristas64()
+        pair[int, int] getNodoMayorGrado()
+        size_t getMemoriaUsada()
+        vector[pair[int, int]] getAristasSubgrafo(int nodoInicio, int profundidadMaxima)
+        int componentesConexas(vector[int]& etiquetas)
+        const int64_t* punterosFila()
+        const int* gradosEntrada()
+        bint usaMmap()
+
+# Grafo repartido entre procesos trabajadores (BFS distribuido 1D/2D)
+cdef extern from "GrafoParticionado.h" nogil:
+    cdef enum class EsquemaParticion:
+        Filas1D
+        Bloques2D
+    cdef cppclass EstadisticasBFSParticionado:
+        int niveles
+        int64_t bytesIntercambiados
+        int64_t mensajes
+        double segundos
+    cdef cppclass GrafoParticionado:
+        GrafoParticionado() except +
+        bint iniciar(const GrafoDisperso& grafo, int particiones, EsquemaParticion esquema,
+                     const vector[int]& asignacion)
+        vector[pair[int, int]] BFS(int nodoInicio, int profundidadMaxima)
+        void detener()
+        bint estaActivo()
+        int getNumParticiones()
+        int getNumNodos()
+        int filasMalla()
+        int columnasMalla()
+        const vector[int64_t]& aristasPorParticion()
+        const vector[int64_t]& nodosPorParticion()
+        const EstadisticasBFSParticionado& estadisticasUltimoBFS()
+
+# Particionadores de nodos y aristas con métricas de calidad
+cdef extern from "ParticionGrafo.h" nogil:
+    cdef enum class MetodoParticion:
+        LDG
+        Fennel
+        HDRF
+        Multinivel
+    cdef cppclass ParametrosParticion:
+        ParametrosParticion()
+        MetodoParticion metodo
+        int particiones
+        double desbalanceMaximo
+        double gamma
+        double pesoBalance
+        bint ordenAleatorio
+        uint64_t semilla
+    cdef cppclass MetricasParticion:
+        int particiones
+        int64_t aristasCortadas
+        double fraccionCorte
+        int64_t nodosFrontera
+        double factorReplicacion
+        double desbalance
+        vector[int64_t] carga
+    cdef cppclass ResultadoParticion:
+        vector[int] asignacionNodos
+        vector[int] asignacionAristas
+        MetricasParticion metricas
+    cdef cppclass ParticionadorGrafo:
+        ParticionadorGrafo(const GrafoDisperso& grafo) except +
+        bint particionar(const ParametrosParticion& parametros, ResultadoParticion& resultado)
+        bint evaluarNodos(const vector[int]& asignacion, int particiones, MetricasParticion& metricas)
+        bint evaluarAristas(const vector[int]& asignacion, int particiones, MetricasParticion& metricas)
+        @staticmethod
+        bint escribirAsignacion(const vector[int]& asignacion, const string& ruta)
+
+# Contadores de instrumentación por hilo
+cdef extern from "Metricas.h" nogil:
+    cdef enum class ContadorMetrica:
+        Cantidad
+    cdef enum class MaximoMetrica:
+        Cantidad
+    cdef cppclass PerfilNivelBFS:
+        int64_t frontera
+        int64_t aristas
+        int64_t nanosegundos
+    cdef cppclass InstantaneaMetricas:
+        int64_t* contadores
+        int64_t* maximos
+        vector[PerfilNivelBFS] perfilUltimoBFS
+        int hilos
+    bint metricasActivas()
+    InstantaneaMetricas obtenerMetricas(bint reiniciar)
+    void reiniciarMetricas()
+    void activarMetricas(bint activas)
+    const char* nombreContadorMetrica(ContadorMetrica contador)
+    const char* nombreMaximoMetrica(MaximoMetrica maximo)
+
+cdef extern from "ContabilidadMemoria.h" nogil:
+    cdef enum class CategoriaMemoria:
+        Cantidad
+    cdef cppclass EstadoMemoria:
+        int64_t* actual
+        int64_t* pico
+        int64_t total
+        int64_t totalPico
+        int64_t rss
+        int64_t rssPico
+    EstadoMemoria obtenerEstadoMemoria()
+    void reiniciarPicosMemoria()
+    const char* nombreCategoriaMemoria(CategoriaMemoria categoria)
+
+cdef extern from "ArenaMemoria.h" nogil:
+    cdef enum class ModoPaginasGrandes:
+        Desactivadas
+        Transparentes
+        Explicitas
+    cdef cppclass EstadoPaginasGrandes:
+        ModoPaginasGrandes modo
+        int64_t bytesExplicitas
+        int64_t bytesTransparentes
+        int64_t fallosExplicitas
+    bint configurarPaginasGrandes(ModoPaginasGrandes modo)
+    EstadoPaginasGrandes obtenerEstadoPaginasGrandes()
+    const char* nombreModoPaginasGrandes(ModoPaginasGrandes modo)
+    void liberarMemoriaRetenida()
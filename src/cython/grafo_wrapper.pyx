@@ -11,12 +11,30 @@ rendimiento y la interfaz Python para visualización y control.
 from libcpp.string cimport string
 from libcpp.vector cimport vector
 from libcpp.pair cimport pair
+from libcpp cimport bool
+from libc.stdint cimport int32_t, int64_t, uint64_t
+from libc.string cimport memcpy
 from cython.operator cimport dereference as deref
+from cpython.buffer cimport PyBUF_FORMAT, PyBUF_WRITABLE
+from cpython.ref cimport Py_INCREF, Py_DECREF
 
+import atexit
+import concurrent.futures
+import math
+import pickle
+import sys
 import time
+import numpy as np
 
 # Importar la declaración de la clase C++
 cdef extern from "GrafoDisperso.h":
+    cdef cppclass VistaCSR:
+        const int* rowPtr
+        const int* columnas
+        const int* valores
+        const int* gradoEntrada
+        int numNodos
+        int numAristas
     cdef cppclass GrafoDisperso:
         GrafoDisperso() except +
         bint cargarDatos(string filename)
@@ -30,8 +48,603 @@ cdef extern from "GrafoDisperso.h":
         pair[int, int] getNodoMayorGrado()
         size_t getMemoriaUsada()
         vector[pair[int, int]] getAristasSubgrafo(int nodoInicio, int profundidadMaxima)
+        bint extraerSubgrafo(const vector[int]& nodos, GrafoDisperso& destino) nogil
+        bint extraerSubgrafoBFS(int nodoInicio, int profundidadMaxima, GrafoDisperso& destino) nogil
+        int64_t aristasSubgrafoLote(const vector[int]& semillas, int profundidadMaxima,
+                                    vector[int64_t]& offsets, vector[int]& aristas) nogil
+        VistaCSR vistaCSR()
+        vector[int] getIdsOriginales()
+        const int* datosIdsOriginales()
+        bint importarCSR(const int* rowPtr, const int* columnas, const int* pesos, const int* ids,
+                         int numNodos, int numAristas) nogil
+        bint construirDesdeAristas(const int32_t* origenes, const int32_t* destinos,
+                                   const int* pesos, int64_t cantidad) nogil
+        bint construirDesdeAristas(const int64_t* origenes, const int64_t* destinos,
+                                   const int* pesos, int64_t cantidad) nogil
+        bint adoptarCSR(const int* rowPtr, const int* columnas, const int* pesos,
+                        int nodos, int aristas) nogil
+        bint publicarCompartido(const string& nombre, bint enArchivo) nogil
+        bint adjuntarCompartido(const string& nombre, bint enArchivo) nogil
+        @staticmethod
+        bint eliminarCompartido(const string& nombre)
+        bint esCompartido()
         void printDebugInfo()
 
+# Motor de caminatas aleatorias sobre la estructura CSR
+cdef extern from "CaminatasAleatorias.h" nogil:
+    cdef cppclass ParametrosCaminata:
+        ParametrosCaminata()
+        int longitud
+        int caminatasPorNodo
+        double p
+        double q
+        uint64_t semilla
+    cdef cppclass GeneradorCaminatas:
+        GeneradorCaminatas(const GrafoDisperso& grafo) except +
+        int64_t generar(const vector[int]& nodosInicio,
+                        const ParametrosCaminata& parametros,
+                        vector[int]& salida)
+
+# Diámetro (iFUB) y excentricidades (Takes-Kosters)
+cdef extern from "Diametro.h" nogil:
+    cdef cppclass ProgresoDiametro:
+        int bfsRealizados
+        int cotaInferior
+        int cotaSuperior
+        int pendientes
+    ctypedef bool (*CallbackProgreso)(void* contexto, const ProgresoDiametro& progreso)
+    cdef cppclass ResultadoDiametro:
+        int diametro
+        int cotaInferior
+        int cotaSuperior
+        int bfsRealizados
+        int nodosComponente
+        bint exacto
+    cdef cppclass AnalizadorDiametro:
+        AnalizadorDiametro(const GrafoDisperso& grafo) except +
+        ResultadoDiametro calcularDiametro(CallbackProgreso callback, void* contexto)
+        int calcularExcentricidades(vector[int]& inferior, vector[int]& superior,
+                                    int maxBFS, CallbackProgreso callback, void* contexto)
+
+# Oráculo de distancias por landmarks
+cdef extern from "OraculoLandmarks.h" nogil:
+    cdef enum class EstrategiaLandmarks:
+        Grado
+        Cobertura
+    cdef cppclass CotasDistancia:
+        int inferior
+        int superior
+        bint inalcanzable
+    cdef cppclass OraculoLandmarks:
+        OraculoLandmarks() except +
+        bint construir(const GrafoDisperso& grafo, int k, EstrategiaLandmarks estrategia,
+                       uint64_t semilla)
+        CotasDistancia estimar(int u, int v)
+        CotasDistancia refinar(const GrafoDisperso& grafo, int u, int v, int64_t presupuesto)
+        bint guardar(string ruta)
+        bint cargar(string ruta, const GrafoDisperso& grafo)
+        void limpiar()
+        bint estaConstruido()
+        int getNumLandmarks()
+        int getBytesPorDistancia()
+        const vector[int]& getLandmarks()
+        size_t getMemoriaUsada()
+
+# Índice de distancias exactas por etiquetado podado (PLL)
+cdef extern from "EtiquetadoPodado.h" nogil:
+    cdef cppclass EstadisticasPLL:
+        int numNodos
+        int numRaicesBP
+        int64_t entradasEtiqueta
+        double promedioEtiqueta
+        size_t bytesIndice
+        double segundosConstruccion
+    cdef cppclass IndicePLL:
+        IndicePLL() except +
+        bint construir(const GrafoDisperso& grafo, int numRaicesBP)
+        int consultar(int u, int v)
+        void consultarLote(const int* u, const int* v, int64_t cantidad, int* salida)
+        bint guardar(string ruta)
+        bint cargar(string ruta, const GrafoDisperso& grafo)
+        void limpiar()
+        bint estaConstruido()
+        EstadisticasPLL getEstadisticas()
+
+# Censo de tríadas dirigidas y grafletes de 3 y 4 nodos
+cdef extern from "Motivos.h" nogil:
+    cdef cppclass CensoTriadas:
+        int64_t cuentas[16]
+    cdef cppclass ConteoGrafletes:
+        int64_t caminos2
+        int64_t triangulos
+        int64_t caminos3
+        int64_t estrellas3
+        int64_t ciclos4
+        int64_t colasTriangulo
+        int64_t diamantes
+        int64_t cliques4
+    cdef cppclass ContadorMotivos:
+        ContadorMotivos(const GrafoDisperso& grafo) except +
+        CensoTriadas censoTriadas()
+        ConteoGrafletes contarGrafletes(vector[int64_t]* orbitas)
+
+# Búsqueda de patrones (isomorfismo de subgrafos)
+cdef extern from "Patrones.h" nogil:
+    ctypedef bool (*CallbackCoincidencia)(void* contexto, const int* coincidencia, int k)
+    cdef cppclass BuscadorPatrones:
+        BuscadorPatrones(const GrafoDisperso& grafo) except +
+        int64_t buscar(int numNodosPatron, const vector[pair[int, int]]& aristasPatron,
+                       bint noDirigido, int64_t limite, vector[int]& coincidencias,
+                       CallbackCoincidencia callback, void* contexto)
+
+# k caminos simples más cortos (Yen)
+cdef extern from "CaminosK.h" nogil:
+    cdef cppclass BuscadorCaminosK:
+        BuscadorCaminosK(const GrafoDisperso& grafo) except +
+        int calcular(int origen, int destino, int k, bint bidireccional,
+                     vector[int]& offsets, vector[int]& nodos)
+
+# Flujo máximo / corte mínimo (Dinic)
+cdef extern from "FlujoMaximo.h" nogil:
+    cdef cppclass ResultadoFlujo:
+        int64_t valor
+        vector[int] corte
+        int fases
+        int nodosLadoFuente
+    cdef cppclass FlujoMaximo:
+        FlujoMaximo(const GrafoDisperso& grafo) except +
+        bint calcular(const vector[int]& fuentes, const vector[int]& sumideros,
+                      bint usarPesos, ResultadoFlujo& resultado)
+
+# Trabajos asíncronos con progreso y cancelación cooperativa
+cdef extern from "Trabajos.h" nogil:
+    cdef enum class EstadoTrabajo:
+        Pendiente
+        Ejecutando
+        Completado
+        Cancelado
+    ctypedef void (*CallbackTrabajo)(void* contexto)
+    cdef cppclass ControlTrabajo:
+        void cancelar()
+        bint estaCancelado()
+        int64_t getProgreso()
+        int64_t getTotal()
+        EstadoTrabajo getEstado()
+    cdef cppclass Trabajo:
+        ControlTrabajo control
+        CallbackTrabajo alTerminar
+        void* contexto
+    cdef cppclass TrabajoCarga(Trabajo):
+        TrabajoCarga(GrafoDisperso& grafo, const string& ruta) except +
+        string archivo
+        bint exito
+        double segundos
+    cdef cppclass TrabajoBFS(Trabajo):
+        TrabajoBFS(GrafoDisperso& grafo, int inicio, int profundidad) except +
+        vector[pair[int, int]] resultado
+    cdef cppclass TrabajoDFS(Trabajo):
+        TrabajoDFS(GrafoDisperso& grafo, int inicio) except +
+        vector[int] resultado
+    cdef cppclass EjecutorTrabajos:
+        @staticmethod
+        EjecutorTrabajos& instancia()
+        bint enviar(Trabajo* trabajo)
+        void detener()
+        int getNumHilos()
+
+# Pool de hilos compartido por todos los núcleos paralelos
+cdef extern from "PoolHilos.h" nogil:
+    cdef cppclass EstadisticasRegion:
+        const char* nombre
+        int participantes
+        int64_t bloques
+        int64_t robos
+        double segundos
+        double segundosOcupados
+        double maxOcupadoHilo
+    ctypedef void (*GanchoTiempo)(void* contexto, const EstadisticasRegion& estadisticas)
+    cdef cppclass PoolHilos:
+        @staticmethod
+        PoolHilos& instancia()
+        int getNumHilos()
+        bint redimensionar(int hilos)
+        bint fijarAfinidad(bint fijar)
+        void setGanchoTiempo(GanchoTiempo gancho, void* contexto)
+
+# Recorridos BFS/DFS que avanzan por bloques
+cdef extern from "RecorridoIncremental.h" nogil:
+    cdef cppclass RecorridoIncremental:
+        int siguienteBloque(int* nodos, int* distancias, int capacidad)
+    cdef cppclass RecorridoBFSIncremental(RecorridoIncremental):
+        RecorridoBFSIncremental(const GrafoDisperso& grafo, int nodoInicio,
+                                int profundidadMaxima) except +
+    cdef cppclass RecorridoDFSIncremental(RecorridoIncremental):
+        RecorridoDFSIncremental(const GrafoDisperso& grafo, int nodoInicio) except +
+
+# Disposición dirigida por fuerzas para dibujar subgrafos
+cdef extern from "DisposicionFuerzas.h" nogil:
+    cdef cppclass ParametrosDisposicion:
+        ParametrosDisposicion()
+        int iteraciones
+        double theta
+        double gravedad
+        uint64_t semilla
+    cdef cppclass DisposicionFuerzas:
+        DisposicionFuerzas(const GrafoDisperso& grafo) except +
+        bint calcular(const ParametrosDisposicion& parametros, vector[double]& posiciones)
+
+# Muestreo de bolas BFS para visualización por nivel de detalle
+cdef extern from "MuestreoSubgrafo.h" nogil:
+    cdef enum class EstrategiaMuestreo:
+        FuegoForestal
+        CaminataAleatoria
+        EstratificadoGrado
+    cdef cppclass ParametrosMuestreo:
+        ParametrosMuestreo()
+        EstrategiaMuestreo estrategia
+        int maxNodos
+        int64_t maxAristas
+        double probQuema
+        double probReinicio
+        uint64_t semilla
+    cdef cppclass MuestraSubgrafo:
+        vector[int] nodos
+        vector[int] niveles
+        vector[int] ocultos
+        vector[int] podadosPorNivel
+        int nodosBola
+        int64_t aristasBola
+        int64_t aristasMuestra
+    cdef cppclass MuestreadorSubgrafo:
+        MuestreadorSubgrafo(const GrafoDisperso& grafo) except +
+        bint muestrear(int nodoInicio, int profundidadMaxima, const ParametrosMuestreo& parametros,
+                       MuestraSubgrafo& muestra)
+
+# Grafo semiexterno: punteros de fila en memoria y aristas en disco
+cdef extern from "GrafoExterno.h" nogil:
+    cdef cppclass GrafoExterno:
+        GrafoExterno() except +
+        @staticmethod
+        bint convertirListaAristas(const string& listaAristas, const string& destino,
+                                   size_t memoriaMaxima)
+        bint abrir(const string& rutaArchivo, bint usarMmap)
+        bint cargarDatos(const string& filename)
+        vector[pair[int, int]] BFS(int nodoInicio, int profundidadMaxima)
+        vector[int] DFS(int nodoInicio)
+        int obtenerGrado(int nodo)
+        int obtenerGradoEntrada(int nodo)
+        vector[int] getVecinos(int nodo)
+        int getNumNodos()
+        int64_t getNumAristas64()
+        pair[int, int] getNodoMayorGrado()
+        size_t getMemoriaUsada()
+        vector[pair[int, int]] getAristasSubgrafo(int nodoInicio, int profundidadMaxima)
+        int componentesConexas(vector[int]& etiquetas)
+        const int64_t* punterosFila()
+        const int* gradosEntrada()
+        bint usaMmap()
+
+# Grafo repartido entre procesos trabajadores (BFS distribuido 1D/2D)
+cdef extern from "GrafoParticionado.h" nogil:
+    cdef enum class EsquemaParticion:
+        Filas1D
+        Bloques2D
+    cdef cppclass EstadisticasBFSParticionado:
+        int niveles
+        int64_t bytesIntercambiados
+        int64_t mensajes
+        double segundos
+    cdef cppclass GrafoParticionado:
+        GrafoParticionado() except +
+        bint iniciar(const GrafoDisperso& grafo, int particiones, EsquemaParticion esquema,
+                     const vector[int]& asignacion)
+        vector[pair[int, int]] BFS(int nodoInicio, int profundidadMaxima)
+        void detener()
+        bint estaActivo()
+        int getNumParticiones()
+        int getNumNodos()
+        int filasMalla()
+        int columnasMalla()
+        const vector[int64_t]& aristasPorParticion()
+        const vector[int64_t]& nodosPorParticion()
+        const EstadisticasBFSParticionado& estadisticasUltimoBFS()
+
+# Particionadores de nodos y aristas con métricas de calidad
+cdef extern from "ParticionGrafo.h" nogil:
+    cdef enum class MetodoParticion:
+        LDG
+        Fennel
+        HDRF
+        Multinivel
+    cdef cppclass ParametrosParticion:
+        ParametrosParticion()
+        MetodoParticion metodo
+        int particiones
+        double desbalanceMaximo
+        double gamma
+        double pesoBalance
+        bint ordenAleatorio
+        uint64_t semilla
+    cdef cppclass MetricasParticion:
+        int particiones
+        int64_t aristasCortadas
+        double fraccionCorte
+        int64_t nodosFrontera
+        double factorReplicacion
+        double desbalance
+        vector[int64_t] carga
+    cdef cppclass ResultadoParticion:
+        vector[int] asignacionNodos
+        vector[int] asignacionAristas
+        MetricasParticion metricas
+    cdef cppclass ParticionadorGrafo:
+        ParticionadorGrafo(const GrafoDisperso& grafo) except +
+        bint particionar(const ParametrosParticion& parametros, ResultadoParticion& resultado)
+        bint evaluarNodos(const vector[int]& asignacion, int particiones, MetricasParticion& metricas)
+        bint evaluarAristas(const vector[int]& asignacion, int particiones, MetricasParticion& metricas)
+        @staticmethod
+        bint escribirAsignacion(const vector[int]& asignacion, const string& ruta)
+
+# Contadores de instrumentación por hilo
+cdef extern from "Metricas.h" nogil:
+    cdef enum class ContadorMetrica:
+        Cantidad
+    cdef enum class MaximoMetrica:
+        Cantidad
+    cdef cppclass PerfilNivelBFS:
+        int64_t frontera
+        int64_t aristas
+        int64_t nanosegundos
+    cdef cppclass InstantaneaMetricas:
+        int64_t* contadores
+        int64_t* maximos
+        vector[PerfilNivelBFS] perfilUltimoBFS
+        int hilos
+    bint metricasActivas()
+    InstantaneaMetricas obtenerMetricas(bint reiniciar)
+    void reiniciarMetricas()
+    void activarMetricas(bint activas)
+    const char* nombreContadorMetrica(ContadorMetrica contador)
+    const char* nombreMaximoMetrica(MaximoMetrica maximo)
+
+cdef extern from "ContabilidadMemoria.h" nogil:
+    cdef enum class CategoriaMemoria:
+        Cantidad
+    cdef cppclass EstadoMemoria:
+        int64_t* actual
+        int64_t* pico
+        int64_t total
+        int64_t totalPico
+        int64_t rss
+        int64_t rssPico
+    EstadoMemoria obtenerEstadoMemoria()
+    void reiniciarPicosMemoria()
+    const char* nombreCategoriaMemoria(CategoriaMemoria categoria)
+
+cdef extern from "ArenaMemoria.h" nogil:
+    cdef enum class ModoPaginasGrandes:
+        Desactivadas
+        Transparentes
+        Explicitas
+    cdef cppclass EstadoPaginasGrandes:
+        ModoPaginasGrandes modo
+        int64_t bytesExplicitas
+        int64_t bytesTransparentes
+        int64_t fallosExplicitas
+    bint configurarPaginasGrandes(ModoPaginasGrandes modo)
+    EstadoPaginasGrandes obtenerEstadoPaginasGrandes()
+    const char* nombreModoPaginasGrandes(ModoPaginasGrandes modo)
+    void liberarMemoriaRetenida()
+
+
+# Operación que ejecuta cada TrabajoAsincrono (decide cómo convertir el resultado)
+cdef enum TipoTrabajo:
+    TRABAJO_CARGA
+    TRABAJO_BFS
+    TRABAJO_DFS
+
+# Nombres de EstadoTrabajo, en el orden del enum de C++
+_ESTADOS_TRABAJO = ('pendiente', 'ejecutando', 'completado', 'cancelado')
+
+# El ejecutor se crea en el primer envío; al salir del intérprete se cancelan
+# los trabajos y se esperan sus hilos antes de que Python deje de existir
+cdef bint _ejecutor_usado = False
+
+# Tipos de tríada dirigida en el orden de CensoTriadas
+_TIPOS_TRIADA = ('003', '012', '102', '021D', '021U', '021C', '111D', '111U',
+                 '030T', '030C', '201', '120D', '120U', '120C', '210', '300')
+
+
+cdef class _ArregloNativo:
+    """
+    Arreglo de enteros de C++ expuesto a NumPy mediante el protocolo buffer.
+    
+    Toma posesión del std::vector por intercambio (sin copiar) y lo mantiene
+    vivo mientras exista algún arreglo de NumPy que lo referencie.
+    """
+    cdef vector[int] _datos
+    cdef Py_ssize_t _forma[2]
+    cdef Py_ssize_t _pasos[2]
+    cdef int _ndim
+    
+    def __getbuffer__(self, Py_buffer* buffer, int flags):
+        buffer.buf = <void*> self._datos.data()
+        buffer.obj = self
+        buffer.len = self._datos.size() * sizeof(int)
+        buffer.itemsize = sizeof(int)
+        buffer.readonly = 0
+        buffer.ndim = self._ndim
+        if flags & PyBUF_FORMAT:
+            buffer.format = 'i'
+        else:
+            buffer.format = NULL
+        buffer.shape = self._forma
+        buffer.strides = self._pasos
+        buffer.suboffsets = NULL
+        buffer.internal = NULL
+    
+    def __releasebuffer__(self, Py_buffer* buffer):
+        pass
+
+
+cdef object _vector_a_numpy(vector[int]& datos, Py_ssize_t filas, Py_ssize_t columnas=-1):
+    """
+    Convierte un vector de C++ en un arreglo NumPy int32 sin copiar.
+    
+    El vector queda vacío: sus datos pasan a pertenecer al arreglo. Con
+    columnas = -1 el resultado es unidimensional.
+    """
+    cdef _ArregloNativo arreglo = _ArregloNativo.__new__(_ArregloNativo)
+    arreglo._datos.swap(datos)
+    
+    if columnas < 0:
+        arreglo._ndim = 1
+        arreglo._forma[0] = filas
+        arreglo._pasos[0] = sizeof(int)
+    else:
+        arreglo._ndim = 2
+        arreglo._forma[0] = filas
+        arreglo._forma[1] = columnas
+        arreglo._pasos[0] = columnas * sizeof(int)
+        arreglo._pasos[1] = sizeof(int)
+    
+    return np.asarray(arreglo)
+
+
+cdef object _vector64_a_numpy(vector[int64_t]& datos, Py_ssize_t filas, Py_ssize_t columnas=-1):
+    """Copia un vector int64 de C++ en un arreglo NumPy (1D, o 2D si columnas >= 0)."""
+    resultado = np.empty(datos.size(), dtype=np.int64)
+    cdef int64_t[::1] vista = resultado
+    cdef size_t i
+    for i in range(datos.size()):
+        vista[i] = datos[i]
+    if columnas >= 0:
+        return resultado.reshape(filas, columnas)
+    return resultado
+
+
+cdef vector[int] _a_vector_nodos(object nodos) except *:
+    """Convierte una secuencia o arreglo de IDs de nodo en vector[int]."""
+    cdef vector[int] resultado
+    cdef int[::1] vista = np.ascontiguousarray(nodos, dtype=np.intc).ravel()
+    if vista.shape[0] > 0:
+        resultado.assign(&vista[0], &vista[0] + vista.shape[0])
+    return resultado
+
+
+def _arreglo_nodos64(nodos):
+    """Convierte una secuencia o arreglo de IDs de nodo en un arreglo int64 contiguo."""
+    return np.ascontiguousarray(nodos, dtype=np.int64).ravel()
+
+
+# Destino de los buffers vacíos (un buffer o arreglo de C++ no debe apuntar a NULL)
+cdef int _SIN_DATOS = 0
+
+
+cdef const int* _puntero_o_nulo(const int[::1] vista):
+    return &vista[0] if vista.shape[0] > 0 else NULL
+
+
+def _arreglo_indices(arreglo, str nombre):
+    """Valida un arreglo 1D de índices int32/int64 y lo devuelve contiguo."""
+    resultado = np.asarray(arreglo)
+    if resultado.dtype != np.int32 and resultado.dtype != np.int64:
+        raise ValueError(f"{nombre} debe ser un arreglo int32 o int64 (es {resultado.dtype}).")
+    if resultado.ndim != 1:
+        raise ValueError(f"{nombre} debe ser unidimensional.")
+    return np.ascontiguousarray(resultado)
+
+
+def _arreglo_pesos(pesos, Py_ssize_t cantidad):
+    """Convierte los pesos opcionales de las aristas en un arreglo int32 contiguo."""
+    if pesos is None:
+        return None
+    resultado = np.asarray(pesos)
+    if not np.issubdtype(resultado.dtype, np.integer) or resultado.ndim != 1:
+        raise ValueError("weights debe ser un arreglo unidimensional de enteros.")
+    if resultado.shape[0] != cantidad:
+        raise ValueError("weights debe tener una entrada por arista.")
+    if resultado.dtype.itemsize > 4 and resultado.shape[0] > 0 and \
+            (resultado.min() < -2**31 or resultado.max() >= 2**31):
+        raise ValueError("weights contiene valores que no caben en int32.")
+    return np.ascontiguousarray(resultado, dtype=np.intc)
+
+
+cdef dict _metricas_particion(MetricasParticion& metricas):
+    """Convierte las métricas de una partición en un diccionario."""
+    return {
+        'particiones': metricas.particiones,
+        'aristas_cortadas': metricas.aristasCortadas,
+        'fraccion_corte': metricas.fraccionCorte,
+        'nodos_frontera': metricas.nodosFrontera,
+        'factor_replicacion': metricas.factorReplicacion,
+        'desbalance': metricas.desbalance,
+        'carga': _vector64_a_numpy(metricas.carga, metricas.carga.size()),
+    }
+
+
+cdef class _ContextoCallback:
+    """Callback de Python y la excepción que haya lanzado durante el cálculo."""
+    cdef object funcion
+    cdef object error
+    
+    def __cinit__(self, funcion):
+        self.funcion = funcion
+        self.error = None
+    
+    def relanzar(self):
+        """Propaga en el hilo que llamó la excepción capturada en el callback."""
+        if self.error is not None:
+            raise self.error
+
+
+cdef bool _callback_progreso(void* contexto, const ProgresoDiametro& progreso) noexcept with gil:
+    """Adaptador C++ -> Python; devolver False desde Python cancela el cálculo."""
+    cdef _ContextoCallback ctx = <_ContextoCallback> contexto
+    try:
+        continuar = ctx.funcion(progreso.bfsRealizados, progreso.cotaInferior,
+                                progreso.cotaSuperior, progreso.pendientes)
+        return continuar is not False
+    except BaseException as e:
+        ctx.error = e
+        return False
+
+
+cdef bool _callback_coincidencia(void* contexto, const int* coincidencia, int k) noexcept with gil:
+    """Adaptador C++ -> Python para el streaming de coincidencias."""
+    cdef _ContextoCallback ctx = <_ContextoCallback> contexto
+    try:
+        continuar = ctx.funcion(tuple([coincidencia[i] for i in range(k)]))
+        return continuar is not False
+    except BaseException as e:
+        ctx.error = e
+        return False
+
+
+cdef void _gancho_tiempo(void* contexto, const EstadisticasRegion& e) noexcept with gil:
+    """Adaptador C++ -> Python para las mediciones del pool de hilos."""
+    cdef _ContextoCallback ctx = <_ContextoCallback> contexto
+    if ctx.funcion is None or ctx.error is not None:
+        return
+    try:
+        ctx.funcion({
+            'nombre': e.nombre.decode('utf-8'),
+            'participantes': e.participantes,
+            'bloques': e.bloques,
+            'robos': e.robos,
+            'segundos': e.segundos,
+            'segundos_ocupados': e.segundosOcupados,
+            'max_ocupado_hilo': e.maxOcupadoHilo,
+        })
+    except BaseException as error:
+        ctx.error = error
+
+
+# Contextos de medición instalados; no se liberan porque una región en
+# curso puede seguir usando el anterior tras reemplazarlo
+_contextos_medicion = []
+_medicion_actual = None
+
 
 cdef class PyGrafoDisperso:
     """
@@ -42,22 +655,58 @@ cdef class PyGrafoDisperso:
     
     Attributes:
         _grafo: Puntero a la instancia C++ de GrafoDisperso
+        _oraculo: Oráculo de distancias por landmarks (vacío hasta construirlo)
+        _indice_pll: Índice PLL de distancias exactas (vacío hasta construirlo)
         _tiempo_carga: Tiempo de carga del último dataset
         _archivo_cargado: Nombre del archivo actualmente cargado
+        _carga_en_curso: Hay una carga asíncrona sin terminar
+        _trabajos_en_curso: Trabajos asíncronos sin terminar (de cualquier tipo)
+        _lecturas_en_curso: Llamadas sin GIL que leen el CSR desde otros hilos
+        _vistas_exportadas: Buffers vivos sobre los arreglos CSR (p. ej. de pickle)
+        _recorridos_activos: Iteradores de recorrer_bfs/recorrer_dfs sin agotar
+        _arreglos_externos: Arreglos NumPy adoptados por desde_csr (o None)
     """
     cdef GrafoDisperso* _grafo
+    cdef OraculoLandmarks* _oraculo
+    cdef IndicePLL* _indice_pll
     cdef double _tiempo_carga
     cdef str _archivo_cargado
+    cdef bint _carga_en_curso
+    cdef int _trabajos_en_curso
+    cdef int _lecturas_en_curso
+    cdef int _vistas_exportadas
+    cdef int _recorridos_activos
+    cdef object _arreglos_externos
     
-    def __cinit__(self):
-        """Inicializa el wrapper creando una nueva instancia de GrafoDisperso"""
+    def __cinit__(self, int hilos=0):
+        """
+        Inicializa el wrapper creando una nueva instancia de GrafoDisperso.
+        
+        Args:
+            hilos: Si es > 0, redimensiona el pool de hilos del proceso
+                (compartido por todos los grafos); si no, se usa
+                NEURONET_HILOS o los hilos de hardware
+        """
+        if hilos > 0 and not PoolHilos.instancia().redimensionar(hilos):
+            print("[Cython] Aviso: El pool de hilos esta ocupado; se mantiene su tamano.")
         self._grafo = new GrafoDisperso()
+        self._oraculo = new OraculoLandmarks()
+        self._indice_pll = new IndicePLL()
         self._tiempo_carga = 0.0
         self._archivo_cargado = ""
+        self._carga_en_curso = False
+        self._trabajos_en_curso = 0
+        self._lecturas_en_curso = 0
+        self._vistas_exportadas = 0
+        self._recorridos_activos = 0
         print("[Cython] Wrapper inicializado correctamente.")
     
     def __dealloc__(self):
         """Libera la memoria del objeto C++"""
+        if self._indice_pll != NULL:
+            del self._indice_pll
+        if self._oraculo != NULL:
+            del self._oraculo
         if self._grafo != NULL:
             del self._grafo
             print("[Cython] Memoria liberada.")
@@ -73,16 +722,22 @@ cdef class PyGrafoDisperso:
             bool: True si la carga fue exitosa
         """
         print(f"[Cython] Solicitud recibida: Cargar archivo '{filename}'")
+        self._exigir_sin_trabajos()
+        self._exigir_sin_lecturas()
+        self._exigir_sin_vistas()
         
         cdef string cpp_filename = filename.encode('utf-8')
         cdef bint resultado
         
         inicio = time.time()
+        self._oraculo.limpiar()
+        self._indice_pll.limpiar()
         resultado = self._grafo.cargarDatos(cpp_filename)
         self._tiempo_carga = time.time() - inicio
         
         if resultado:
             self._archivo_cargado = filename
+            self._arreglos_externos = None
             print(f"[Cython] Archivo cargado exitosamente en {self._tiempo_carga:.3f} segundos.")
         else:
             print("[Cython] Error al cargar el archivo.")
@@ -101,6 +756,7 @@ cdef class PyGrafoDisperso:
             list: Lista de tuplas (nodo, distancia)
         """
         print(f"[Cython] Solicitud recibida: BFS desde Nodo {nodo_inicio}, Profundidad {profundidad_maxima}.")
+        self._exigir_sin_carga()
         
         cdef vector[pair[int, int]] resultado = self._grafo.BFS(nodo_inicio, profundidad_maxima)
         
@@ -121,6 +777,7 @@ cdef class PyGrafoDisperso:
             list: Lista de IDs de nodos visitados
         """
         print(f"[Cython] Solicitud recibida: DFS desde Nodo {nodo_inicio}.")
+        self._exigir_sin_carga()
         
         cdef vector[int] resultado = self._grafo.DFS(nodo_inicio)
         
@@ -128,6 +785,149 @@ cdef class PyGrafoDisperso:
         print(f"[Cython] Retornando {len(py_resultado)} nodos a Python.")
         return py_resultado
     
+    def recorrer_bfs(self, int nodo_inicio, int profundidad_maxima, int tam_bloque=65536):
+        """
+        BFS incremental: entrega el resultado de bfs() por bloques.
+        
+        El recorrido avanza en el núcleo solo cuando se pide el siguiente
+        bloque, así que la memoria no depende del tamaño de la componente
+        y se puede abandonar en cualquier momento. Mientras el iterador
+        siga vivo no se puede recargar el grafo.
+        
+        Args:
+            nodo_inicio: ID del nodo de inicio
+            profundidad_maxima: Límite de profundidad
+            tam_bloque: Máximo de nodos por bloque
+            
+        Returns:
+            IteradorRecorrido que produce tuplas (nodos, distancias) de
+            arreglos NumPy int32; vacío si el nodo de inicio es inválido
+        """
+        self._exigir_sin_carga()
+        if tam_bloque <= 0:
+            raise ValueError("tam_bloque debe ser positivo.")
+        cdef RecorridoIncremental* recorrido = new RecorridoBFSIncremental(
+            deref(self._grafo), nodo_inicio, profundidad_maxima)
+        return IteradorRecorrido.crear(self, recorrido, tam_bloque, True)
+    
+    def recorrer_dfs(self, int nodo_inicio, int tam_bloque=65536):
+        """
+        DFS incremental: entrega el orden de dfs() por bloques.
+        
+        Args:
+            nodo_inicio: ID del nodo de inicio
+            tam_bloque: Máximo de nodos por bloque
+            
+        Returns:
+            IteradorRecorrido que produce arreglos NumPy int32 de nodos;
+            vacío si el nodo de inicio es inválido
+        """
+        self._exigir_sin_carga()
+        if tam_bloque <= 0:
+            raise ValueError("tam_bloque debe ser positivo.")
+        cdef RecorridoIncremental* recorrido = new RecorridoDFSIncremental(
+            deref(self._grafo), nodo_inicio)
+        return IteradorRecorrido.crear(self, recorrido, tam_bloque, False)
+    
+    def cargar_datos_async(self, str filename):
+        """
+        Carga un dataset en el ejecutor nativo sin bloquear al que llama.
+        
+        El progreso es (bytes leídos, tamaño del archivo). Al terminar con
+        éxito se actualizan tiempo_carga y archivo_cargado y se descartan
+        el oráculo y el índice PLL; si se cancela o falla, el grafo
+        anterior queda intacto. Mientras dure la carga no se admiten
+        consultas sobre este grafo, y no se puede empezar mientras otro
+        hilo tenga una consulta en curso.
+        
+        Args:
+            filename: Ruta al archivo en formato Edge List
+            
+        Returns:
+            TrabajoAsincrono cuyo future se resuelve con True/False
+        """
+        print(f"[Cython] Solicitud recibida: Cargar archivo '{filename}' (asincrono)")
+        self._exigir_sin_trabajos()
+        self._exigir_sin_lecturas()
+        self._exigir_sin_vistas()
+        
+        cdef TrabajoCarga* trabajo = new TrabajoCarga(deref(self._grafo), filename.encode('utf-8'))
+        envoltorio = self._enviar(trabajo, TRABAJO_CARGA)
+        if envoltorio is not None:
+            self._carga_en_curso = True
+        return envoltorio
+    
+    def bfs_async(self, int nodo_inicio, int profundidad_maxima):
+        """
+        Versión asíncrona de bfs(); el progreso es (nivel, profundidad máxima).
+        
+        Returns:
+            TrabajoAsincrono cuyo future se resuelve con la lista de
+            tuplas (nodo, distancia)
+        """
+        print(f"[Cython] Solicitud recibida: BFS asincrono desde Nodo {nodo_inicio}.")
+        self._exigir_sin_carga()
+        return self._enviar(new TrabajoBFS(deref(self._grafo), nodo_inicio, profundidad_maxima),
+                            TRABAJO_BFS)
+    
+    def dfs_async(self, int nodo_inicio):
+        """
+        Versión asíncrona de dfs(); el progreso es (nodos visitados, nodos).
+        
+        Returns:
+            TrabajoAsincrono cuyo future se resuelve con la lista de nodos
+        """
+        print(f"[Cython] Solicitud recibida: DFS asincrono desde Nodo {nodo_inicio}.")
+        self._exigir_sin_carga()
+        return self._enviar(new TrabajoDFS(deref(self._grafo), nodo_inicio), TRABAJO_DFS)
+    
+    cdef object _enviar(self, Trabajo* trabajo, TipoTrabajo tipo):
+        """Envuelve el trabajo, lo encola y mantiene vivo el envoltorio hasta el callback."""
+        global _ejecutor_usado
+        cdef TrabajoAsincrono envoltorio = TrabajoAsincrono.__new__(TrabajoAsincrono)
+        envoltorio._trabajo = trabajo
+        envoltorio._tipo = tipo
+        envoltorio._grafo = self
+        envoltorio.future = concurrent.futures.Future()
+        envoltorio.future.add_done_callback(envoltorio._al_resolver)
+        trabajo.alTerminar = _trabajo_terminado
+        trabajo.contexto = <void*> envoltorio
+        
+        _ejecutor_usado = True
+        Py_INCREF(envoltorio)
+        if not EjecutorTrabajos.instancia().enviar(trabajo):
+            Py_DECREF(envoltorio)
+            print("[Cython] Error: El ejecutor de trabajos ya se detuvo.")
+            return None
+        self._trabajos_en_curso += 1
+        return envoltorio
+    
+    cdef _exigir_sin_carga(self):
+        if self._carga_en_curso:
+            raise RuntimeError("Hay una carga asincrona en curso sobre este grafo.")
+    
+    cdef _empezar_lectura(self):
+        """Registra una llamada que va a leer el CSR sin el GIL (cerrar con _terminar_lectura)."""
+        self._exigir_sin_carga()
+        self._lecturas_en_curso += 1
+    
+    cdef _terminar_lectura(self):
+        self._lecturas_en_curso -= 1
+    
+    cdef _exigir_sin_lecturas(self):
+        if self._lecturas_en_curso > 0:
+            raise RuntimeError("Hay consultas en curso sobre este grafo en otros hilos.")
+    
+    cdef _exigir_sin_trabajos(self):
+        if self._trabajos_en_curso > 0:
+            raise RuntimeError("Hay trabajos asincronos en curso sobre este grafo.")
+    
+    cdef _exigir_sin_vistas(self):
+        if self._vistas_exportadas > 0:
+            raise BufferError("Hay buffers en uso sobre los arreglos de este grafo.")
+        if self._recorridos_activos > 0:
+            raise RuntimeError("Hay recorridos incrementales en curso sobre este grafo.")
+    
     def obtener_grado(self, int nodo) -> int:
         """
         Obtiene el grado de salida de un nodo.
@@ -138,6 +938,7 @@ cdef class PyGrafoDisperso:
         Returns:
             int: Grado de salida del nodo
         """
+        self._exigir_sin_carga()
         return self._grafo.obtenerGrado(nodo)
     
     def obtener_grado_entrada(self, int nodo) -> int:
@@ -150,6 +951,7 @@ cdef class PyGrafoDisperso:
         Returns:
             int: Grado de entrada del nodo
         """
+        self._exigir_sin_carga()
         return self._grafo.obtenerGradoEntrada(nodo)
     
     def get_vecinos(self, int nodo) -> list:
@@ -162,9 +964,120 @@ cdef class PyGrafoDisperso:
         Returns:
             list: Lista de IDs de nodos vecinos
         """
+        self._exigir_sin_carga()
         cdef vector[int] vecinos = self._grafo.getVecinos(nodo)
         return list(vecinos)
     
+    def obtener_grados(self, nodos):
+        """
+        Grado de salida de muchos nodos en una sola llamada.
+        
+        Args:
+            nodos: Secuencia o arreglo de IDs de nodo
+            
+        Returns:
+            numpy.ndarray: Grados (int32) en el orden de nodos; -1 para IDs inválidos
+        """
+        self._exigir_sin_carga()
+        cdef const int64_t[::1] ids = _arreglo_nodos64(nodos)
+        resultado = np.empty(ids.shape[0], dtype=np.intc)
+        cdef int[::1] grados = resultado
+        cdef VistaCSR vista
+        cdef Py_ssize_t i
+        cdef int64_t nodo
+        self._empezar_lectura()
+        try:
+            vista = self._grafo.vistaCSR()
+            with nogil:
+                for i in range(ids.shape[0]):
+                    nodo = ids[i]
+                    if 0 <= nodo < vista.numNodos:
+                        grados[i] = vista.rowPtr[nodo + 1] - vista.rowPtr[nodo]
+                    else:
+                        grados[i] = -1
+        finally:
+            self._terminar_lectura()
+        return resultado
+    
+    def obtener_grados_entrada(self, nodos):
+        """
+        Grado de entrada de muchos nodos en una sola llamada.
+        
+        Args:
+            nodos: Secuencia o arreglo de IDs de nodo
+            
+        Returns:
+            numpy.ndarray: Grados (int32) en el orden de nodos; -1 para IDs inválidos
+        """
+        self._exigir_sin_carga()
+        cdef const int64_t[::1] ids = _arreglo_nodos64(nodos)
+        resultado = np.empty(ids.shape[0], dtype=np.intc)
+        cdef int[::1] grados = resultado
+        cdef VistaCSR vista
+        cdef Py_ssize_t i
+        cdef int64_t nodo
+        self._empezar_lectura()
+        try:
+            vista = self._grafo.vistaCSR()
+            with nogil:
+                for i in range(ids.shape[0]):
+                    nodo = ids[i]
+                    if 0 <= nodo < vista.numNodos:
+                        grados[i] = vista.gradoEntrada[nodo]
+                    else:
+                        grados[i] = -1
+        finally:
+            self._terminar_lectura()
+        return resultado
+    
+    def get_vecinos_lote(self, nodos):
+        """
+        Vecinos de muchos nodos en una sola llamada, en formato CSR.
+        
+        Los vecinos de nodos[i] son valores[offsets[i]:offsets[i + 1]], en el
+        mismo orden que get_vecinos(nodos[i]); un ID inválido da un tramo vacío.
+        
+        Args:
+            nodos: Secuencia o arreglo de IDs de nodo
+            
+        Returns:
+            tuple: (offsets, valores) como arreglos NumPy int64 e int32
+        """
+        cdef const int64_t[::1] ids = _arreglo_nodos64(nodos)
+        cdef Py_ssize_t cantidad = ids.shape[0]
+        offsets = np.empty(cantidad + 1, dtype=np.int64)
+        cdef int64_t[::1] v_offsets = offsets
+        cdef int[::1] v_valores
+        cdef VistaCSR vista
+        cdef Py_ssize_t i
+        cdef int64_t nodo
+        cdef int grado
+        # Una sola lectura para las dos pasadas: entre ellas se reserva
+        # `valores` con el GIL y una recarga liberaría los arreglos de `vista`
+        self._empezar_lectura()
+        try:
+            vista = self._grafo.vistaCSR()
+            with nogil:
+                v_offsets[0] = 0
+                for i in range(cantidad):
+                    nodo = ids[i]
+                    grado = 0
+                    if 0 <= nodo < vista.numNodos:
+                        grado = vista.rowPtr[nodo + 1] - vista.rowPtr[nodo]
+                    v_offsets[i + 1] = v_offsets[i] + grado
+            
+            valores = np.empty(v_offsets[cantidad], dtype=np.intc)
+            v_valores = valores
+            with nogil:
+                for i in range(cantidad):
+                    nodo = ids[i]
+                    if v_offsets[i + 1] > v_offsets[i]:
+                        memcpy(&v_valores[v_offsets[i]], &vista.columnas[vista.rowPtr[nodo]],
+                               (v_offsets[i + 1] - v_offsets[i]) * sizeof(int))
+        finally:
+            self._terminar_lectura()
+        return offsets, valores
+    
     def get_num_nodos(self) -> int:
         """Retorna el número total de nodos en el grafo."""
         return self._grafo.getNumNodos()
@@ -180,6 +1093,7 @@ cdef class PyGrafoDisperso:
         Returns:
             tuple: (id_nodo, grado)
         """
+        self._exigir_sin_carga()
         print("[Cython] Solicitud recibida: Obtener nodo con mayor grado.")
         
         cdef pair[int, int] resultado = self._grafo.getNodoMayorGrado()
@@ -215,6 +1129,7 @@ cdef class PyGrafoDisperso:
         Returns:
             list: Lista de tuplas (origen, destino)
         """
+        self._exigir_sin_carga()
         print(f"[Cython] Solicitud recibida: Subgrafo desde Nodo {nodo_inicio}.")
         
         cdef vector[pair[int, int]] aristas = self._grafo.getAristasSubgrafo(
@@ -226,35 +1141,2004 @@ cdef class PyGrafoDisperso:
         print(f"[Cython] Retornando lista de adyacencia local a Python.")
         return py_aristas
     
-    def print_debug_info(self):
-        """Imprime información de debug del grafo."""
-        self._grafo.printDebugInfo()
+    def get_aristas_subgrafos_lote(self, semillas, int profundidad_maxima) -> tuple:
+        """
+        Obtiene las redes ego de muchas semillas en una sola llamada.
+        
+        Cada red contiene las mismas aristas que get_aristas_subgrafo; las
+        semillas inválidas producen una red vacía.
+        
+        Args:
+            semillas: Secuencia o arreglo de nodos centrales
+            profundidad_maxima: Profundidad máxima de búsqueda
+            
+        Returns:
+            tuple: (offsets, aristas) donde offsets es int64 de tamaño
+                   len(semillas) + 1 y aristas[offsets[i]:offsets[i+1]] es
+                   el arreglo (E_i, 2) de la red de la semilla i
+        """
+        self._exigir_sin_carga()
+        print(f"[Cython] Solicitud recibida: Redes ego en lote (profundidad {profundidad_maxima}).")
+        
+        cdef vector[int] cpp_semillas = _a_vector_nodos(semillas)
+        cdef vector[int64_t] offsets
+        cdef vector[int] aristas
+        cdef int64_t total
+        self._empezar_lectura()
+        try:
+            with nogil:
+                total = self._grafo.aristasSubgrafoLote(cpp_semillas, profundidad_maxima,
+                                                        offsets, aristas)
+        finally:
+            self._terminar_lectura()
+        
+        return _vector64_a_numpy(offsets, offsets.size()), _vector_a_numpy(aristas, total, 2)
     
-    @property
-    def tiempo_carga(self) -> float:
-        """Tiempo de carga del último dataset."""
-        return self._tiempo_carga
+    def extraer_subgrafo(self, nodos):
+        """
+        Extrae el subgrafo inducido por un conjunto de nodos.
+        
+        El resultado es un grafo nuevo, compacto y reetiquetado: el nodo
+        local i corresponde al i-ésimo ID original en orden creciente
+        (ver ids_originales()).
+        
+        Args:
+            nodos: Secuencia o arreglo de IDs de nodo
+            
+        Returns:
+            PyGrafoDisperso: El subgrafo, o None si algún ID es inválido
+        """
+        self._exigir_sin_carga()
+        cdef vector[int] cpp_nodos = _a_vector_nodos(nodos)
+        cdef PyGrafoDisperso subgrafo = PyGrafoDisperso()
+        cdef bint resultado
+        self._empezar_lectura()
+        try:
+            with nogil:
+                resultado = self._grafo.extraerSubgrafo(cpp_nodos, deref(subgrafo._grafo))
+        finally:
+            self._terminar_lectura()
+        return subgrafo if resultado else None
     
-    @property
-    def archivo_cargado(self) -> str:
-        """Nombre del archivo actualmente cargado."""
-        return self._archivo_cargado
+    def extraer_subgrafo_bfs(self, int nodo_inicio, int profundidad_maxima):
+        """
+        Extrae el subgrafo inducido por los nodos a distancia <= profundidad_maxima.
+        
+        A diferencia de get_aristas_subgrafo, incluye también las aristas
+        entre los nodos del último nivel.
+        
+        Args:
+            nodo_inicio: Nodo central
+            profundidad_maxima: Profundidad máxima de búsqueda
+            
+        Returns:
+            PyGrafoDisperso: El subgrafo, o None si los parámetros son inválidos
+        """
+        self._exigir_sin_carga()
+        print(f"[Cython] Solicitud recibida: Subgrafo inducido desde Nodo {nodo_inicio}.")
+        cdef PyGrafoDisperso subgrafo = PyGrafoDisperso()
+        cdef bint resultado
+        self._empezar_lectura()
+        try:
+            with nogil:
+                resultado = self._grafo.extraerSubgrafoBFS(nodo_inicio, profundidad_maxima,
+                                                           deref(subgrafo._grafo))
+        finally:
+            self._terminar_lectura()
+        return subgrafo if resultado else None
     
-    def get_estadisticas(self) -> dict:
+    def muestrear_subgrafo(self, int nodo_inicio, int profundidad_maxima, int max_nodos=2000,
+                           int64_t max_aristas=0, str estrategia='fuego', semilla=42,
+                           double prob_quema=0.7, double prob_reinicio=0.15):
         """
-        Obtiene estadísticas generales del grafo.
+        Muestra representativa de la bola BFS de un nodo bajo un presupuesto.
+        
+        A diferencia de truncar el recorrido, la muestra cubre toda la bola:
+        'fuego' (fuego forestal) y 'caminata' (caminata con reinicio)
+        conservan la conectividad local; 'grado' reparte el presupuesto en
+        estratos de grado proporcionales a su tamaño. Si la bola cabe en el
+        presupuesto se devuelve completa. El nodo central siempre se incluye.
         
+        Args:
+            nodo_inicio: Nodo central
+            profundidad_maxima: Radio de la bola
+            max_nodos: Presupuesto de nodos
+            max_aristas: Presupuesto de aristas inducidas (0 = sin límite)
+            estrategia: 'fuego', 'caminata' o 'grado'
+            semilla: Semilla del muestreo
+            prob_quema: Fuego forestal: cada nodo quema en media p / (1 - p) vecinos
+            prob_reinicio: Caminata: probabilidad de volver al nodo central
+            
         Returns:
-            dict: Diccionario con estadísticas
+            dict con 'subgrafo' (PyGrafoDisperso inducido por la muestra),
+            'nodos' (IDs originales crecientes: el nodo local i es nodos[i]),
+            'niveles' y 'ocultos' (vecinos de la bola que quedaron fuera) por
+            nodo, 'podados_por_nivel', y los totales 'nodos_bola',
+            'aristas_bola' y 'aristas_muestra'; None si los parámetros son
+            inválidos
         """
-        nodo_max, grado_max = self.get_nodo_mayor_grado()
+        print(f"[Cython] Solicitud recibida: Muestreo ({estrategia}) de la bola de Nodo "
+              f"{nodo_inicio}, radio {profundidad_maxima}, hasta {max_nodos} nodos.")
+        self._exigir_sin_carga()
         
+        cdef ParametrosMuestreo parametros
+        if estrategia == 'fuego':
+            parametros.estrategia = EstrategiaMuestreo.FuegoForestal
+        elif estrategia == 'caminata':
+            parametros.estrategia = EstrategiaMuestreo.CaminataAleatoria
+        elif estrategia == 'grado':
+            parametros.estrategia = EstrategiaMuestreo.EstratificadoGrado
+        else:
+            raise ValueError(f"Estrategia desconocida: {estrategia!r}")
+        parametros.maxNodos = max_nodos
+        parametros.maxAristas = max_aristas
+        parametros.probQuema = prob_quema
+        parametros.probReinicio = prob_reinicio
+        parametros.semilla = <uint64_t> semilla
+        
+        cdef MuestraSubgrafo muestra
+        cdef MuestreadorSubgrafo* muestreador
+        cdef bint resultado
+        cdef PyGrafoDisperso subgrafo = PyGrafoDisperso()
+        self._empezar_lectura()
+        try:
+            with nogil:
+                muestreador = new MuestreadorSubgrafo(deref(self._grafo))
+                resultado = muestreador.muestrear(nodo_inicio, profundidad_maxima, parametros, muestra)
+                del muestreador
+                if resultado:
+                    resultado = self._grafo.extraerSubgrafo(muestra.nodos, deref(subgrafo._grafo))
+        finally:
+            self._terminar_lectura()
+        if not resultado:
+            return None
+        
+        cdef Py_ssize_t cantidad = muestra.nodos.size()
         return {
-            'num_nodos': self.get_num_nodos(),
-            'num_aristas': self.get_num_aristas(),
-            'memoria_mb': self.get_memoria_usada_mb(),
-            'tiempo_carga': self._tiempo_carga,
-            'archivo': self._archivo_cargado,
-            'nodo_mayor_grado': nodo_max,
-            'mayor_grado': grado_max
+            'subgrafo': subgrafo,
+            'nodos': _vector_a_numpy(muestra.nodos, cantidad),
+            'niveles': _vector_a_numpy(muestra.niveles, cantidad),
+            'ocultos': _vector_a_numpy(muestra.ocultos, cantidad),
+            'podados_por_nivel': _vector_a_numpy(muestra.podadosPorNivel,
+                                                 muestra.podadosPorNivel.size()),
+            'nodos_bola': muestra.nodosBola,
+            'aristas_bola': muestra.aristasBola,
+            'aristas_muestra': muestra.aristasMuestra,
+        }
+    
+    def calcular_particion(self, int particiones=4, str metodo='fennel', double desbalance=1.1,
+                           double gamma=1.5, double peso_balance=1.0, bint orden_aleatorio=False,
+                           semilla=42, archivo=None):
+        """
+        Calcula una partición del grafo y sus métricas de calidad.
+        
+        'ldg' y 'fennel' reparten los nodos en una pasada (streaming);
+        'hdrf' reparte las aristas replicando primero los nodos de grado
+        alto; 'multinivel' engrosa el grafo, lo parte y refina la frontera
+        al deshacer el engrosamiento (más lento, menor corte). Los métodos
+        de nodos nunca superan desbalance * n / particiones nodos por
+        partición.
+        
+        Args:
+            particiones: Número de particiones
+            metodo: 'ldg', 'fennel', 'hdrf' o 'multinivel'
+            desbalance: Carga máxima relativa a la media (métodos de nodos)
+            gamma: Fennel: exponente del coste de tamaño
+            peso_balance: HDRF: peso del término de balance
+            orden_aleatorio: Recorrer los nodos en orden aleatorio en lugar de por ID
+            semilla: Semilla del orden aleatorio y del multinivel
+            archivo: Si se indica, escribe la asignación de nodos (una
+                partición por línea, formato METIS)
+            
+        Returns:
+            dict con 'asignacion' (partición de cada nodo, int32; en HDRF la
+            réplica maestra), 'asignacion_aristas' (HDRF: partición de cada
+            arista en orden CSR; None en los demás) y 'metricas' (ver
+            evaluar_particion); None si los parámetros son inválidos
+        """
+        print(f"[Cython] Solicitud recibida: Calcular particion ({metodo}) en {particiones} partes.")
+        self._exigir_sin_carga()
+        
+        cdef ParametrosParticion parametros
+        if metodo == 'ldg':
+            parametros.metodo = MetodoParticion.LDG
+        elif metodo == 'fennel':
+            parametros.metodo = MetodoParticion.Fennel
+        elif metodo == 'hdrf':
+            parametros.metodo = MetodoParticion.HDRF
+        elif metodo == 'multinivel':
+            parametros.metodo = MetodoParticion.Multinivel
+        else:
+            raise ValueError(f"Metodo desconocido: {metodo!r}")
+        parametros.particiones = particiones
+        parametros.desbalanceMaximo = desbalance
+        parametros.gamma = gamma
+        parametros.pesoBalance = peso_balance
+        parametros.ordenAleatorio = orden_aleatorio
+        parametros.semilla = <uint64_t> semilla
+        
+        cdef ResultadoParticion resultado
+        cdef ParticionadorGrafo* particionador
+        cdef bint ok
+        self._empezar_lectura()
+        try:
+            with nogil:
+                particionador = new ParticionadorGrafo(deref(self._grafo))
+                ok = particionador.particionar(parametros, resultado)
+                del particionador
+        finally:
+            self._terminar_lectura()
+        if not ok:
+            return None
+        cdef string cpp_archivo
+        if archivo is not None:
+            cpp_archivo = str(archivo).encode('utf-8')
+            with nogil:
+                ok = ParticionadorGrafo.escribirAsignacion(resultado.asignacionNodos, cpp_archivo)
+            if not ok:
+                return None
+        
+        aristas = None
+        if parametros.metodo == MetodoParticion.HDRF:
+            aristas = _vector_a_numpy(resultado.asignacionAristas, resultado.asignacionAristas.size())
+        return {
+            'asignacion': _vector_a_numpy(resultado.asignacionNodos, resultado.asignacionNodos.size()),
+            'asignacion_aristas': aristas,
+            'metricas': _metricas_particion(resultado.metricas),
         }
+    
+    def evaluar_particion(self, asignacion, int particiones=0, bint por_aristas=False):
+        """
+        Métricas de calidad de una asignación cualquiera (por ejemplo, el
+        orden de IDs en bloques, para comparar con calcular_particion).
+        
+        Args:
+            asignacion: Partición de cada nodo o, con por_aristas, de cada
+                arista en orden CSR
+            particiones: Número de particiones (0 = máximo de la asignación + 1)
+            por_aristas: La asignación es de aristas (vertex-cut)
+            
+        Returns:
+            dict con 'aristas_cortadas' y 'fraccion_corte' (aristas entre
+            particiones distintas; 0 en asignaciones de aristas),
+            'nodos_frontera' (nodos presentes en más de una partición),
+            'factor_replicacion' (copias por nodo contando los fantasmas),
+            'desbalance' (carga máxima / media) y 'carga' por partición
+            (nodos o aristas); None si la asignación es inválida
+        """
+        self._exigir_sin_carga()
+        cdef vector[int] cpp_asignacion = _a_vector_nodos(asignacion)
+        if particiones <= 0 and cpp_asignacion.size() > 0:
+            particiones = max(0, int(np.max(np.asarray(asignacion)))) + 1
+        cdef MetricasParticion metricas
+        cdef ParticionadorGrafo* particionador
+        cdef bint ok
+        self._empezar_lectura()
+        try:
+            with nogil:
+                particionador = new ParticionadorGrafo(deref(self._grafo))
+                if por_aristas:
+                    ok = particionador.evaluarAristas(cpp_asignacion, particiones, metricas)
+                else:
+                    ok = particionador.evaluarNodos(cpp_asignacion, particiones, metricas)
+                del particionador
+        finally:
+            self._terminar_lectura()
+        return _metricas_particion(metricas) if ok else None
+    
+    def particionar(self, int particiones=4, str esquema='2d', asignacion=None):
+        """
+        Reparte el grafo entre procesos trabajadores para BFS distribuido.
+        
+        Cada partición vive en un proceso propio (fork) y los procesos
+        intercambian las fronteras por sockets locales, de modo que el
+        recorrido suma el ancho de banda de memoria de varios procesos.
+        '1d' da a cada proceso los nodos de una partición con sus aristas
+        de salida; '2d' reparte la matriz de adyacencia en una malla R x C
+        y cada proceso solo se comunica con su fila y su columna. Solo en
+        POSIX.
+        
+        Args:
+            particiones: Número de procesos trabajadores
+            esquema: '1d' o '2d'
+            asignacion: Partición de cada nodo (por ejemplo, la de
+                calcular_particion); None reparte tramos contiguos de IDs
+            
+        Returns:
+            PyGrafoParticionado, o None si la asignación es inválida o no
+            se pudieron crear los procesos
+        """
+        print(f"[Cython] Solicitud recibida: Particionar en {particiones} procesos ({esquema}).")
+        self._exigir_sin_carga()
+        cdef EsquemaParticion cpp_esquema
+        if esquema == '1d':
+            cpp_esquema = EsquemaParticion.Filas1D
+        elif esquema == '2d':
+            cpp_esquema = EsquemaParticion.Bloques2D
+        else:
+            raise ValueError(f"Esquema desconocido: {esquema!r}")
+        
+        cdef vector[int] cpp_asignacion
+        if asignacion is not None:
+            cpp_asignacion = _a_vector_nodos(asignacion)
+        cdef PyGrafoParticionado particionado = PyGrafoParticionado.__new__(PyGrafoParticionado)
+        cdef bint resultado
+        self._empezar_lectura()
+        try:
+            with nogil:
+                resultado = particionado._grafo.iniciar(deref(self._grafo), particiones, cpp_esquema,
+                                                        cpp_asignacion)
+        finally:
+            self._terminar_lectura()
+        if not resultado:
+            return None
+        particionado._esquema = esquema
+        return particionado
+    
+    def ids_originales(self):
+        """
+        Correspondencia nodo local -> ID original de un subgrafo extraído.
+        
+        Returns:
+            numpy.ndarray: IDs originales (int32); vacío si el grafo se cargó de archivo
+        """
+        self._exigir_sin_carga()
+        return np.array(self._grafo.getIdsOriginales(), dtype=np.intc)
+    
+    @staticmethod
+    def desde_arrays(src, dst, weights=None):
+        """
+        Construye un grafo a partir de arreglos de aristas en memoria.
+        
+        Equivale a cargar un Edge List con las aristas (src[i], dst[i])
+        (num_nodos = máximo ID + 1), sin escribir ningún archivo ni crear
+        objetos Python por arista: los arreglos se leen directamente desde
+        la construcción CSR paralela.
+        
+        Args:
+            src: Arreglo 1D int32 o int64 con el origen de cada arista
+            dst: Arreglo 1D int32 o int64 con el destino de cada arista
+            weights: Pesos enteros de las aristas (por defecto, 1)
+            
+        Returns:
+            PyGrafoDisperso: El grafo, o None si algún ID es negativo o no cabe en int32
+        """
+        origenes = _arreglo_indices(src, "src")
+        destinos = _arreglo_indices(dst, "dst")
+        if origenes.shape[0] != destinos.shape[0]:
+            raise ValueError("src y dst deben tener la misma longitud.")
+        if origenes.dtype != destinos.dtype:
+            origenes = origenes.astype(np.int64)
+            destinos = destinos.astype(np.int64)
+        pesos = _arreglo_pesos(weights, origenes.shape[0])
+        print(f"[Cython] Solicitud recibida: Construir grafo desde {origenes.shape[0]} aristas.")
+        
+        cdef PyGrafoDisperso grafo = PyGrafoDisperso()
+        cdef const int* p_pesos = _puntero_o_nulo(pesos) if pesos is not None else NULL
+        cdef const int32_t[::1] o32
+        cdef const int32_t[::1] d32
+        cdef const int64_t[::1] o64
+        cdef const int64_t[::1] d64
+        cdef int64_t cantidad = origenes.shape[0]
+        cdef bint resultado
+        if origenes.dtype == np.int32:
+            o32 = origenes
+            d32 = destinos
+            with nogil:
+                resultado = grafo._grafo.construirDesdeAristas(
+                    &o32[0] if cantidad > 0 else NULL,
+                    &d32[0] if cantidad > 0 else NULL,
+                    p_pesos, cantidad)
+        else:
+            o64 = origenes
+            d64 = destinos
+            with nogil:
+                resultado = grafo._grafo.construirDesdeAristas(
+                    &o64[0] if cantidad > 0 else NULL,
+                    &d64[0] if cantidad > 0 else NULL,
+                    p_pesos, cantidad)
+        return grafo if resultado else None
+    
+    @staticmethod
+    def desde_csr(row_ptr, column_indices, weights=None):
+        """
+        Crea un grafo que usa arreglos CSR ya construidos tal cual, sin copiarlos.
+        
+        Las filas deben venir ordenadas por destino (como las produce el
+        núcleo); solo se valida la estructura y se calcula el grado de
+        entrada. Los arreglos int32 contiguos se usan directamente y el grafo
+        los mantiene vivos: no deben modificarse mientras el grafo exista.
+        Los de otro tipo entero se convierten (una copia).
+        
+        Args:
+            row_ptr: Punteros de fila (num_nodos + 1 entradas, empieza en 0)
+            column_indices: Destinos de las aristas, ordenados dentro de cada fila
+            weights: Pesos enteros de las aristas (por defecto, 1)
+            
+        Returns:
+            PyGrafoDisperso: El grafo, o None si los arreglos no forman un CSR válido
+        """
+        filas = _arreglo_indices(row_ptr, "row_ptr")
+        columnas = _arreglo_indices(column_indices, "column_indices")
+        if filas.shape[0] == 0:
+            raise ValueError("row_ptr debe tener al menos una entrada.")
+        # La conversión a int32 truncaría en silencio los valores que no caben
+        for arreglo in (filas, columnas):
+            if arreglo.shape[0] > 0 and (arreglo.min() < 0 or arreglo.max() >= 2**31 - 1):
+                print("[Cython] Error: Los indices CSR deben estar en [0, 2^31 - 1).")
+                return None
+        filas = filas.astype(np.intc, copy=False)
+        columnas = columnas.astype(np.intc, copy=False)
+        pesos = _arreglo_pesos(weights, columnas.shape[0])
+        print(f"[Cython] Solicitud recibida: Adoptar CSR de {filas.shape[0] - 1} nodos.")
+        
+        cdef PyGrafoDisperso grafo = PyGrafoDisperso()
+        cdef const int[::1] v_filas = filas
+        cdef const int[::1] v_columnas = columnas
+        cdef const int* p_columnas = _puntero_o_nulo(v_columnas)
+        cdef const int* p_pesos = _puntero_o_nulo(pesos) if pesos is not None else NULL
+        cdef int nodos = v_filas.shape[0] - 1
+        cdef int aristas = v_columnas.shape[0]
+        cdef bint resultado
+        if p_columnas == NULL:
+            p_columnas = &_SIN_DATOS
+        with nogil:
+            resultado = grafo._grafo.adoptarCSR(&v_filas[0], p_columnas, p_pesos, nodos, aristas)
+        if not resultado:
+            return None
+        grafo._arreglos_externos = (filas, columnas, pesos)
+        return grafo
+    
+    def publicar(self, str nombre, bint archivo=False) -> bool:
+        """
+        Publica la estructura CSR para que otros procesos la adjunten sin copiarla.
+        
+        En memoria (por defecto) se crea un segmento POSIX con nombre y este
+        grafo pasa a leer de él, sin conservar una copia privada. El nombre
+        deja de existir cuando este grafo se destruye o se vuelve a cargar;
+        los procesos ya adjuntos no se ven afectados. Con archivo=True se
+        escribe una instantánea mapeable que permanece en disco.
+        
+        Args:
+            nombre: Nombre del segmento (p. ej. "/neuronet_grafo") o ruta
+                de la instantánea si archivo es True
+            archivo: Escribir una instantánea en disco en lugar de un segmento
+            
+        Returns:
+            bool: True si se publicó; False si el nombre ya existe o hubo error
+        """
+        print(f"[Cython] Solicitud recibida: Publicar grafo en '{nombre}'.")
+        self._exigir_sin_trabajos()
+        self._exigir_sin_lecturas()
+        if not archivo:
+            self._exigir_sin_vistas()
+        cdef string cpp_nombre = nombre.encode('utf-8')
+        cdef bint resultado
+        with nogil:
+            resultado = self._grafo.publicarCompartido(cpp_nombre, archivo)
+        if resultado and not archivo:
+            self._arreglos_externos = None
+        return resultado
+    
+    @staticmethod
+    def adjuntar(str nombre, bint archivo=False):
+        """
+        Adjunta de solo lectura un grafo publicado por otro proceso.
+        
+        Los arreglos CSR no se copian: todas las consultas leen del mapeo,
+        compartido por los procesos adjuntos, así que N trabajadores no
+        multiplican la memoria por N. El grafo resultante admite todas las
+        consultas; volver a cargar datos en él lo desvincula del segmento.
+        
+        Args:
+            nombre: Nombre usado en publicar()
+            archivo: El nombre es la ruta de una instantánea en disco
+            
+        Returns:
+            PyGrafoDisperso: El grafo adjunto, o None si no existe o no es válido
+        """
+        print(f"[Cython] Solicitud recibida: Adjuntar grafo compartido '{nombre}'.")
+        cdef string cpp_nombre = nombre.encode('utf-8')
+        cdef PyGrafoDisperso grafo = PyGrafoDisperso()
+        cdef bint resultado
+        with nogil:
+            resultado = grafo._grafo.adjuntarCompartido(cpp_nombre, archivo)
+        if not resultado:
+            return None
+        grafo._archivo_cargado = nombre
+        return grafo
+    
+    @staticmethod
+    def eliminar_publicacion(str nombre) -> bool:
+        """
+        Elimina el nombre de un segmento publicado (p. ej. si su publicador terminó
+        de forma abrupta). Los procesos adjuntos conservan su mapeo.
+        
+        Returns:
+            bool: True si el segmento existía
+        """
+        return GrafoDisperso.eliminarCompartido(nombre.encode('utf-8'))
+    
+    @property
+    def es_compartido(self) -> bool:
+        """True si la estructura CSR vive en un segmento compartido o instantánea."""
+        return self._grafo.esCompartido()
+    
+    def __reduce_ex__(self, protocol):
+        """
+        Serializa la estructura CSR para pickle sin pasar por texto.
+        
+        Con el protocolo 5 los arreglos viajan como PickleBuffer: con
+        buffer_callback quedan fuera de banda y no se copian al serializar;
+        dentro de banda se copian una sola vez al flujo. Con protocolos
+        anteriores se copian a bytes. Al reconstruir, cada arreglo se copia
+        una vez al grafo nuevo. El oráculo y el índice PLL no se incluyen.
+        
+        Mientras exista un PickleBuffer de este grafo no se puede volver a
+        cargar ni publicar en memoria (BufferError).
+        """
+        self._exigir_sin_carga()
+        cdef VistaCSR vista = self._grafo.vistaCSR()
+        cdef const int* ids = self._grafo.datosIdsOriginales()
+        arreglos = (
+            _VistaGrafo.crear(self, vista.rowPtr, vista.numNodos + 1 if vista.rowPtr != NULL else 0),
+            _VistaGrafo.crear(self, vista.columnas, vista.numAristas),
+            _VistaGrafo.crear(self, vista.valores, vista.numAristas),
+            _VistaGrafo.crear(self, ids, vista.numNodos if ids != NULL else 0),
+        )
+        if protocol >= 5:
+            buffers = tuple(pickle.PickleBuffer(arreglo) for arreglo in arreglos)
+        else:
+            buffers = tuple(bytes(arreglo) for arreglo in arreglos)
+        return (_reconstruir_grafo,
+                (vista.numNodos, vista.numAristas) + buffers + (sys.byteorder, self._archivo_cargado))
+    
+    def caminatas_aleatorias(self, int longitud=80, int caminatas_por_nodo=10,
+                             double p=1.0, double q=1.0, semilla=42, nodos=None):
+        """
+        Genera caminatas aleatorias en paralelo sobre la estructura CSR.
+        
+        Con p = q = 1 las caminatas son uniformes; en otro caso se aplica el
+        sesgo de segundo orden de node2vec. El resultado es reproducible
+        para una misma semilla, sin importar el número de hilos.
+        
+        Args:
+            longitud: Nodos por caminata (incluye el nodo inicial)
+            caminatas_por_nodo: Caminatas que parten de cada nodo inicial
+            p: Parámetro de retorno de node2vec
+            q: Parámetro de entrada/salida de node2vec
+            semilla: Semilla del generador aleatorio
+            nodos: Nodos de inicio (None = todos los nodos con aristas)
+            
+        Returns:
+            numpy.ndarray: Matriz int32 (caminatas x longitud), sin copia.
+            Las caminatas que alcanzan un nodo sin salida se rellenan con -1.
+        """
+        self._exigir_sin_carga()
+        print(f"[Cython] Solicitud recibida: Caminatas aleatorias (longitud {longitud}, "
+              f"{caminatas_por_nodo} por nodo, p={p}, q={q}).")
+        
+        cdef vector[int] inicios
+        if nodos is not None:
+            inicios = _a_vector_nodos(nodos)
+        
+        cdef ParametrosCaminata parametros
+        parametros.longitud = longitud
+        parametros.caminatasPorNodo = caminatas_por_nodo
+        parametros.p = p
+        parametros.q = q
+        parametros.semilla = <uint64_t> semilla
+        
+        cdef vector[int] salida
+        cdef int64_t num_caminatas
+        cdef GeneradorCaminatas* generador
+        self._empezar_lectura()
+        try:
+            with nogil:
+                generador = new GeneradorCaminatas(deref(self._grafo))
+                num_caminatas = generador.generar(inicios, parametros, salida)
+                del generador
+        finally:
+            self._terminar_lectura()
+        
+        print(f"[Cython] Retornando matriz de {num_caminatas} caminatas a NumPy (sin copia).")
+        return _vector_a_numpy(salida, num_caminatas, max(longitud, 0))
+    
+    def disposicion_fuerzas(self, int iteraciones=50, double theta=1.2, double gravedad=0.05,
+                            semilla=42, posiciones=None):
+        """
+        Calcula coordenadas 2D para dibujar el grafo (Fruchterman-Reingold
+        multinivel con aproximación de Barnes-Hut, en paralelo).
+        
+        Pensado para subgrafos extraídos (extraer_subgrafo_bfs); las aristas
+        se tratan como no dirigidas y la distancia ideal entre vecinos es 1.
+        El resultado es reproducible para una misma semilla, sin importar el
+        número de hilos.
+        
+        Args:
+            iteraciones: Pasos del nivel más grueso (los niveles refinados usan
+                la mitad); con posiciones dadas, pasos del ajuste
+            theta: Criterio de apertura de Barnes-Hut (0 = repulsión exacta)
+            gravedad: Atracción hacia el centro que mantiene juntas las componentes
+            semilla: Semilla de las posiciones iniciales
+            posiciones: Arreglo (nodos x 2) desde el que continuar, o None
+            
+        Returns:
+            numpy.ndarray: Matriz float64 (nodos x 2), o None si los
+            parámetros son inválidos
+        """
+        self._exigir_sin_carga()
+        cdef Py_ssize_t n = self._grafo.getNumNodos()
+        cdef vector[double] cpp_posiciones
+        cdef const double[::1] iniciales
+        if posiciones is not None:
+            iniciales = np.ascontiguousarray(posiciones, dtype=np.float64).ravel()
+            if iniciales.shape[0] != 2 * n:
+                raise ValueError("posiciones debe tener forma (nodos, 2).")
+            cpp_posiciones.resize(2 * n)
+            if n > 0:
+                memcpy(cpp_posiciones.data(), &iniciales[0], 2 * n * sizeof(double))
+        
+        cdef ParametrosDisposicion parametros
+        parametros.iteraciones = iteraciones
+        parametros.theta = theta
+        parametros.gravedad = gravedad
+        parametros.semilla = <uint64_t> semilla
+        
+        cdef DisposicionFuerzas* motor
+        cdef bint resultado
+        self._empezar_lectura()
+        try:
+            with nogil:
+                motor = new DisposicionFuerzas(deref(self._grafo))
+                resultado = motor.calcular(parametros, cpp_posiciones)
+                del motor
+        finally:
+            self._terminar_lectura()
+        if not resultado:
+            return None
+        
+        salida = np.empty((n, 2), dtype=np.float64)
+        cdef double[:, ::1] v_salida = salida
+        if n > 0:
+            memcpy(&v_salida[0, 0], cpp_posiciones.data(), 2 * n * sizeof(double))
+        return salida
+    
+    def diametro(self, callback=None) -> dict:
+        """
+        Calcula el diámetro exacto de la mayor componente conexa (iFUB).
+        
+        El grafo se trata como no dirigido. Tras cada BFS se invoca
+        callback(bfs_realizados, cota_inferior, cota_superior, pendientes),
+        desde el hilo del cálculo; si devuelve False el cálculo se detiene
+        y el resultado queda marcado como no exacto.
+        
+        Args:
+            callback: Función de progreso opcional
+            
+        Returns:
+            dict: diametro, cota_inferior, cota_superior, bfs_realizados,
+            nodos_componente y exacto
+        """
+        self._exigir_sin_carga()
+        print("[Cython] Solicitud recibida: Calcular diametro.")
+        
+        cdef _ContextoCallback ctx = _ContextoCallback(callback)
+        cdef CallbackProgreso funcion = NULL
+        if callback is not None:
+            funcion = _callback_progreso
+        cdef AnalizadorDiametro* analizador
+        cdef ResultadoDiametro resultado
+        self._empezar_lectura()
+        try:
+            with nogil:
+                analizador = new AnalizadorDiametro(deref(self._grafo))
+                resultado = analizador.calcularDiametro(funcion, <void*> ctx)
+                del analizador
+        finally:
+            self._terminar_lectura()
+        ctx.relanzar()
+        
+        return {
+            'diametro': resultado.diametro,
+            'cota_inferior': resultado.cotaInferior,
+            'cota_superior': resultado.cotaSuperior,
+            'bfs_realizados': resultado.bfsRealizados,
+            'nodos_componente': resultado.nodosComponente,
+            'exacto': resultado.exacto,
+        }
+    
+    def excentricidades(self, int max_bfs=0, callback=None) -> tuple:
+        """
+        Acota la excentricidad de todos los nodos (Takes-Kosters).
+        
+        El grafo se trata como no dirigido y la excentricidad se mide dentro
+        de la componente de cada nodo. El callback se invoca igual que en
+        diametro().
+        
+        Args:
+            max_bfs: Límite de BFS (0 = hasta resolver todos los nodos)
+            callback: Función de progreso opcional
+            
+        Returns:
+            tuple: (inferior, superior) como arreglos int32; coinciden en los
+            nodos resueltos. Una cota superior de 2**31 - 1 indica "sin cota".
+        """
+        self._exigir_sin_carga()
+        print(f"[Cython] Solicitud recibida: Excentricidades (max_bfs={max_bfs}).")
+        
+        cdef _ContextoCallback ctx = _ContextoCallback(callback)
+        cdef CallbackProgreso funcion = NULL
+        if callback is not None:
+            funcion = _callback_progreso
+        cdef AnalizadorDiametro* analizador
+        cdef vector[int] inferior
+        cdef vector[int] superior
+        self._empezar_lectura()
+        try:
+            with nogil:
+                analizador = new AnalizadorDiametro(deref(self._grafo))
+                analizador.calcularExcentricidades(inferior, superior, max_bfs, funcion, <void*> ctx)
+                del analizador
+        finally:
+            self._terminar_lectura()
+        ctx.relanzar()
+        
+        cdef Py_ssize_t n = inferior.size()
+        return (_vector_a_numpy(inferior, n), _vector_a_numpy(superior, n))
+    
+    def censo_triadas(self) -> dict:
+        """
+        Censo de las 16 tríadas dirigidas (algoritmo de Batagelj-Mrvar).
+        
+        Returns:
+            dict: Tipo MAN ('003', '012', ..., '300') -> número de tríadas
+        """
+        self._exigir_sin_carga()
+        print("[Cython] Solicitud recibida: Censo de triadas.")
+        
+        cdef ContadorMotivos* contador
+        cdef CensoTriadas censo
+        self._empezar_lectura()
+        try:
+            with nogil:
+                contador = new ContadorMotivos(deref(self._grafo))
+                censo = contador.censoTriadas()
+                del contador
+        finally:
+            self._terminar_lectura()
+        
+        resultado = {nombre: censo.cuentas[i] for i, nombre in enumerate(_TIPOS_TRIADA)}
+        # Las tríadas vacías se completan aquí: C(n, 3) puede exceder int64
+        n = self._grafo.getNumNodos()
+        resultado['003'] = math.comb(n, 3) - sum(resultado.values())
+        return resultado
+    
+    def grafletes(self, bint orbitas=False):
+        """
+        Cuenta los grafletes conexos inducidos de 3 y 4 nodos.
+        
+        Se calculan sobre la vista no dirigida: triángulos y 4-cliques se
+        enumeran con intersecciones de filas ordenadas, y el resto se
+        deriva combinatoriamente.
+        
+        Args:
+            orbitas: Si es True, devuelve además la matriz (n, 4) int64 de
+                     órbitas por nodo: grado, extremo de camino, centro de
+                     camino y vértice de triángulo
+            
+        Returns:
+            dict con los conteos, o (dict, orbitas) si orbitas=True
+        """
+        self._exigir_sin_carga()
+        print("[Cython] Solicitud recibida: Conteo de grafletes.")
+        
+        cdef ContadorMotivos* contador
+        cdef ConteoGrafletes conteo
+        cdef vector[int64_t] cpp_orbitas
+        cdef vector[int64_t]* destino = &cpp_orbitas if orbitas else NULL
+        self._empezar_lectura()
+        try:
+            with nogil:
+                contador = new ContadorMotivos(deref(self._grafo))
+                conteo = contador.contarGrafletes(destino)
+                del contador
+        finally:
+            self._terminar_lectura()
+        
+        resultado = {
+            'caminos2': conteo.caminos2,
+            'triangulos': conteo.triangulos,
+            'caminos3': conteo.caminos3,
+            'estrellas3': conteo.estrellas3,
+            'ciclos4': conteo.ciclos4,
+            'colas_triangulo': conteo.colasTriangulo,
+            'diamantes': conteo.diamantes,
+            'cliques4': conteo.cliques4,
+        }
+        if orbitas:
+            return resultado, _vector64_a_numpy(cpp_orbitas, self._grafo.getNumNodos(), 4)
+        return resultado
+    
+    def buscar_patron(self, aristas, bint no_dirigido=False, int64_t limite=0,
+                      callback=None, num_nodos=None):
+        """
+        Busca las ocurrencias de un patrón pequeño y conexo en el grafo.
+        
+        Se reportan asignaciones inyectivas de los nodos del patrón que
+        preservan sus aristas (no necesariamente inducidas); un patrón
+        simétrico aparece una vez por cada automorfismo.
+        
+        Args:
+            aristas: Lista de pares (origen, destino) con nodos 0..k-1
+            no_dirigido: Tratar patrón y grafo como no dirigidos
+            limite: Máximo de coincidencias (0 = sin límite). Se devuelven
+                    las primeras en orden de nodo raíz, igual con cualquier
+                    número de hilos; con callback, las primeras que se
+                    encuentren, que dependen de los hilos
+            callback: Si se indica, recibe cada coincidencia como tupla en
+                      lugar de acumularlas; devolver False detiene la búsqueda
+            num_nodos: Nodos del patrón (por defecto, el mayor ID + 1)
+            
+        Returns:
+            numpy.ndarray (M, k) int32 con una coincidencia por fila; con
+            callback, el número de coincidencias reportadas. None si el
+            patrón es inválido.
+        """
+        self._exigir_sin_carga()
+        print(f"[Cython] Solicitud recibida: Buscar patron de {len(aristas)} aristas.")
+        
+        cdef vector[pair[int, int]] cpp_aristas = [(int(u), int(v)) for u, v in aristas]
+        cdef int k = num_nodos if num_nodos is not None else \
+            max([max(u, v) for u, v in cpp_aristas], default=-1) + 1
+        cdef _ContextoCallback ctx = _ContextoCallback(callback)
+        cdef CallbackCoincidencia funcion = NULL
+        if callback is not None:
+            funcion = _callback_coincidencia
+        cdef BuscadorPatrones* buscador
+        cdef vector[int] coincidencias
+        cdef int64_t total
+        self._empezar_lectura()
+        try:
+            with nogil:
+                buscador = new BuscadorPatrones(deref(self._grafo))
+                total = buscador.buscar(k, cpp_aristas, no_dirigido, limite, coincidencias,
+                                        funcion, <void*> ctx)
+                del buscador
+        finally:
+            self._terminar_lectura()
+        ctx.relanzar()
+        
+        if total < 0:
+            return None
+        if callback is not None:
+            return total
+        return _vector_a_numpy(coincidencias, total, k)
+    
+    def k_caminos_mas_cortos(self, int origen, int destino, int k=5, bint bidireccional=False):
+        """
+        Calcula hasta k caminos simples más cortos (en saltos) con el algoritmo de Yen.
+        
+        Args:
+            origen: Nodo inicial
+            destino: Nodo final
+            k: Número máximo de caminos
+            bidireccional: Usar BFS bidireccional en las búsquedas de desvío
+            
+        Returns:
+            tuple: (offsets, nodos) como arreglos int32; el camino i es
+                   nodos[offsets[i]:offsets[i+1]]. None si los parámetros
+                   son inválidos.
+        """
+        self._exigir_sin_carga()
+        print(f"[Cython] Solicitud recibida: {k} caminos mas cortos de {origen} a {destino}.")
+        
+        cdef BuscadorCaminosK* buscador
+        cdef vector[int] offsets
+        cdef vector[int] nodos
+        cdef int encontrados
+        self._empezar_lectura()
+        try:
+            with nogil:
+                buscador = new BuscadorCaminosK(deref(self._grafo))
+                encontrados = buscador.calcular(origen, destino, k, bidireccional, offsets, nodos)
+                del buscador
+        finally:
+            self._terminar_lectura()
+        
+        if encontrados < 0:
+            return None
+        return _vector_a_numpy(offsets, offsets.size()), _vector_a_numpy(nodos, nodos.size())
+    
+    def flujo_maximo(self, fuentes, sumideros, bint usar_pesos=False):
+        """
+        Calcula el flujo máximo y el corte mínimo entre dos conjuntos de nodos.
+        
+        Args:
+            fuentes: Nodo o secuencia de nodos fuente
+            sumideros: Nodo o secuencia de nodos sumidero (disjuntos de las fuentes)
+            usar_pesos: Usar los pesos de las aristas como capacidades
+                        (por defecto todas valen 1)
+            
+        Returns:
+            dict: valor, corte (arreglo (E, 2) int32 con las aristas del
+            corte mínimo), fases y nodos_lado_fuente; None si los
+            conjuntos son inválidos
+        """
+        self._exigir_sin_carga()
+        print("[Cython] Solicitud recibida: Flujo maximo.")
+        
+        cdef vector[int] cpp_fuentes = _a_vector_nodos(fuentes)
+        cdef vector[int] cpp_sumideros = _a_vector_nodos(sumideros)
+        cdef FlujoMaximo* flujo
+        cdef ResultadoFlujo resultado
+        cdef bint exito
+        self._empezar_lectura()
+        try:
+            with nogil:
+                flujo = new FlujoMaximo(deref(self._grafo))
+                exito = flujo.calcular(cpp_fuentes, cpp_sumideros, usar_pesos, resultado)
+                del flujo
+        finally:
+            self._terminar_lectura()
+        
+        if not exito:
+            return None
+        cdef Py_ssize_t num_corte = resultado.corte.size() // 2
+        return {
+            'valor': resultado.valor,
+            'corte': _vector_a_numpy(resultado.corte, num_corte, 2),
+            'fases': resultado.fases,
+            'nodos_lado_fuente': resultado.nodosLadoFuente,
+        }
+    
+    def construir_oraculo(self, int k=16, str estrategia='grado', semilla=42) -> bool:
+        """
+        Construye el oráculo de distancias con k landmarks.
+        
+        Args:
+            k: Número de landmarks
+            estrategia: 'grado' (mayor grado total) o 'cobertura' (nodos que
+                cubren más caminos mínimos muestreados)
+            semilla: Semilla del muestreo para la estrategia 'cobertura'
+            
+        Returns:
+            bool: True si el oráculo quedó construido
+        """
+        self._exigir_sin_carga()
+        print(f"[Cython] Solicitud recibida: Construir oraculo ({k} landmarks, {estrategia}).")
+        
+        cdef EstrategiaLandmarks cpp_estrategia
+        if estrategia == 'grado':
+            cpp_estrategia = EstrategiaLandmarks.Grado
+        elif estrategia == 'cobertura':
+            cpp_estrategia = EstrategiaLandmarks.Cobertura
+        else:
+            raise ValueError(f"Estrategia desconocida: {estrategia!r}")
+        
+        cdef uint64_t cpp_semilla = <uint64_t> semilla
+        cdef bint resultado
+        self._empezar_lectura()
+        try:
+            with nogil:
+                resultado = self._oraculo.construir(deref(self._grafo), k, cpp_estrategia, cpp_semilla)
+        finally:
+            self._terminar_lectura()
+        return resultado
+    
+    def distancia_estimada(self, int u, int v) -> tuple:
+        """
+        Cotas de la distancia dirigida d(u, v) en O(k) usando el oráculo.
+        
+        Args:
+            u: Nodo origen
+            v: Nodo destino
+            
+        Returns:
+            tuple: (inferior, superior). superior = -1 si ningún landmark
+            conecta ambos nodos; (-1, -1) si v no es alcanzable desde u.
+        """
+        self._exigir_sin_carga()
+        cdef CotasDistancia cotas = self._oraculo.estimar(u, v)
+        return (cotas.inferior, cotas.superior)
+    
+    def distancia(self, int u, int v, bint refinar=True, int64_t presupuesto=1000000) -> tuple:
+        """
+        Distancia dirigida d(u, v) usando el oráculo y, si hace falta, un BFS
+        bidireccional con presupuesto.
+        
+        Args:
+            u: Nodo origen
+            v: Nodo destino
+            refinar: Si es False solo se consultan los landmarks
+            presupuesto: Máximo de aristas que puede examinar el refinamiento
+            
+        Returns:
+            tuple: (inferior, superior); son iguales cuando la distancia es
+            exacta y valen (-1, -1) si v no es alcanzable desde u
+        """
+        self._exigir_sin_carga()
+        if not self._oraculo.estaConstruido():
+            raise RuntimeError("Primero debe construir o cargar el oraculo.")
+        
+        cdef CotasDistancia cotas
+        self._empezar_lectura()
+        try:
+            with nogil:
+                if refinar:
+                    cotas = self._oraculo.refinar(deref(self._grafo), u, v, presupuesto)
+                else:
+                    cotas = self._oraculo.estimar(u, v)
+        finally:
+            self._terminar_lectura()
+        return (cotas.inferior, cotas.superior)
+    
+    def guardar_oraculo(self, str ruta=None) -> bool:
+        """
+        Guarda el oráculo en disco.
+        
+        Args:
+            ruta: Archivo destino (por defecto, '<dataset>.landmarks')
+            
+        Returns:
+            bool: True si se guardó correctamente
+        """
+        self._exigir_sin_carga()
+        if ruta is None:
+            ruta = self._archivo_cargado + ".landmarks"
+        return self._oraculo.guardar(ruta.encode('utf-8'))
+    
+    def cargar_oraculo(self, str ruta=None) -> bool:
+        """
+        Carga un oráculo guardado, validando que corresponda al grafo actual.
+        
+        Args:
+            ruta: Archivo origen (por defecto, '<dataset>.landmarks')
+            
+        Returns:
+            bool: True si se cargó correctamente
+        """
+        self._exigir_sin_carga()
+        if ruta is None:
+            ruta = self._archivo_cargado + ".landmarks"
+        return self._oraculo.cargar(ruta.encode('utf-8'), deref(self._grafo))
+    
+    @property
+    def landmarks(self) -> list:
+        """Landmarks del oráculo actual (vacío si no está construido)."""
+        return list(self._oraculo.getLandmarks())
+    
+    def construir_indice_pll(self, int num_raices_bp=16) -> bool:
+        """
+        Construye el índice PLL de distancias exactas (vista no dirigida).
+        
+        Args:
+            num_raices_bp: Raíces bit-paralelas (0 desactiva la variante)
+            
+        Returns:
+            bool: True si el índice quedó construido
+        """
+        self._exigir_sin_carga()
+        print(f"[Cython] Solicitud recibida: Construir indice PLL ({num_raices_bp} raices BP).")
+        cdef bint resultado
+        self._empezar_lectura()
+        try:
+            with nogil:
+                resultado = self._indice_pll.construir(deref(self._grafo), num_raices_bp)
+        finally:
+            self._terminar_lectura()
+        return resultado
+    
+    def distancia_pll(self, int u, int v) -> int:
+        """
+        Distancia exacta no dirigida entre u y v usando el índice PLL.
+        
+        Returns:
+            int: Distancia, o -1 si no están conectados
+        """
+        self._exigir_sin_carga()
+        if not self._indice_pll.estaConstruido():
+            raise RuntimeError("Primero debe construir o cargar el indice PLL.")
+        return self._indice_pll.consultar(u, v)
+    
+    def distancias_pll(self, origenes, destinos):
+        """
+        Resuelve un lote de consultas PLL en C++ (sin bucle de Python).
+        
+        Args:
+            origenes: Arreglo de nodos origen
+            destinos: Arreglo de nodos destino (misma longitud)
+            
+        Returns:
+            numpy.ndarray: Distancias int32 (-1 si no hay camino)
+        """
+        self._exigir_sin_carga()
+        if not self._indice_pll.estaConstruido():
+            raise RuntimeError("Primero debe construir o cargar el indice PLL.")
+        
+        cdef int[::1] u = np.ascontiguousarray(origenes, dtype=np.intc).ravel()
+        cdef int[::1] v = np.ascontiguousarray(destinos, dtype=np.intc).ravel()
+        if u.shape[0] != v.shape[0]:
+            raise ValueError("origenes y destinos deben tener la misma longitud")
+        
+        cdef Py_ssize_t cantidad = u.shape[0]
+        cdef vector[int] salida
+        salida.resize(cantidad)
+        if cantidad > 0:
+            self._empezar_lectura()
+            try:
+                with nogil:
+                    self._indice_pll.consultarLote(&u[0], &v[0], cantidad, salida.data())
+            finally:
+                self._terminar_lectura()
+        return _vector_a_numpy(salida, cantidad)
+    
+    def estadisticas_indice_pll(self) -> dict:
+        """
+        Tamaño y costo de construcción del índice PLL.
+        
+        Returns:
+            dict: num_nodos, num_raices_bp, entradas_etiqueta,
+            promedio_etiqueta, bytes_indice y segundos_construccion
+        """
+        self._exigir_sin_carga()
+        cdef EstadisticasPLL e = self._indice_pll.getEstadisticas()
+        return {
+            'num_nodos': e.numNodos,
+            'num_raices_bp': e.numRaicesBP,
+            'entradas_etiqueta': e.entradasEtiqueta,
+            'promedio_etiqueta': e.promedioEtiqueta,
+            'bytes_indice': e.bytesIndice,
+            'segundos_construccion': e.segundosConstruccion,
+        }
+    
+    def guardar_indice_pll(self, str ruta=None) -> bool:
+        """
+        Guarda el índice PLL en disco.
+        
+        Args:
+            ruta: Archivo destino (por defecto, '<dataset>.pll')
+        """
+        self._exigir_sin_carga()
+        if ruta is None:
+            ruta = self._archivo_cargado + ".pll"
+        return self._indice_pll.guardar(ruta.encode('utf-8'))
+    
+    def cargar_indice_pll(self, str ruta=None) -> bool:
+        """
+        Carga un índice PLL guardado, validando que corresponda al grafo actual.
+        
+        Args:
+            ruta: Archivo origen (por defecto, '<dataset>.pll')
+        """
+        self._exigir_sin_carga()
+        if ruta is None:
+            ruta = self._archivo_cargado + ".pll"
+        return self._indice_pll.cargar(ruta.encode('utf-8'), deref(self._grafo))
+    
+    @staticmethod
+    def num_hilos() -> int:
+        """Participantes del pool de hilos del proceso (incluye al que llama)."""
+        return PoolHilos.instancia().getNumHilos()
+    
+    @staticmethod
+    def configurar_hilos(int hilos) -> bool:
+        """
+        Redimensiona el pool de hilos del proceso.
+        
+        Returns:
+            bool: False si hay cálculos paralelos en curso
+        """
+        cdef bint resultado
+        with nogil:
+            resultado = PoolHilos.instancia().redimensionar(hilos)
+        return resultado
+    
+    @staticmethod
+    def fijar_afinidad(bint fijar=True) -> bool:
+        """Fija cada hilo del pool a un núcleo (False lo libera)."""
+        return PoolHilos.instancia().fijarAfinidad(fijar)
+    
+    @staticmethod
+    def medir_regiones(callback):
+        """
+        Instala un gancho de medición del pool de hilos.
+        
+        Tras cada bucle paralelo se invoca callback(estadisticas) desde el
+        hilo que lo lanzó, con nombre, participantes, bloques, robos,
+        segundos, segundos_ocupados y max_ocupado_hilo. Con None se
+        desinstala; si el callback lanzó una excepción, se propaga
+        entonces.
+        """
+        global _medicion_actual
+        cdef _ContextoCallback anterior = _medicion_actual
+        cdef _ContextoCallback ctx = None
+        if callback is None:
+            PoolHilos.instancia().setGanchoTiempo(NULL, NULL)
+        else:
+            ctx = _ContextoCallback(callback)
+            _contextos_medicion.append(ctx)
+            PoolHilos.instancia().setGanchoTiempo(_gancho_tiempo, <void*> ctx)
+        _medicion_actual = ctx
+        if anterior is not None:
+            anterior.funcion = None
+            error, anterior.error = anterior.error, None
+            if error is not None:
+                raise error
+    
+    @staticmethod
+    def obtener_metricas(bint reiniciar=False) -> dict:
+        """
+        Contadores de instrumentación de los recorridos, sumados sobre
+        todos los hilos del proceso (no solo de este grafo).
+        
+        Incluye llamadas y niveles de BFS, nodos visitados, aristas
+        exploradas, bytes de trabajo reservados, nanosegundos por fase
+        del BFS y los máximos de frontera y de grado expandido (un hub
+        aparece como un grado máximo cercano al número de aristas de su
+        nivel). 'perfil_ultimo_bfs' desglosa el último BFS por nivel.
+        
+        Args:
+            reiniciar: Pone los contadores a cero tras leerlos
+            
+        Returns:
+            dict con cada contador por nombre, 'activas', 'hilos' y
+            'perfil_ultimo_bfs' (arreglos 'frontera', 'aristas' y
+            'segundos' por nivel)
+        """
+        cdef InstantaneaMetricas instantanea
+        with nogil:
+            instantanea = obtenerMetricas(reiniciar)
+        resultado = {'activas': metricasActivas(), 'hilos': instantanea.hilos}
+        cdef int i
+        for i in range(<int> ContadorMetrica.Cantidad):
+            resultado[nombreContadorMetrica(<ContadorMetrica> i).decode('ascii')] = instantanea.contadores[i]
+        for i in range(<int> MaximoMetrica.Cantidad):
+            resultado[nombreMaximoMetrica(<MaximoMetrica> i).decode('ascii')] = instantanea.maximos[i]
+        cdef Py_ssize_t niveles = instantanea.perfilUltimoBFS.size()
+        frontera = np.empty(niveles, dtype=np.int64)
+        aristas = np.empty(niveles, dtype=np.int64)
+        segundos = np.empty(niveles, dtype=np.float64)
+        cdef Py_ssize_t nivel
+        for nivel in range(niveles):
+            frontera[nivel] = instantanea.perfilUltimoBFS[nivel].frontera
+            aristas[nivel] = instantanea.perfilUltimoBFS[nivel].aristas
+            segundos[nivel] = instantanea.perfilUltimoBFS[nivel].nanosegundos / 1e9
+        resultado['perfil_ultimo_bfs'] = {'frontera': frontera, 'aristas': aristas, 'segundos': segundos}
+        return resultado
+    
+    @staticmethod
+    def activar_metricas(bint activas=True):
+        """
+        Enciende o apaga la recogida de métricas en ejecución (también con
+        la variable de entorno NEURONET_METRICAS=0). Sin efecto si el
+        módulo se compiló con NEURONET_METRICAS=0.
+        """
+        activarMetricas(activas)
+    
+    @staticmethod
+    def obtener_memoria(bint reiniciar_picos=False) -> dict:
+        """
+        Memoria contabilizada del proceso por categoría, con su pico, y
+        el RSS medido por el sistema operativo.
+        
+        Categorías: 'grafo' (arreglos CSR), 'temporal' (aristas leídas
+        durante la carga, búferes de los recorridos), 'cache' (grado de
+        entrada) e 'indice' (landmarks, PLL, vistas no dirigidas y
+        transpuestas). El pico de la carga de un archivo está en
+        'total_pico' si se reinician los picos justo antes de cargarlo.
+        
+        Args:
+            reiniciar_picos: Lleva los picos a los valores actuales tras leerlos
+            
+        Returns:
+            dict con {'actual', 'pico'} por categoría, 'total', 'total_pico',
+            'rss' y 'rss_pico' en bytes (-1 si el sistema no informa del RSS)
+            y 'paginas_grandes' ('modo' y bytes mapeados con páginas
+            grandes 'explicitas' y 'transparentes')
+        """
+        cdef EstadoMemoria estado
+        cdef EstadoPaginasGrandes paginas
+        with nogil:
+            estado = obtenerEstadoMemoria()
+            paginas = obtenerEstadoPaginasGrandes()
+            if reiniciar_picos:
+                reiniciarPicosMemoria()
+        resultado = {}
+        cdef int i
+        for i in range(<int> CategoriaMemoria.Cantidad):
+            resultado[nombreCategoriaMemoria(<CategoriaMemoria> i).decode('ascii')] = {
+                'actual': estado.actual[i], 'pico': estado.pico[i]}
+        resultado['total'] = estado.total
+        resultado['total_pico'] = estado.totalPico
+        resultado['rss'] = estado.rss
+        resultado['rss_pico'] = estado.rssPico
+        resultado['paginas_grandes'] = {
+            'modo': nombreModoPaginasGrandes(paginas.modo).decode('ascii'),
+            'explicitas': paginas.bytesExplicitas,
+            'transparentes': paginas.bytesTransparentes,
+            'fallos_explicitas': paginas.fallosExplicitas,
+        }
+        return resultado
+    
+    @staticmethod
+    def configurar_paginas_grandes(str modo='thp') -> bool:
+        """
+        Elige cómo se respaldan los arreglos grandes (2 MiB o más) del CSR
+        y de los índices que se construyan a partir de ahora.
+        
+        Args:
+            modo: 'thp' (páginas grandes transparentes, por defecto),
+                  'explicitas' (MAP_HUGETLB; sin páginas reservadas en el
+                  sistema se recurre a 'thp') o 'no'
+            
+        Returns:
+            False si la plataforma no admite el modo (no cambia nada)
+        """
+        cdef ModoPaginasGrandes valor
+        if modo == 'thp':
+            valor = ModoPaginasGrandes.Transparentes
+        elif modo == 'explicitas':
+            valor = ModoPaginasGrandes.Explicitas
+        elif modo == 'no':
+            valor = ModoPaginasGrandes.Desactivadas
+        else:
+            raise ValueError(f"Modo de paginas grandes desconocido: {modo!r}")
+        return configurarPaginasGrandes(valor)
+    
+    @staticmethod
+    def liberar_memoria_retenida():
+        """
+        Suelta la memoria de trabajo que los recorridos conservan para
+        reutilizarla (arena y vectores por hilo). Este hilo la suelta ya;
+        los hilos de trabajo, al terminar su siguiente tarea.
+        """
+        with nogil:
+            liberarMemoriaRetenida()
+    
+    def print_debug_info(self):
+        """Imprime información de debug del grafo."""
+        self._grafo.printDebugInfo()
+    
+    @property
+    def tiempo_carga(self) -> float:
+        """Tiempo de carga del último dataset."""
+        return self._tiempo_carga
+    
+    @property
+    def archivo_cargado(self) -> str:
+        """Nombre del archivo actualmente cargado."""
+        return self._archivo_cargado
+    
+    def get_estadisticas(self) -> dict:
+        """
+        Obtiene estadísticas generales del grafo.
+        
+        Returns:
+            dict: Diccionario con estadísticas
+        """
+        self._exigir_sin_carga()
+        nodo_max, grado_max = self.get_nodo_mayor_grado()
+        
+        return {
+            'num_nodos': self.get_num_nodos(),
+            'num_aristas': self.get_num_aristas(),
+            'memoria_mb': self.get_memoria_usada_mb(),
+            'tiempo_carga': self._tiempo_carga,
+            'archivo': self._archivo_cargado,
+            'nodo_mayor_grado': nodo_max,
+            'mayor_grado': grado_max
+        }
+
+
+cdef class _VistaGrafo:
+    """
+    Buffer de solo lectura sobre uno de los arreglos CSR de un grafo.
+    
+    Mantiene vivo el grafo y, mientras haya buffers exportados, impide que
+    se reemplace su estructura (ver PyGrafoDisperso._exigir_sin_vistas).
+    """
+    cdef PyGrafoDisperso _grafo
+    cdef const int* _datos
+    cdef Py_ssize_t _forma[1]
+    cdef Py_ssize_t _pasos[1]
+    
+    @staticmethod
+    cdef _VistaGrafo crear(PyGrafoDisperso grafo, const int* datos, Py_ssize_t longitud):
+        cdef _VistaGrafo vista = _VistaGrafo.__new__(_VistaGrafo)
+        vista._grafo = grafo
+        vista._datos = datos if datos != NULL else &_SIN_DATOS
+        vista._forma[0] = longitud
+        vista._pasos[0] = sizeof(int)
+        return vista
+    
+    def __getbuffer__(self, Py_buffer* buffer, int flags):
+        if flags & PyBUF_WRITABLE:
+            raise BufferError("Los arreglos CSR del grafo son de solo lectura.")
+        buffer.buf = <void*> self._datos
+        buffer.obj = self
+        buffer.len = self._forma[0] * sizeof(int)
+        buffer.itemsize = sizeof(int)
+        buffer.readonly = 1
+        buffer.ndim = 1
+        if flags & PyBUF_FORMAT:
+            buffer.format = 'i'
+        else:
+            buffer.format = NULL
+        buffer.shape = self._forma
+        buffer.strides = self._pasos
+        buffer.suboffsets = NULL
+        buffer.internal = NULL
+        self._grafo._vistas_exportadas += 1
+    
+    def __releasebuffer__(self, Py_buffer* buffer):
+        self._grafo._vistas_exportadas -= 1
+
+
+def _reconstruir_grafo(int num_nodos, int num_aristas, row_ptr, columnas, valores, ids,
+                       str orden, str archivo):
+    """
+    Reconstruye un PyGrafoDisperso serializado con pickle (ver __reduce_ex__).
+    
+    Los buffers pueden venir dentro del flujo o fuera de banda; se leen sin
+    copia intermedia salvo que el orden de bytes del emisor sea distinto.
+    """
+    arreglos = []
+    for datos in (row_ptr, columnas, valores, ids):
+        arreglo = np.frombuffer(datos, dtype=np.intc)
+        if orden != sys.byteorder:
+            arreglo = arreglo.byteswap()
+        arreglos.append(arreglo)
+    if num_nodos == 0 and arreglos[0].shape[0] == 0:
+        arreglos[0] = np.zeros(1, dtype=np.intc)
+    if num_nodos < 0 or num_aristas < 0 or \
+            arreglos[0].shape[0] != num_nodos + 1 or \
+            arreglos[1].shape[0] != num_aristas or arreglos[2].shape[0] != num_aristas or \
+            arreglos[3].shape[0] not in (0, num_nodos):
+        raise ValueError("Los arreglos serializados no tienen el tamano esperado.")
+    
+    cdef const int[::1] v_row_ptr = arreglos[0]
+    cdef const int[::1] v_columnas = arreglos[1]
+    cdef const int[::1] v_valores = arreglos[2]
+    cdef const int[::1] v_ids = arreglos[3]
+    cdef PyGrafoDisperso grafo = PyGrafoDisperso()
+    cdef bint resultado
+    cdef const int* p_row_ptr = &v_row_ptr[0]
+    cdef const int* p_columnas = _puntero_o_nulo(v_columnas)
+    cdef const int* p_valores = _puntero_o_nulo(v_valores)
+    cdef const int* p_ids = _puntero_o_nulo(v_ids)
+    if p_columnas == NULL:
+        p_columnas = &_SIN_DATOS
+        p_valores = &_SIN_DATOS
+    with nogil:
+        resultado = grafo._grafo.importarCSR(p_row_ptr, p_columnas, p_valores, p_ids,
+                                             num_nodos, num_aristas)
+    if not resultado:
+        raise ValueError("Los arreglos serializados no forman un grafo CSR valido.")
+    grafo._archivo_cargado = archivo
+    return grafo
+
+
+cdef class PyGrafoExterno:
+    """
+    Wrapper Python para GrafoExterno: grafos cuyas aristas no caben en RAM.
+    
+    Solo los punteros de fila y los grados de entrada viven en memoria; las
+    aristas se leen del archivo .nnext (mapeado o por bloques) en orden.
+    Ofrece las consultas básicas de PyGrafoDisperso y las componentes
+    conexas; las aristas no tienen peso.
+    
+    Attributes:
+        _grafo: Puntero a la instancia C++ de GrafoExterno
+        _archivo_cargado: Archivo .nnext o Edge List abierto
+    """
+    cdef GrafoExterno* _grafo
+    cdef str _archivo_cargado
+    
+    def __cinit__(self):
+        self._grafo = new GrafoExterno()
+        self._archivo_cargado = ""
+        print("[Cython] Wrapper de grafo externo inicializado.")
+    
+    def __dealloc__(self):
+        """Libera la memoria del objeto C++ y cierra el archivo"""
+        if self._grafo != NULL:
+            del self._grafo
+    
+    @staticmethod
+    def convertir(str lista_aristas, str destino, int64_t memoria_maxima=1 << 30) -> bool:
+        """
+        Convierte un Edge List en un archivo .nnext sin cargarlo entero.
+        
+        Si las aristas no caben en memoria_maxima, la lista se relee una
+        vez por cada tramo de nodos que sí cabe; además se usan O(n) bytes
+        para los grados.
+        
+        Args:
+            lista_aristas: Archivo de texto (NodoOrigen NodoDestino)
+            destino: Ruta del archivo .nnext a crear
+            memoria_maxima: Bytes para aristas en memoria durante la conversión
+            
+        Returns:
+            bool: True si se escribió el archivo
+        """
+        if memoria_maxima <= 0:
+            raise ValueError("memoria_maxima debe ser positiva.")
+        print(f"[Cython] Solicitud recibida: Convertir '{lista_aristas}' a grafo externo.")
+        cdef string cpp_lista = lista_aristas.encode('utf-8')
+        cdef string cpp_destino = destino.encode('utf-8')
+        cdef bint resultado
+        with nogil:
+            resultado = GrafoExterno.convertirListaAristas(cpp_lista, cpp_destino,
+                                                           <size_t> memoria_maxima)
+        return resultado
+    
+    def abrir(self, str ruta, bint usar_mmap=True) -> bool:
+        """
+        Abre un archivo .nnext.
+        
+        Args:
+            ruta: Archivo creado con convertir()
+            usar_mmap: False para leer siempre por bloques en lugar de mapear
+            
+        Returns:
+            bool: True si el archivo contiene un grafo válido
+        """
+        print(f"[Cython] Solicitud recibida: Abrir grafo externo '{ruta}'")
+        cdef string cpp_ruta = ruta.encode('utf-8')
+        cdef bint resultado
+        with nogil:
+            resultado = self._grafo.abrir(cpp_ruta, usar_mmap)
+        self._archivo_cargado = ruta if resultado else ""
+        return resultado
+    
+    def cargar_datos(self, str filename) -> bool:
+        """
+        Abre un .nnext o, si filename es un Edge List, lo convierte a
+        filename + '.nnext' (reutilizándolo mientras sea más reciente).
+        
+        Returns:
+            bool: True si la carga fue exitosa
+        """
+        print(f"[Cython] Solicitud recibida: Cargar archivo externo '{filename}'")
+        cdef string cpp_filename = filename.encode('utf-8')
+        cdef bint resultado
+        with nogil:
+            resultado = self._grafo.cargarDatos(cpp_filename)
+        self._archivo_cargado = filename if resultado else ""
+        return resultado
+    
+    def bfs(self, int nodo_inicio, int profundidad_maxima) -> list:
+        """
+        BFS semiexterno: cada nivel se expande leyendo el disco en orden.
+        
+        Devuelve los mismos nodos y distancias que PyGrafoDisperso.bfs;
+        dentro de cada nivel, por ID creciente.
+        
+        Returns:
+            list: Lista de tuplas (nodo, distancia)
+        """
+        print(f"[Cython] Solicitud recibida: BFS externo desde Nodo {nodo_inicio}, "
+              f"Profundidad {profundidad_maxima}.")
+        cdef vector[pair[int, int]] resultado
+        with nogil:
+            resultado = self._grafo.BFS(nodo_inicio, profundidad_maxima)
+        return [(p.first, p.second) for p in resultado]
+    
+    def dfs(self, int nodo_inicio) -> list:
+        """
+        DFS con el mismo orden que PyGrafoDisperso.dfs (acceso aleatorio al disco).
+        
+        Returns:
+            list: Lista de IDs de nodos visitados
+        """
+        print(f"[Cython] Solicitud recibida: DFS externo desde Nodo {nodo_inicio}.")
+        cdef vector[int] resultado
+        with nogil:
+            resultado = self._grafo.DFS(nodo_inicio)
+        return list(resultado)
+    
+    def get_aristas_subgrafo(self, int nodo_inicio, int profundidad_maxima) -> list:
+        """
+        Aristas que salen de los nodos a distancia < profundidad_maxima.
+        
+        Returns:
+            list: Lista de tuplas (origen, destino)
+        """
+        cdef vector[pair[int, int]] aristas
+        with nogil:
+            aristas = self._grafo.getAristasSubgrafo(nodo_inicio, profundidad_maxima)
+        return [(a.first, a.second) for a in aristas]
+    
+    def componentes_conexas(self) -> tuple:
+        """
+        Componentes conexas débiles con una pasada secuencial por las aristas.
+        
+        Returns:
+            tuple: (número de componentes, arreglo NumPy int32 con el menor
+            ID de la componente de cada nodo)
+        """
+        print("[Cython] Solicitud recibida: Componentes conexas del grafo externo.")
+        cdef vector[int] etiquetas
+        cdef int componentes
+        with nogil:
+            componentes = self._grafo.componentesConexas(etiquetas)
+        return componentes, _vector_a_numpy(etiquetas, etiquetas.size())
+    
+    def obtener_grado(self, int nodo) -> int:
+        """Grado de salida de un nodo (-1 si no existe); no lee el disco."""
+        return self._grafo.obtenerGrado(nodo)
+    
+    def obtener_grado_entrada(self, int nodo) -> int:
+        """Grado de entrada de un nodo (-1 si no existe); no lee el disco."""
+        return self._grafo.obtenerGradoEntrada(nodo)
+    
+    def obtener_grados(self, nodos):
+        """
+        Grado de salida de muchos nodos en una sola llamada (sin leer el disco).
+        
+        Returns:
+            numpy.ndarray: Grados (int64) en el orden de nodos; -1 para IDs inválidos
+        """
+        cdef const int64_t[::1] ids = _arreglo_nodos64(nodos)
+        resultado = np.empty(ids.shape[0], dtype=np.int64)
+        cdef int64_t[::1] grados = resultado
+        cdef const int64_t* filas = self._grafo.punterosFila()
+        cdef int64_t n = self._grafo.getNumNodos()
+        cdef Py_ssize_t i
+        cdef int64_t nodo
+        with nogil:
+            for i in range(ids.shape[0]):
+                nodo = ids[i]
+                grados[i] = filas[nodo + 1] - filas[nodo] if 0 <= nodo < n else -1
+        return resultado
+    
+    def obtener_grados_entrada(self, nodos):
+        """
+        Grado de entrada de muchos nodos en una sola llamada (sin leer el disco).
+        
+        Returns:
+            numpy.ndarray: Grados (int32) en el orden de nodos; -1 para IDs inválidos
+        """
+        cdef const int64_t[::1] ids = _arreglo_nodos64(nodos)
+        resultado = np.empty(ids.shape[0], dtype=np.intc)
+        cdef int[::1] grados = resultado
+        cdef const int* entrada = self._grafo.gradosEntrada()
+        cdef int64_t n = self._grafo.getNumNodos()
+        cdef Py_ssize_t i
+        cdef int64_t nodo
+        with nogil:
+            for i in range(ids.shape[0]):
+                nodo = ids[i]
+                grados[i] = entrada[nodo] if 0 <= nodo < n else -1
+        return resultado
+    
+    def get_vecinos(self, int nodo) -> list:
+        """Vecinos de salida de un nodo (una lectura del disco)."""
+        cdef vector[int] vecinos
+        with nogil:
+            vecinos = self._grafo.getVecinos(nodo)
+        return list(vecinos)
+    
+    def get_num_nodos(self) -> int:
+        """Retorna el número total de nodos en el grafo."""
+        return self._grafo.getNumNodos()
+    
+    def get_num_aristas(self) -> int:
+        """Retorna el número total de aristas en el grafo (sin límite de 32 bits)."""
+        return self._grafo.getNumAristas64()
+    
+    def get_nodo_mayor_grado(self) -> tuple:
+        """
+        Encuentra el nodo con mayor grado de salida.
+        
+        Returns:
+            tuple: (id_nodo, grado)
+        """
+        cdef pair[int, int] resultado = self._grafo.getNodoMayorGrado()
+        return (resultado.first, resultado.second)
+    
+    def get_memoria_usada(self) -> int:
+        """
+        Memoria propia del grafo en bytes (O(n)); las páginas mapeadas del
+        archivo pertenecen a la caché del sistema y no se cuentan.
+        """
+        return self._grafo.getMemoriaUsada()
+    
+    @property
+    def usa_mmap(self) -> bool:
+        """True si las aristas se leen de un mapeo del archivo."""
+        return self._grafo.usaMmap()
+    
+    @property
+    def archivo_cargado(self) -> str:
+        """Nombre del archivo actualmente abierto."""
+        return self._archivo_cargado
+
+
+cdef class PyGrafoParticionado:
+    """
+    Grafo repartido entre procesos trabajadores (ver PyGrafoDisperso.particionar).
+    
+    Los trabajadores copian su partición al arrancar, así que el grafo de
+    origen puede modificarse después. Los procesos terminan con cerrar(),
+    al salir de un bloque with o al liberar el objeto.
+    
+    Attributes:
+        _grafo: Puntero al coordinador C++ de los procesos
+        _esquema: '1d' o '2d'
+    """
+    cdef GrafoParticionado* _grafo
+    cdef str _esquema
+    
+    def __cinit__(self):
+        self._grafo = new GrafoParticionado()
+        self._esquema = ""
+    
+    def __dealloc__(self):
+        """Termina los trabajadores y libera el coordinador"""
+        if self._grafo != NULL:
+            del self._grafo
+    
+    def __enter__(self):
+        return self
+    
+    def __exit__(self, tipo, valor, traza):
+        self.cerrar()
+        return False
+    
+    def bfs(self, int nodo_inicio, int profundidad_maxima) -> list:
+        """
+        BFS distribuido: los procesos expanden cada nivel a la vez.
+        
+        Returns:
+            list: Tuplas (nodo, distancia) por distancia y, dentro de cada
+            nivel, por ID; los mismos pares que PyGrafoDisperso.bfs. Vacía
+            si el nodo no existe o los trabajadores ya terminaron
+        """
+        print(f"[Cython] Solicitud recibida: BFS particionado desde Nodo {nodo_inicio}, "
+              f"Profundidad {profundidad_maxima}.")
+        cdef vector[pair[int, int]] resultado
+        with nogil:
+            resultado = self._grafo.BFS(nodo_inicio, profundidad_maxima)
+        return [(p.first, p.second) for p in resultado]
+    
+    def estadisticas(self) -> dict:
+        """
+        Reparto del grafo y coste de comunicación del último BFS.
+        
+        Returns:
+            dict con 'malla' (filas, columnas), 'aristas_por_particion',
+            'nodos_por_particion' y, del último BFS, 'niveles', 'bytes' y
+            'mensajes' intercambiados entre trabajadores y 'segundos'
+        """
+        cdef const EstadisticasBFSParticionado* ultimo = &self._grafo.estadisticasUltimoBFS()
+        return {
+            'malla': (self._grafo.filasMalla(), self._grafo.columnasMalla()),
+            'aristas_por_particion': list(self._grafo.aristasPorParticion()),
+            'nodos_por_particion': list(self._grafo.nodosPorParticion()),
+            'niveles': ultimo.niveles,
+            'bytes': ultimo.bytesIntercambiados,
+            'mensajes': ultimo.mensajes,
+            'segundos': ultimo.segundos,
+        }
+    
+    def cerrar(self):
+        """Termina los procesos trabajadores (idempotente)."""
+        with nogil:
+            self._grafo.detener()
+    
+    @property
+    def activo(self) -> bool:
+        """True mientras los trabajadores sigan en marcha."""
+        return self._grafo.estaActivo()
+    
+    @property
+    def num_particiones(self) -> int:
+        """Número de procesos trabajadores (0 tras cerrar)."""
+        return self._grafo.getNumParticiones()
+    
+    @property
+    def esquema(self) -> str:
+        """Esquema de partición: '1d' o '2d'."""
+        return self._esquema
+
+
+cdef class IteradorRecorrido:
+    """
+    Iterador sobre un recorrido del núcleo que avanza bloque a bloque.
+    
+    Cada bloque se llena sin el GIL en un arreglo NumPy nuevo. Al
+    agotarse, o al llamar a close(), se libera el estado del recorrido y
+    el grafo vuelve a admitir recargas. Un mismo iterador no puede
+    avanzar desde dos hilos a la vez.
+    """
+    cdef RecorridoIncremental* _recorrido
+    cdef PyGrafoDisperso _grafo
+    cdef int _tam_bloque
+    cdef bint _con_distancias
+    cdef int64_t _emitidos
+    cdef bint _en_uso
+    cdef bint _cierre_pendiente
+    
+    @staticmethod
+    cdef IteradorRecorrido crear(PyGrafoDisperso grafo, RecorridoIncremental* recorrido,
+                                 int tam_bloque, bint con_distancias):
+        cdef IteradorRecorrido iterador = IteradorRecorrido.__new__(IteradorRecorrido)
+        iterador._recorrido = recorrido
+        iterador._grafo = grafo
+        iterador._tam_bloque = tam_bloque
+        iterador._con_distancias = con_distancias
+        grafo._recorridos_activos += 1
+        return iterador
+    
+    def __dealloc__(self):
+        self._liberar()
+    
+    cdef _liberar(self):
+        if self._recorrido != NULL:
+            del self._recorrido
+            self._recorrido = NULL
+            if self._grafo is not None:
+                self._grafo._recorridos_activos -= 1
+    
+    def __iter__(self):
+        return self
+    
+    def __next__(self):
+        if self._recorrido == NULL:
+            raise StopIteration
+        if self._en_uso:
+            raise RuntimeError("El recorrido ya esta avanzando en otro hilo.")
+        nodos = np.empty(self._tam_bloque, dtype=np.intc)
+        distancias = np.empty(self._tam_bloque if self._con_distancias else 0, dtype=np.intc)
+        cdef int[::1] v_nodos = nodos
+        cdef int[::1] v_distancias = distancias
+        cdef int* p_distancias = &v_distancias[0] if self._con_distancias else NULL
+        cdef int escritos
+        # Se marca con el GIL tomado: otro __next__ o close() lo ve antes de
+        # que el bloque empiece a llenarse
+        self._en_uso = True
+        try:
+            with nogil:
+                escritos = self._recorrido.siguienteBloque(&v_nodos[0], p_distancias, self._tam_bloque)
+        finally:
+            self._en_uso = False
+        if self._cierre_pendiente:
+            self._liberar()
+        if escritos == 0:
+            self._liberar()
+            raise StopIteration
+        self._emitidos += escritos
+        if escritos < self._tam_bloque:
+            # Último bloque: recortar sin retener el búfer completo
+            nodos = nodos[:escritos].copy()
+            distancias = distancias[:escritos].copy()
+        if self._con_distancias:
+            return nodos, distancias
+        return nodos
+    
+    @property
+    def emitidos(self) -> int:
+        """Nodos entregados hasta ahora."""
+        return self._emitidos
+    
+    def close(self):
+        """
+        Abandona el recorrido y libera su estado.
+        
+        Si otro hilo está llenando un bloque, el estado se libera cuando
+        ese bloque termina; el bloque se entrega y el iterador queda agotado.
+        """
+        if self._en_uso:
+            self._cierre_pendiente = True
+            return
+        self._liberar()
+
+
+cdef class TrabajoAsincrono:
+    """
+    Operación del núcleo en curso en el ejecutor nativo.
+    
+    El atributo future es un concurrent.futures.Future que se resuelve
+    desde el hilo del ejecutor: puede esperarse con result(), encadenarse
+    con add_done_callback() (p. ej. delegando en root.after de Tkinter)
+    o adaptarse a asyncio con asyncio.wrap_future(). Si el trabajo se
+    cancela, el future queda cancelado; cancelar el future también pide
+    la cancelación del trabajo.
+    """
+    cdef Trabajo* _trabajo
+    cdef TipoTrabajo _tipo
+    cdef PyGrafoDisperso _grafo
+    cdef readonly object future
+    
+    def __dealloc__(self):
+        if self._trabajo != NULL:
+            del self._trabajo
+    
+    def cancelar(self) -> bool:
+        """
+        Pide la cancelación cooperativa; el núcleo la atiende en sus bucles.
+        
+        Returns:
+            bool: False si el trabajo ya había terminado
+        """
+        if self.future.done():
+            return False
+        self._trabajo.control.cancelar()
+        return True
+    
+    def progreso(self) -> tuple:
+        """(avance, total) en las unidades de la operación."""
+        return (self._trabajo.control.getProgreso(), self._trabajo.control.getTotal())
+    
+    @property
+    def estado(self) -> str:
+        """'pendiente', 'ejecutando', 'completado' o 'cancelado'."""
+        return _ESTADOS_TRABAJO[<int> self._trabajo.control.getEstado()]
+    
+    def result(self, timeout=None):
+        """Espera el resultado (atajo de future.result)."""
+        return self.future.result(timeout)
+    
+    def done(self) -> bool:
+        return self.future.done()
+    
+    def add_done_callback(self, fn):
+        """fn(future) se invoca al terminar, desde el hilo del ejecutor."""
+        self.future.add_done_callback(fn)
+    
+    def _al_resolver(self, future):
+        # Cancelar el future (p. ej. desde asyncio) cancela también el trabajo
+        if future.cancelled():
+            self._trabajo.control.cancelar()
+    
+    cdef _completar(self):
+        """Convierte el resultado y resuelve el future (con el GIL tomado)."""
+        cdef TrabajoCarga* carga
+        self._grafo._trabajos_en_curso -= 1
+        if self._tipo == TRABAJO_CARGA:
+            self._grafo._carga_en_curso = False
+        
+        if self._trabajo.control.estaCancelado():
+            self.future.cancel()
+            return
+        if not self.future.set_running_or_notify_cancel():
+            return
+        
+        try:
+            if self._tipo == TRABAJO_CARGA:
+                carga = <TrabajoCarga*> self._trabajo
+                if carga.exito:
+                    self._grafo._oraculo.limpiar()
+                    self._grafo._indice_pll.limpiar()
+                    self._grafo._tiempo_carga = carga.segundos
+                    self._grafo._archivo_cargado = carga.archivo.decode('utf-8')
+                    self._grafo._arreglos_externos = None
+                    print(f"[Cython] Archivo cargado exitosamente en {carga.segundos:.3f} segundos.")
+                resultado = carga.exito
+            elif self._tipo == TRABAJO_BFS:
+                resultado = [(p.first, p.second) for p in (<TrabajoBFS*> self._trabajo).resultado]
+            else:
+                resultado = list((<TrabajoDFS*> self._trabajo).resultado)
+            self.future.set_result(resultado)
+        except BaseException as e:
+            self.future.set_exception(e)
+
+
+cdef void _trabajo_terminado(void* contexto) noexcept with gil:
+    """Adaptador C++ -> Python: resuelve el future y suelta la referencia del envío."""
+    cdef TrabajoAsincrono trabajo = <TrabajoAsincrono> contexto
+    try:
+        trabajo._completar()
+    finally:
+        Py_DECREF(trabajo)
+
+
+def _detener_ejecutor():
+    if _ejecutor_usado:
+        with nogil:
+            EjecutorTrabajos.instancia().detener()
+
+
+atexit.register(_detener_ejecutor)
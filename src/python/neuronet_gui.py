@@ -15,6 +15,7 @@ import threading
 import os
 import sys
 import time
+import numpy as np
 
 # Añadir directorio raíz al path para encontrar el módulo compilado
 ROOT_DIR = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
@@ -46,6 +47,14 @@ except ImportError:
     NETWORKX_DISPONIBLE = False
 
 
+# Límites de la visualización de subgrafos: la disposición es nativa, así
+# que el coste lo pone el dibujo. Bolas BFS mayores se muestrean en el
+# núcleo; con pocas aristas se dibujan flechas y etiquetas con NetworkX
+MAX_NODOS_VISUALIZACION = 50000
+MAX_ARISTAS_VISUALIZACION = 200000
+MAX_ARISTAS_DETALLE = 500
+
+
 class ConsoleRedirector:
     """Redirige la salida estándar a un widget de texto."""
     
@@ -95,6 +104,7 @@ class NeuroNetGUI:
         self.memoria_usada = tk.StringVar(value="0 MB")
         self.tiempo_carga = tk.StringVar(value="0.00 s")
         self.nodo_mayor_grado = tk.StringVar(value="-")
+        self.diametro = tk.StringVar(value="-")
         
         # Configurar estilos
         self._configurar_estilos()
@@ -164,12 +174,21 @@ class NeuroNetGUI:
         # Sección: Análisis
         ttk.Label(control_frame, text="Análisis", style='Header.TLabel').pack(pady=(0, 10))
         
-        ttk.Button(
+        boton_critico = ttk.Button(
             control_frame,
             text="🔍 Identificar Nodo Crítico",
             command=self._identificar_nodo_critico,
             width=25
-        ).pack(pady=5)
+        )
+        boton_critico.pack(pady=5)
+        
+        boton_diametro = ttk.Button(
+            control_frame,
+            text="📏 Calcular Diámetro",
+            command=self._calcular_diametro,
+            width=25
+        )
+        boton_diametro.pack(pady=5)
         
         ttk.Separator(control_frame, orient='horizontal').pack(fill='x', pady=15)
         
@@ -189,19 +208,21 @@ class NeuroNetGUI:
         self.entry_profundidad.grid(row=1, column=1, padx=5, pady=2)
         self.entry_profundidad.insert(0, "2")
         
-        ttk.Button(
+        boton_bfs = ttk.Button(
             control_frame,
             text="▶ Ejecutar BFS",
             command=self._ejecutar_bfs,
             width=25
-        ).pack(pady=10)
+        )
+        boton_bfs.pack(pady=10)
         
-        ttk.Button(
+        boton_visualizar = ttk.Button(
             control_frame,
             text="📊 Visualizar Subgrafo",
             command=self._visualizar_subgrafo,
             width=25
-        ).pack(pady=5)
+        )
+        boton_visualizar.pack(pady=5)
         
         ttk.Separator(control_frame, orient='horizontal').pack(fill='x', pady=15)
         
@@ -216,12 +237,17 @@ class NeuroNetGUI:
         self.entry_nodo_dfs.grid(row=0, column=1, padx=5, pady=2)
         self.entry_nodo_dfs.insert(0, "0")
         
-        ttk.Button(
+        boton_dfs = ttk.Button(
             control_frame,
             text="▶ Ejecutar DFS",
             command=self._ejecutar_dfs,
             width=25
-        ).pack(pady=10)
+        )
+        boton_dfs.pack(pady=10)
+        
+        # Botones que leen el grafo: se desactivan mientras se carga otro
+        self.botones_analisis = [boton_critico, boton_diametro, boton_bfs,
+                                 boton_visualizar, boton_dfs]
         
         # === Panel de estadísticas (arriba derecha) ===
         stats_frame = ttk.LabelFrame(main_frame, text="Estadísticas del Grafo", padding="10")
@@ -237,6 +263,7 @@ class NeuroNetGUI:
             ("Memoria:", self.memoria_usada),
             ("Tiempo carga:", self.tiempo_carga),
             ("Nodo más crítico:", self.nodo_mayor_grado),
+            ("Diámetro:", self.diametro),
         ]
         
         for i, (label, var) in enumerate(labels):
@@ -313,28 +340,62 @@ class NeuroNetGUI:
             self._log(f"Cargando archivo: {archivo}")
             self._log(f"{'='*50}")
             
-            # Ejecutar en hilo separado para no bloquear la GUI
-            def cargar():
+            # La carga corre en el ejecutor nativo; la GUI solo consulta el progreso
+            anterior = self.archivo_cargado.get()
+            try:
+                trabajo = self.grafo.cargar_datos_async(archivo)
+            except RuntimeError as e:
+                messagebox.showerror("Error", str(e))
+                return
+            if trabajo is None:
+                messagebox.showerror("Error", "No se pudo iniciar la carga.")
+                return
+            self._habilitar_analisis(False)
+            
+            def mostrar_progreso():
+                if trabajo.done():
+                    return
+                leidos, total = trabajo.progreso()
+                if total > 0:
+                    self.archivo_cargado.set(f"cargando... {100 * leidos // total}%")
+                self.root.after(200, mostrar_progreso)
+            
+            def terminar(future):
+                self._habilitar_analisis(True)
+                if future.cancelled():
+                    self.archivo_cargado.set(anterior)
+                    self._log("[GUI] Carga cancelada.")
+                    return
                 try:
-                    exito = self.grafo.cargar_datos(archivo)
-                    
-                    if exito:
-                        # Actualizar estadísticas
-                        self.archivo_cargado.set(os.path.basename(archivo))
-                        self.num_nodos.set(f"{self.grafo.get_num_nodos():,}")
-                        self.num_aristas.set(f"{self.grafo.get_num_aristas():,}")
-                        self.memoria_usada.set(f"{self.grafo.get_memoria_usada_mb():.2f} MB")
-                        self.tiempo_carga.set(f"{self.grafo.tiempo_carga:.3f} s")
-                        
-                        self._log("\n[GUI] Archivo cargado exitosamente.")
-                    else:
-                        messagebox.showerror("Error", "No se pudo cargar el archivo.")
-                        
+                    exito = future.result()
                 except Exception as e:
+                    self.archivo_cargado.set(anterior)
                     self._log(f"[ERROR] {str(e)}")
                     messagebox.showerror("Error", f"Error al cargar: {str(e)}")
+                    return
+                
+                if exito:
+                    # Actualizar estadísticas
+                    self.archivo_cargado.set(os.path.basename(archivo))
+                    self.num_nodos.set(f"{self.grafo.get_num_nodos():,}")
+                    self.num_aristas.set(f"{self.grafo.get_num_aristas():,}")
+                    self.memoria_usada.set(f"{self.grafo.get_memoria_usada_mb():.2f} MB")
+                    self.tiempo_carga.set(f"{self.grafo.tiempo_carga:.3f} s")
+                    
+                    self._log("\n[GUI] Archivo cargado exitosamente.")
+                else:
+                    # Si la carga falla, el grafo anterior sigue cargado
+                    self.archivo_cargado.set(anterior)
+                    messagebox.showerror("Error", "No se pudo cargar el archivo.")
             
-            threading.Thread(target=cargar, daemon=True).start()
+            # El future se resuelve en el hilo del ejecutor: delegar en el hilo de Tk
+            trabajo.add_done_callback(lambda future: self.root.after(0, terminar, future))
+            mostrar_progreso()
+    
+    def _habilitar_analisis(self, activos):
+        """Activa o desactiva los botones de análisis (p. ej. durante una carga)."""
+        for boton in self.botones_analisis:
+            boton.configure(state='normal' if activos else 'disabled')
     
     def _identificar_nodo_critico(self):
         """Identifica el nodo con mayor grado en el grafo."""
@@ -355,6 +416,35 @@ class NeuroNetGUI:
         except Exception as e:
             self._log(f"[ERROR] {str(e)}")
     
+    def _calcular_diametro(self):
+        """Calcula el diámetro (iFUB) mostrando las cotas mientras avanza."""
+        if not self._verificar_grafo_cargado():
+            return
+        
+        self._log("\n" + "="*50)
+        self._log("Calculando diámetro de la mayor componente (iFUB)...")
+        self._log("="*50)
+        self.diametro.set("calculando...")
+        
+        def progreso(bfs, inferior, superior, pendientes):
+            # Se invoca desde el hilo del cálculo: delegar en el hilo de Tk
+            texto = f"[{inferior}, {superior}] ({bfs} BFS)"
+            self.root.after(0, self.diametro.set, texto)
+        
+        def calcular():
+            try:
+                resultado = self.grafo.diametro(callback=progreso)
+                texto = f"{resultado['diametro']} ({resultado['bfs_realizados']} BFS)"
+                self.root.after(0, self.diametro.set, texto)
+                self.root.after(0, self._log,
+                                f"\n[RESULTADO] Diámetro: {resultado['diametro']} "
+                                f"(componente de {resultado['nodos_componente']:,} nodos, "
+                                f"{resultado['bfs_realizados']} BFS)")
+            except Exception as e:
+                self.root.after(0, self._log, f"[ERROR] {str(e)}")
+        
+        threading.Thread(target=calcular, daemon=True).start()
+    
     def _ejecutar_bfs(self):
         """Ejecuta una búsqueda BFS desde el nodo especificado."""
         if not self._verificar_grafo_cargado():
@@ -423,10 +513,10 @@ class NeuroNetGUI:
         if not self._verificar_grafo_cargado():
             return
         
-        if not MATPLOTLIB_DISPONIBLE or not NETWORKX_DISPONIBLE:
+        if not MATPLOTLIB_DISPONIBLE:
             messagebox.showerror(
                 "Error", 
-                "Se requiere matplotlib y networkx para visualización."
+                "Se requiere matplotlib para visualización."
             )
             return
         
@@ -441,56 +531,74 @@ class NeuroNetGUI:
         self._log(f"Generando visualización del subgrafo...")
         self._log("="*50)
         
-        try:
-            # Obtener aristas del subgrafo
-            aristas = self.grafo.get_aristas_subgrafo(nodo_inicio, profundidad)
-            
-            if not aristas:
-                self._log("[ADVERTENCIA] No se encontraron aristas para visualizar.")
+        def calcular():
+            # Muestra representativa de la bola BFS dentro del presupuesto de
+            # dibujo y disposición en el núcleo, fuera del hilo de Tk
+            try:
+                muestra = self.grafo.muestrear_subgrafo(nodo_inicio, profundidad,
+                                                        max_nodos=MAX_NODOS_VISUALIZACION,
+                                                        max_aristas=MAX_ARISTAS_VISUALIZACION)
+                if muestra is None or muestra['subgrafo'].get_num_aristas() == 0:
+                    self.root.after(0, self._log,
+                                    "[ADVERTENCIA] No se encontraron aristas para visualizar.")
+                    return
+                subgrafo = muestra['subgrafo']
+                offsets, destinos = subgrafo.get_vecinos_lote(np.arange(len(muestra['nodos'])))
+                pos = subgrafo.disposicion_fuerzas()
+            except Exception as e:
+                self.root.after(0, self._log, f"[ERROR] Error al visualizar: {str(e)}")
                 return
-            
-            # Limitar número de aristas para visualización
-            max_aristas = 500
-            if len(aristas) > max_aristas:
-                self._log(f"[INFO] Limitando visualización a {max_aristas} aristas de {len(aristas)}")
-                aristas = aristas[:max_aristas]
-            
-            # Crear grafo de NetworkX (SOLO para dibujar, no para calcular)
-            G = nx.DiGraph()
-            G.add_edges_from(aristas)
+            self.root.after(0, self._dibujar_subgrafo, nodo_inicio, profundidad,
+                            muestra, offsets, destinos, pos)
+        
+        threading.Thread(target=calcular, daemon=True).start()
+    
+    def _dibujar_subgrafo(self, nodo_inicio, profundidad, muestra, offsets, destinos, pos):
+        """Dibuja en el canvas una muestra ya calculada (hilo de Tk)."""
+        try:
+            ids = muestra['nodos']
+            nivel_local = muestra['niveles']
+            ocultos = muestra['ocultos']
+            num_nodos = len(ids)
+            if num_nodos < muestra['nodos_bola']:
+                self._log(f"[INFO] Muestra de {num_nodos} de {muestra['nodos_bola']} nodos y "
+                          f"{muestra['aristas_muestra']} de {muestra['aristas_bola']} aristas")
+                self._log(f"  Nodos omitidos por nivel: {muestra['podados_por_nivel'].tolist()}")
+            origenes = np.repeat(np.arange(num_nodos), np.diff(offsets))
             
             # Limpiar el canvas
             self.ax.clear()
             
-            # Configurar colores por nivel
-            bfs_result = self.grafo.bfs(nodo_inicio, profundidad)
-            nivel_nodo = {nodo: nivel for nodo, nivel in bfs_result if nodo in G.nodes()}
-            
-            # Colores por nivel
-            colores = []
-            for nodo in G.nodes():
-                if nodo == nodo_inicio:
-                    colores.append('#ff0000')  # Rojo para el nodo inicial
-                elif nodo in nivel_nodo:
-                    nivel = nivel_nodo[nodo]
-                    if nivel == 1:
-                        colores.append('#ff9900')  # Naranja para nivel 1
-                    else:
-                        colores.append('#3399ff')  # Azul para otros niveles
-                else:
-                    colores.append('#cccccc')  # Gris para nodos sin nivel
+            # Colores por nivel: rojo el inicio, naranja el nivel 1, azul el resto
+            colores = np.where(nivel_local == 0, '#ff0000',
+                               np.where(nivel_local == 1, '#ff9900', '#3399ff'))
             
-            # Dibujar el grafo
-            pos = nx.spring_layout(G, k=2, iterations=50)
-            
-            nx.draw_networkx_nodes(G, pos, ax=self.ax, node_color=colores, 
-                                   node_size=300, alpha=0.9)
-            nx.draw_networkx_edges(G, pos, ax=self.ax, edge_color='#666666',
-                                   arrows=True, arrowsize=10, alpha=0.5)
-            nx.draw_networkx_labels(G, pos, ax=self.ax, font_size=8)
+            if len(destinos) <= MAX_ARISTAS_DETALLE and NETWORKX_DISPONIBLE:
+                # Pocos elementos: flechas y etiquetas con NetworkX (SOLO para dibujar)
+                G = nx.DiGraph()
+                G.add_nodes_from(ids.tolist())
+                G.add_edges_from(zip(ids[origenes].tolist(), ids[destinos].tolist()))
+                pos_nx = {int(v): pos[i] for i, v in enumerate(ids)}
+                nx.draw_networkx_nodes(G, pos_nx, ax=self.ax, nodelist=ids.tolist(),
+                                       node_color=colores.tolist(), node_size=300, alpha=0.9)
+                nx.draw_networkx_edges(G, pos_nx, ax=self.ax, edge_color='#666666',
+                                       arrows=True, arrowsize=10, alpha=0.5)
+                nx.draw_networkx_labels(G, pos_nx, ax=self.ax, font_size=8)
+            else:
+                from matplotlib.collections import LineCollection
+                segmentos = np.stack([pos[origenes], pos[destinos]], axis=1)
+                self.ax.add_collection(LineCollection(segmentos, colors='#666666',
+                                                      linewidths=0.3, alpha=0.3))
+                # El área de cada nodo crece con los vecinos que quedaron fuera
+                base = min(300.0, max(1.0, 3000.0 / np.sqrt(num_nodos)))
+                self.ax.scatter(pos[:, 0], pos[:, 1], c=colores,
+                                s=base * (1.0 + np.log1p(ocultos)), alpha=0.9, linewidths=0)
+                self.ax.autoscale_view()
             
-            self.ax.set_title(f"Subgrafo desde nodo {nodo_inicio} (profundidad {profundidad})\n"
-                              f"Nodos: {G.number_of_nodes()} | Aristas: {G.number_of_edges()}")
+            muestreado = " (muestra)" if num_nodos < muestra['nodos_bola'] else ""
+            self.ax.set_title(f"Subgrafo desde nodo {nodo_inicio} (profundidad {profundidad})"
+                              f"{muestreado}\n"
+                              f"Nodos: {num_nodos} | Aristas: {len(destinos)}")
             self.ax.axis('off')
             
             # Añadir leyenda
@@ -507,8 +615,8 @@ class NeuroNetGUI:
             
             self.canvas.draw()
             
-            self._log(f"[GUI] Visualización generada: {G.number_of_nodes()} nodos, "
-                      f"{G.number_of_edges()} aristas")
+            self._log(f"[GUI] Visualización generada: {num_nodos} nodos, "
+                      f"{len(destinos)} aristas")
             
         except Exception as e:
             self._log(f"[ERROR] Error al visualizar: {str(e)}")
@@ -25,6 +25,14 @@ DATA_DIR = os.path.join(os.path.dirname(os.path.dirname(__file__)), "data")
 EJEMPLO_GRAFO = os.path.join(DATA_DIR, "ejemplo_grafo.txt")
 
 
+@pytest.fixture
+def grafo():
+    """Grafo test_1000.txt, cargado de nuevo en cada prueba (algunas clases usan otro)"""
+    g = neuronet_core.PyGrafoDisperso()
+    g.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+    return g
+
+
 @pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
 class TestGrafoDisperso:
     """Pruebas para la clase PyGrafoDisperso"""
@@ -132,6 +140,1209 @@ class TestGrafoDisperso:
         assert stats['num_nodos'] > 0
 
 
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestCaminatasAleatorias:
+    """Pruebas para el generador de caminatas aleatorias"""
+    
+    @pytest.fixture
+    def grafo(self):
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(EJEMPLO_GRAFO)
+        return g
+    
+    def test_forma_y_aristas_validas(self, grafo):
+        """Cada paso de una caminata debe seguir una arista existente"""
+        caminatas = grafo.caminatas_aleatorias(longitud=6, caminatas_por_nodo=3, nodos=[0, 1, 2])
+        assert caminatas.shape == (9, 6)
+        assert caminatas.dtype.itemsize == 4
+        assert list(caminatas[:3, 0]) == [0, 1, 2]
+        
+        for fila in caminatas:
+            for actual, siguiente in zip(fila[:-1], fila[1:]):
+                if siguiente < 0:
+                    break
+                assert siguiente in grafo.get_vecinos(int(actual))
+    
+    def test_reproducible(self, grafo):
+        """La misma semilla produce las mismas caminatas node2vec"""
+        a = grafo.caminatas_aleatorias(longitud=10, caminatas_por_nodo=2, p=0.5, q=2.0, semilla=7)
+        b = grafo.caminatas_aleatorias(longitud=10, caminatas_por_nodo=2, p=0.5, q=2.0, semilla=7)
+        assert (a == b).all()
+    
+    def test_relleno_sin_salida(self, grafo):
+        """Una caminata desde un nodo sin salida se rellena con -1"""
+        hoja = next(n for n in range(grafo.get_num_nodos()) if grafo.obtener_grado(n) == 0)
+        caminatas = grafo.caminatas_aleatorias(longitud=4, caminatas_por_nodo=1, nodos=[hoja])
+        assert list(caminatas[0]) == [hoja, -1, -1, -1]
+
+
+def _excentricidades_fuerza_bruta(grafo):
+    """Excentricidades de la vista no dirigida mediante BFS desde cada nodo"""
+    from collections import deque
+    n = grafo.get_num_nodos()
+    adyacencia = [set() for _ in range(n)]
+    for u in range(n):
+        for v in grafo.get_vecinos(u):
+            if u != v:
+                adyacencia[u].add(v)
+                adyacencia[v].add(u)
+    
+    excentricidades = []
+    for origen in range(n):
+        distancia = {origen: 0}
+        cola = deque([origen])
+        while cola:
+            u = cola.popleft()
+            for v in adyacencia[u]:
+                if v not in distancia:
+                    distancia[v] = distancia[u] + 1
+                    cola.append(v)
+        excentricidades.append(max(distancia.values()))
+    return excentricidades
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestDiametro:
+    """Pruebas para iFUB y el acotamiento de excentricidades"""
+    
+    def test_excentricidades_exactas(self, grafo):
+        """Takes-Kosters converge a las excentricidades reales"""
+        inferior, superior = grafo.excentricidades()
+        esperadas = _excentricidades_fuerza_bruta(grafo)
+        assert list(inferior) == esperadas
+        assert list(superior) == esperadas
+    
+    def test_diametro_exacto(self, grafo):
+        """iFUB coincide con la máxima excentricidad"""
+        resultado = grafo.diametro()
+        assert resultado['exacto']
+        assert resultado['diametro'] == max(_excentricidades_fuerza_bruta(grafo))
+    
+    def test_progreso_y_cancelacion(self, grafo):
+        """El callback recibe cotas coherentes y puede cancelar"""
+        reportes = []
+        
+        def progreso(bfs, inferior, superior, pendientes):
+            reportes.append((bfs, inferior, superior))
+            return False
+        
+        resultado = grafo.diametro(callback=progreso)
+        assert len(reportes) == 1
+        assert not resultado['exacto']
+        assert resultado['bfs_realizados'] == 1
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestOraculoLandmarks:
+    """Pruebas para el oráculo de distancias por landmarks"""
+    
+    @staticmethod
+    def _distancias_bfs(grafo, origen):
+        return {n: d for n, d in grafo.bfs(origen, 10**6)}
+    
+    @pytest.mark.parametrize("estrategia", ["grado", "cobertura"])
+    def test_cotas_validas_y_refinamiento_exacto(self, grafo, estrategia):
+        """Las cotas contienen la distancia real y el refinamiento la fija"""
+        assert grafo.construir_oraculo(k=4, estrategia=estrategia)
+        for u in [0, 1, 7, 42]:
+            distancias = self._distancias_bfs(grafo, u)
+            for v in range(0, grafo.get_num_nodos(), 37):
+                real = distancias.get(v, -1)
+                inferior, superior = grafo.distancia_estimada(u, v)
+                if real < 0:
+                    assert superior == -1
+                else:
+                    assert inferior <= real
+                    assert superior == -1 or real <= superior
+                assert grafo.distancia(u, v) == (real, real)
+    
+    def test_persistencia(self, grafo, tmp_path):
+        """El oráculo guardado se recarga con las mismas respuestas"""
+        grafo.construir_oraculo(k=3)
+        ruta = str(tmp_path / "grafo.landmarks")
+        assert grafo.guardar_oraculo(ruta)
+        
+        otro = neuronet_core.PyGrafoDisperso()
+        otro.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+        assert otro.cargar_oraculo(ruta)
+        assert otro.landmarks == grafo.landmarks
+        assert otro.distancia_estimada(0, 523) == grafo.distancia_estimada(0, 523)
+    
+    def test_rechaza_grafo_distinto(self, tmp_path):
+        """Un oráculo no se carga sobre un grafo diferente"""
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+        g.construir_oraculo(k=2)
+        ruta = str(tmp_path / "grafo.landmarks")
+        g.guardar_oraculo(ruta)
+        
+        otro = neuronet_core.PyGrafoDisperso()
+        otro.cargar_datos(EJEMPLO_GRAFO)
+        assert not otro.cargar_oraculo(ruta)
+
+
+def _distancias_no_dirigidas(grafo, origen):
+    """Distancias BFS desde origen sobre la vista no dirigida"""
+    from collections import deque
+    n = grafo.get_num_nodos()
+    adyacencia = [set() for _ in range(n)]
+    for u in range(n):
+        for v in grafo.get_vecinos(u):
+            adyacencia[u].add(v)
+            adyacencia[v].add(u)
+    distancia = {origen: 0}
+    cola = deque([origen])
+    while cola:
+        u = cola.popleft()
+        for v in adyacencia[u]:
+            if v not in distancia:
+                distancia[v] = distancia[u] + 1
+                cola.append(v)
+    return distancia
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestIndicePLL:
+    """Pruebas para el índice de etiquetado podado"""
+    
+    @pytest.mark.parametrize("raices_bp", [0, 4])
+    def test_distancias_exactas(self, grafo, raices_bp):
+        """Las consultas coinciden con BFS en la vista no dirigida"""
+        assert grafo.construir_indice_pll(num_raices_bp=raices_bp)
+        n = grafo.get_num_nodos()
+        for u in [0, 5, 127, 523]:
+            distancias = _distancias_no_dirigidas(grafo, u)
+            for v in range(0, n, 13):
+                assert grafo.distancia_pll(u, v) == distancias.get(v, -1)
+    
+    def test_lote_y_persistencia(self, grafo, tmp_path):
+        """El lote coincide con las consultas individuales tras recargar"""
+        import numpy as np
+        grafo.construir_indice_pll()
+        ruta = str(tmp_path / "grafo.pll")
+        assert grafo.guardar_indice_pll(ruta)
+        
+        otro = neuronet_core.PyGrafoDisperso()
+        otro.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+        assert otro.cargar_indice_pll(ruta)
+        
+        origenes = np.arange(0, 200, dtype=np.int32)
+        destinos = origenes[::-1].copy()
+        lote = otro.distancias_pll(origenes, destinos)
+        assert list(lote) == [grafo.distancia_pll(int(u), int(v)) for u, v in zip(origenes, destinos)]
+        assert otro.estadisticas_indice_pll()['bytes_indice'] > 0
+
+    def test_rechaza_indice_corrupto(self, grafo, tmp_path):
+        """Un archivo con arreglos incoherentes no se adopta"""
+        import struct
+        grafo.construir_indice_pll(num_raices_bp=4)
+        ruta = tmp_path / "grafo.pll"
+        assert grafo.guardar_indice_pll(str(ruta))
+        original = ruta.read_bytes()
+        n = grafo.get_num_nodos()
+
+        # Cabecera de 28 bytes, luego el tamaño y los rangos
+        datos = bytearray(original)
+        datos[36:40] = struct.pack("<i", n + 7)
+        ruta.write_bytes(bytes(datos))
+        assert not grafo.cargar_indice_pll(str(ruta))
+
+        # Tamaño de bpDistancia mayor que el archivo
+        datos = bytearray(original)
+        pos = 36 + 4 * n
+        datos[pos:pos + 8] = struct.pack("<Q", 1 << 60)
+        ruta.write_bytes(bytes(datos))
+        assert not grafo.cargar_indice_pll(str(ruta))
+        with pytest.raises(RuntimeError):
+            grafo.distancia_pll(0, 1)
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestSubgrafoInducido:
+    """Pruebas para la extracción de subgrafos inducidos"""
+    
+    def test_aristas_inducidas(self, grafo):
+        """Se conservan exactamente las aristas con ambos extremos en el conjunto"""
+        nodos = [n for n, _ in grafo.bfs(0, 3)][:6] + [500, 3, 3, 640]
+        sub = grafo.extraer_subgrafo(nodos)
+        ids = list(sub.ids_originales())
+        assert ids == sorted(set(nodos))
+        
+        esperadas = {(u, v) for u in ids for v in grafo.get_vecinos(u) if v in ids}
+        obtenidas = {(ids[u], ids[v]) for u in range(sub.get_num_nodos())
+                     for v in sub.get_vecinos(u)}
+        assert obtenidas == esperadas
+        assert sub.get_num_aristas() == len(esperadas)
+    
+    def test_vecindad_bfs(self, grafo):
+        """El subgrafo BFS contiene los nodos del BFS y compone los IDs"""
+        sub = grafo.extraer_subgrafo_bfs(0, 2)
+        ids = list(sub.ids_originales())
+        assert ids == sorted(n for n, _ in grafo.bfs(0, 2))
+        assert sub.get_num_aristas() >= len(grafo.bfs(0, 2)) - 1
+        
+        nieto = sub.extraer_subgrafo([0, 1])
+        assert list(nieto.ids_originales()) == ids[:2]
+    
+    def test_nodo_invalido(self, grafo):
+        """Los IDs fuera de rango se rechazan"""
+        assert grafo.extraer_subgrafo([1, grafo.get_num_nodos()]) is None
+        assert grafo.extraer_subgrafo_bfs(-1, 2) is None
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestRedesEgoLote:
+    """Pruebas para las redes ego calculadas en lote"""
+    
+    @pytest.mark.parametrize("profundidad", [1, 2])
+    def test_coincide_con_llamadas_individuales(self, grafo, profundidad):
+        """Cada red del lote es idéntica a get_aristas_subgrafo"""
+        import numpy as np
+        semillas = np.arange(0, grafo.get_num_nodos(), 7, dtype=np.int32)
+        offsets, aristas = grafo.get_aristas_subgrafos_lote(semillas, profundidad)
+        assert offsets.shape == (len(semillas) + 1,)
+        assert aristas.shape == (offsets[-1], 2)
+        for i, semilla in enumerate(semillas):
+            red = [tuple(a) for a in aristas[offsets[i]:offsets[i + 1]].tolist()]
+            assert red == grafo.get_aristas_subgrafo(int(semilla), profundidad)
+    
+    def test_semillas_invalidas(self, grafo):
+        """Las semillas fuera de rango producen redes vacías"""
+        offsets, aristas = grafo.get_aristas_subgrafos_lote([-1, 0, grafo.get_num_nodos()], 1)
+        assert offsets[1] == 0
+        assert offsets[3] == offsets[2]
+        assert offsets[2] == len(grafo.get_aristas_subgrafo(0, 1))
+
+
+def _grafo_desde_aristas(tmp_path, aristas):
+    """Escribe una Edge List temporal y la carga"""
+    ruta = tmp_path / "aristas.txt"
+    ruta.write_text("".join(f"{u} {v}\n" for u, v in aristas))
+    g = neuronet_core.PyGrafoDisperso()
+    g.cargar_datos(str(ruta))
+    return g
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestMotivos:
+    """Pruebas para el censo de tríadas y el conteo de grafletes"""
+    
+    def test_censo_bucle_prealimentado(self, tmp_path):
+        """Un feed-forward loop más un nodo aislado"""
+        g = _grafo_desde_aristas(tmp_path, [(0, 1), (1, 2), (0, 2), (3, 3)])
+        censo = g.censo_triadas()
+        assert censo['030T'] == 1
+        assert censo['012'] == 3
+        assert censo['003'] == 0
+        assert sum(censo.values()) == 4
+    
+    def test_grafletes_clique_y_ciclo(self, tmp_path):
+        """K4 sobre 0-3 y un cuadrado sin cuerdas sobre 4-7"""
+        import itertools
+        aristas = list(itertools.combinations(range(4), 2))
+        aristas += [(4, 5), (5, 6), (6, 7), (7, 4)]
+        g = _grafo_desde_aristas(tmp_path, aristas)
+        conteo, orbitas = g.grafletes(orbitas=True)
+        assert conteo['cliques4'] == 1
+        assert conteo['ciclos4'] == 1
+        assert conteo['triangulos'] == 4
+        assert conteo['caminos2'] == 4
+        assert conteo['diamantes'] == conteo['caminos3'] == 0
+        assert orbitas.shape == (8, 4)
+        assert list(orbitas[0]) == [3, 0, 0, 3]
+        assert list(orbitas[4]) == [2, 2, 1, 0]
+    
+    def test_censo_completo(self):
+        """El censo cubre exactamente C(n, 3) tríadas"""
+        import math
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+        censo = g.censo_triadas()
+        assert sum(censo.values()) == math.comb(g.get_num_nodos(), 3)
+        assert all(v >= 0 for v in censo.values())
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestPatrones:
+    """Pruebas para la búsqueda de patrones"""
+    
+    ARISTAS = [(0, 1), (1, 2), (2, 0), (2, 3), (3, 4), (4, 2), (1, 3), (1, 3)]
+    
+    def test_coincide_con_fuerza_bruta(self, tmp_path):
+        """Todas las asignaciones que preservan las aristas del patrón"""
+        import itertools
+        g = _grafo_desde_aristas(tmp_path, self.ARISTAS)
+        aristas = set(self.ARISTAS)
+        for patron in ([(0, 1), (1, 2)], [(0, 1), (1, 2), (2, 0)], [(0, 1), (0, 2)]):
+            k = max(max(a) for a in patron) + 1
+            esperadas = sorted(p for p in itertools.permutations(range(5), k)
+                               if all((p[u], p[v]) in aristas for u, v in patron))
+            obtenidas = sorted(tuple(f) for f in g.buscar_patron(patron).tolist())
+            assert obtenidas == esperadas
+        
+        # Un triángulo no dirigido aparece 6 veces por cada triángulo del grafo
+        assert len(g.buscar_patron([(0, 1), (1, 2), (2, 0)], no_dirigido=True)) == 6 * 3
+    
+    def test_limite_y_streaming(self, tmp_path):
+        """El límite y el callback detienen la búsqueda"""
+        g = _grafo_desde_aristas(tmp_path, self.ARISTAS)
+        assert g.buscar_patron([(0, 1)], limite=2).shape == (2, 2)
+        
+        recibidas = []
+        def recibir(coincidencia):
+            recibidas.append(coincidencia)
+            return len(recibidas) < 3
+        assert g.buscar_patron([(0, 1)], callback=recibir) == 3
+        assert all(len(c) == 2 for c in recibidas)
+    
+    def test_limite_determinista(self):
+        """Con límite se conservan las primeras coincidencias en orden de raíz"""
+        hilos = neuronet_core.PyGrafoDisperso.num_hilos()
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+        try:
+            completas = g.buscar_patron([(0, 1), (1, 2)], no_dirigido=True)
+            for num_hilos in (1, 4):
+                assert neuronet_core.PyGrafoDisperso.configurar_hilos(num_hilos)
+                for limite in (1, 7, 50):
+                    parciales = g.buscar_patron([(0, 1), (1, 2)], no_dirigido=True, limite=limite)
+                    assert parciales.tolist() == completas[:limite].tolist()
+        finally:
+            neuronet_core.PyGrafoDisperso.configurar_hilos(hilos)
+    
+    def test_patron_invalido(self, tmp_path):
+        """Los patrones no conexos o con lazos se rechazan"""
+        g = _grafo_desde_aristas(tmp_path, self.ARISTAS)
+        assert g.buscar_patron([(0, 1), (2, 3)]) is None
+        assert g.buscar_patron([(0, 0)]) is None
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestCaminosK:
+    """Pruebas para los k caminos simples más cortos"""
+    
+    # Rejilla dirigida 0-1-2 / 3-4-5 con aristas hacia la derecha y abajo
+    ARISTAS = [(0, 1), (1, 2), (3, 4), (4, 5), (0, 3), (1, 4), (2, 5)]
+    
+    @staticmethod
+    def _caminos(resultado):
+        offsets, nodos = resultado
+        return [list(nodos[offsets[i]:offsets[i + 1]]) for i in range(len(offsets) - 1)]
+    
+    @pytest.mark.parametrize("bidireccional", [False, True])
+    def test_todos_los_caminos(self, tmp_path, bidireccional):
+        """Los 3 caminos monótonos de la rejilla, en orden de longitud"""
+        g = _grafo_desde_aristas(tmp_path, self.ARISTAS)
+        caminos = self._caminos(g.k_caminos_mas_cortos(0, 5, 10, bidireccional))
+        assert sorted(caminos) == [[0, 1, 2, 5], [0, 1, 4, 5], [0, 3, 4, 5]]
+        
+        caminos = self._caminos(g.k_caminos_mas_cortos(0, 5, 2, bidireccional))
+        assert len(caminos) == 2
+        assert all(c[0] == 0 and c[-1] == 5 for c in caminos)
+    
+    def test_sin_camino_e_invalidos(self, tmp_path):
+        """Sin camino devuelve arreglos vacíos; IDs inválidos devuelven None"""
+        g = _grafo_desde_aristas(tmp_path, self.ARISTAS)
+        offsets, nodos = g.k_caminos_mas_cortos(5, 0, 3)
+        assert list(offsets) == [0] and len(nodos) == 0
+        assert g.k_caminos_mas_cortos(0, 99, 3) is None
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestFlujoMaximo:
+    """Pruebas para el flujo máximo y el corte mínimo"""
+    
+    # Dos regiones {0, 1, 2} y {5, 6} unidas por dos puentes disjuntos (3 y 4)
+    ARISTAS = [(0, 1), (1, 2), (2, 0), (0, 3), (1, 4), (2, 4), (3, 5), (4, 6), (5, 6), (6, 5)]
+    
+    def test_corte_entre_regiones(self, tmp_path):
+        """El corte mínimo son las dos aristas que salen de los puentes"""
+        g = _grafo_desde_aristas(tmp_path, self.ARISTAS)
+        resultado = g.flujo_maximo([0, 1, 2], [5, 6])
+        assert resultado['valor'] == 2
+        assert len(resultado['corte']) == 2
+        assert g.flujo_maximo([0, 1, 2], [5, 6], usar_pesos=True)['valor'] == 2
+        assert g.flujo_maximo(0, 2)['valor'] == 1
+        assert g.flujo_maximo(5, 0)['valor'] == 0
+    
+    def test_corte_separa_los_conjuntos(self):
+        """Quitar las aristas del corte desconecta fuentes de sumideros"""
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+        resultado = g.flujo_maximo([0, 1, 2, 3], [10, 20, 30])
+        corte = {tuple(a) for a in resultado['corte'].tolist()}
+        assert len(corte) == resultado['valor']
+        
+        alcanzados = set()
+        pendientes = [0, 1, 2, 3]
+        while pendientes:
+            u = pendientes.pop()
+            if u in alcanzados:
+                continue
+            alcanzados.add(u)
+            pendientes.extend(v for v in g.get_vecinos(u) if (u, v) not in corte)
+        assert not alcanzados & {10, 20, 30}
+    
+    def test_conjuntos_invalidos(self, tmp_path):
+        """Fuentes y sumideros deben ser válidos y disjuntos"""
+        g = _grafo_desde_aristas(tmp_path, self.ARISTAS)
+        assert g.flujo_maximo([0, 1], [1, 5]) is None
+        assert g.flujo_maximo([], [5]) is None
+        assert g.flujo_maximo([0], [99]) is None
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestTrabajosAsincronos:
+    """Pruebas para los trabajos asíncronos del ejecutor nativo"""
+    
+    def test_carga_y_recorridos_asincronos(self):
+        """Los futures resuelven lo mismo que las llamadas bloqueantes"""
+        g = neuronet_core.PyGrafoDisperso()
+        ruta = os.path.join(DATA_DIR, "test_1000.txt")
+        trabajo = g.cargar_datos_async(ruta)
+        assert trabajo.result(timeout=30) is True
+        assert trabajo.estado == 'completado'
+        leidos, total = trabajo.progreso()
+        assert leidos == total == os.path.getsize(ruta)
+        assert g.archivo_cargado == ruta
+        
+        assert g.bfs_async(0, 3).result(timeout=30) == g.bfs(0, 3)
+        assert g.dfs_async(0).result(timeout=30) == g.dfs(0)
+    
+    def test_future_compatible_con_asyncio(self):
+        """El future se puede esperar desde asyncio"""
+        import asyncio
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+        
+        async def esperar():
+            return await asyncio.wrap_future(g.dfs_async(0).future)
+        
+        assert asyncio.run(esperar()) == g.dfs(0)
+    
+    def test_cancelacion(self, tmp_path):
+        """Cancelar deja el future cancelado y el grafo anterior intacto"""
+        import concurrent.futures
+        ruta = tmp_path / "grande.txt"
+        ruta.write_text("\n".join(f"{i} {i + 1}" for i in range(300000)) + "\n")
+        g = neuronet_core.PyGrafoDisperso()
+        trabajo = g.cargar_datos_async(str(ruta))
+        trabajo.cancelar()
+        with pytest.raises(concurrent.futures.CancelledError):
+            trabajo.result(timeout=30)
+        assert trabajo.estado == 'cancelado'
+        assert g.get_num_nodos() == 0
+        assert trabajo.cancelar() is False
+
+    def test_lecturas_y_recargas_se_excluyen(self):
+        """Ni se lee durante una carga ni se recarga durante una lectura sin GIL"""
+        ruta = os.path.join(DATA_DIR, "test_1000.txt")
+        g = neuronet_core.PyGrafoDisperso()
+        trabajo = g.cargar_datos_async(ruta)
+        for consulta in (lambda: g.obtener_grado(0), lambda: g.get_vecinos(0),
+                         g.get_estadisticas, g.censo_triadas):
+            with pytest.raises(RuntimeError):
+                consulta()
+        assert trabajo.result(timeout=30) is True
+
+        errores = []
+        def progreso(*args):
+            for recarga in (lambda: g.cargar_datos(ruta), lambda: g.publicar("/neuronet_prueba")):
+                try:
+                    recarga()
+                except RuntimeError as error:
+                    errores.append(error)
+        g.diametro(callback=progreso)
+        assert errores and len(errores) % 2 == 0
+        assert g.cargar_datos(ruta)
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestPoolHilos:
+    """Pruebas para el pool de hilos compartido"""
+    
+    def test_resultados_independientes_del_pool(self, tmp_path):
+        """Carga, BFS y análisis dan lo mismo con cualquier número de hilos"""
+        aristas = [(i, (i * 7 + 3) % 20000) for i in range(20000)] + \
+                  [(i, i + 1) for i in range(19999)]
+        ruta = tmp_path / "pool.txt"
+        ruta.write_text("# pool\n" + "\n".join(f"{u} {v}" for u, v in aristas))
+        
+        original = neuronet_core.PyGrafoDisperso.num_hilos()
+        resultados = []
+        try:
+            for hilos in (1, 4):
+                g = neuronet_core.PyGrafoDisperso(hilos=hilos)
+                assert neuronet_core.PyGrafoDisperso.num_hilos() == hilos
+                g.cargar_datos(str(ruta))
+                resultados.append((g.get_num_aristas(), g.bfs(0, 50), g.get_nodo_mayor_grado(),
+                                   g.grafletes()))
+        finally:
+            assert neuronet_core.PyGrafoDisperso.configurar_hilos(original)
+        assert resultados[0] == resultados[1]
+    
+    def test_medicion_de_regiones(self):
+        """El gancho recibe los tiempos de cada bucle paralelo"""
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+        medidas = []
+        neuronet_core.PyGrafoDisperso.medir_regiones(medidas.append)
+        try:
+            g.get_nodo_mayor_grado()
+        finally:
+            neuronet_core.PyGrafoDisperso.medir_regiones(None)
+        
+        assert [m['nombre'] for m in medidas] == ['GrafoDisperso::getNodoMayorGrado']
+        assert medidas[0]['bloques'] == 1
+        assert medidas[0]['segundos'] >= medidas[0]['max_ocupado_hilo'] >= 0
+        g.get_nodo_mayor_grado()
+        assert len(medidas) == 1
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestMemoriaCompartida:
+    """Pruebas para publicar y adjuntar grafos entre procesos"""
+    
+    def test_adjuntar_desde_otro_proceso(self):
+        """Otro proceso adjunta el segmento y obtiene los mismos recorridos"""
+        import json
+        import subprocess
+        
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+        esperado = [g.bfs(0, 3), g.dfs(7)]
+        nombre = f"/neuronet_test_{os.getpid()}"
+        assert g.publicar(nombre)
+        assert g.es_compartido
+        assert not g.publicar(nombre)
+        assert [g.bfs(0, 3), g.dfs(7)] == esperado
+        
+        codigo = (
+            "import json, neuronet_core\n"
+            f"h = neuronet_core.PyGrafoDisperso.adjuntar({nombre!r})\n"
+            "print('RESULTADO', json.dumps([h.bfs(0, 3), h.dfs(7)]))\n"
+        )
+        raiz = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+        salida = subprocess.run([sys.executable, "-c", codigo], cwd=raiz, capture_output=True,
+                                text=True, check=True).stdout
+        linea = [l for l in salida.splitlines() if l.startswith("RESULTADO ")][0]
+        obtenido = json.loads(linea[len("RESULTADO "):])
+        assert obtenido == [[list(p) for p in esperado[0]], esperado[1]]
+        
+        # Volver a cargar elimina el nombre publicado
+        g.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+        assert not g.es_compartido
+        assert neuronet_core.PyGrafoDisperso.adjuntar(nombre) is None
+    
+    def test_instantanea_en_archivo(self, tmp_path):
+        """La instantánea conserva subgrafos con sus IDs originales"""
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(EJEMPLO_GRAFO)
+        sub = g.extraer_subgrafo([0, 1, 2, 3, 5])
+        ruta = str(tmp_path / "grafo.csr")
+        assert sub.publicar(ruta, archivo=True)
+        
+        h = neuronet_core.PyGrafoDisperso.adjuntar(ruta, archivo=True)
+        assert h.es_compartido
+        assert h.get_num_nodos() == sub.get_num_nodos()
+        assert h.get_num_aristas() == sub.get_num_aristas()
+        assert list(h.ids_originales()) == list(sub.ids_originales())
+        assert h.bfs(0, 5) == sub.bfs(0, 5)
+    
+    def test_contenido_invalido(self, tmp_path):
+        """Un archivo que no es un CSR publicado se rechaza"""
+        ruta = tmp_path / "basura.csr"
+        ruta.write_bytes(b"no es un grafo" * 100)
+        assert neuronet_core.PyGrafoDisperso.adjuntar(str(ruta), archivo=True) is None
+        assert neuronet_core.PyGrafoDisperso.adjuntar("/neuronet_inexistente") is None
+
+        # Un grado de entrada que no cuadra con las columnas también
+        import struct
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(EJEMPLO_GRAFO)
+        assert g.publicar(str(ruta), archivo=True)
+        datos = bytearray(ruta.read_bytes())
+        offset_grado_entrada = struct.unpack_from("<q", datos, 64)[0]
+        struct.pack_into("<i", datos, offset_grado_entrada, 1 << 20)
+        ruta.write_bytes(bytes(datos))
+        assert neuronet_core.PyGrafoDisperso.adjuntar(str(ruta), archivo=True) is None
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestSerializacion:
+    """Pruebas para pickle de PyGrafoDisperso"""
+    
+    @pytest.mark.parametrize("protocolo", [2, 4, 5])
+    def test_ida_y_vuelta(self, protocolo):
+        """El grafo reconstruido responde igual que el original"""
+        import pickle
+        
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+        h = pickle.loads(pickle.dumps(g, protocol=protocolo))
+        
+        assert h.get_num_nodos() == g.get_num_nodos()
+        assert h.get_num_aristas() == g.get_num_aristas()
+        assert h.bfs(0, 4) == g.bfs(0, 4)
+        assert h.dfs(3) == g.dfs(3)
+        assert h.archivo_cargado == g.archivo_cargado
+    
+    def test_buffers_fuera_de_banda(self):
+        """Con protocolo 5 los arreglos no viajan en el flujo y bloquean la recarga"""
+        import pickle
+        
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(EJEMPLO_GRAFO)
+        sub = g.extraer_subgrafo([0, 2, 4, 5])
+        buffers = []
+        datos = pickle.dumps(sub, protocol=5, buffer_callback=buffers.append)
+        assert len(datos) < 200
+        assert sum(b.raw().nbytes for b in buffers) >= 4 * (sub.get_num_nodos() + 1)
+        with pytest.raises(BufferError):
+            sub.cargar_datos(EJEMPLO_GRAFO)
+        
+        h = pickle.loads(datos, buffers=buffers)
+        assert list(h.ids_originales()) == [0, 2, 4, 5]
+        assert h.bfs(0, 3) == sub.bfs(0, 3)
+        for b in buffers:
+            b.release()
+        assert sub.cargar_datos(EJEMPLO_GRAFO)
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestConstruccionArreglos:
+    """Pruebas para construir grafos desde arreglos NumPy"""
+    
+    @pytest.mark.parametrize("tipo", ["int32", "int64"])
+    def test_equivale_a_cargar_archivo(self, tipo):
+        """Las aristas del archivo dan el mismo grafo que cargarlo"""
+        import numpy as np
+        
+        ruta = os.path.join(DATA_DIR, "test_1000.txt")
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(ruta)
+        aristas = np.loadtxt(ruta, dtype=tipo, comments="#", ndmin=2)
+        h = neuronet_core.PyGrafoDisperso.desde_arrays(aristas[:, 0], aristas[:, 1])
+        
+        assert h.get_num_nodos() == g.get_num_nodos()
+        assert h.get_num_aristas() == g.get_num_aristas()
+        assert all(h.get_vecinos(v) == g.get_vecinos(v) for v in range(g.get_num_nodos()))
+        assert h.bfs(0, 4) == g.bfs(0, 4)
+        assert h.dfs(2) == g.dfs(2)
+    
+    def test_pesos_y_validacion(self):
+        """Los pesos acompañan a su arista y los IDs inválidos se rechazan"""
+        import numpy as np
+        
+        origenes = np.array([0, 0, 1, 0], dtype=np.int64)
+        destinos = np.array([2, 1, 2, 2], dtype=np.int64)
+        g = neuronet_core.PyGrafoDisperso.desde_arrays(origenes, destinos, weights=[7, 3, 4, 1])
+        assert g.get_vecinos(0) == [1, 2, 2]
+        assert g.flujo_maximo([0], [2], usar_pesos=True)['valor'] == 7 + 1 + 3
+        
+        assert neuronet_core.PyGrafoDisperso.desde_arrays(np.array([-1]), np.array([0])) is None
+        with pytest.raises(ValueError):
+            neuronet_core.PyGrafoDisperso.desde_arrays(np.array([0.5]), np.array([1.0]))
+        with pytest.raises(ValueError):
+            neuronet_core.PyGrafoDisperso.desde_arrays(origenes, destinos[:2])
+    
+    def test_adoptar_csr(self):
+        """desde_csr usa los arreglos tal cual y rechaza filas desordenadas"""
+        import numpy as np
+        
+        row_ptr = np.array([0, 2, 3, 3], dtype=np.int32)
+        columnas = np.array([1, 2, 2], dtype=np.int32)
+        g = neuronet_core.PyGrafoDisperso.desde_csr(row_ptr, columnas)
+        assert g.get_num_nodos() == 3
+        assert g.get_vecinos(0) == [1, 2]
+        assert g.obtener_grado_entrada(2) == 2
+        assert g.bfs(0, 2) == [(0, 0), (1, 1), (2, 1)]
+        
+        assert neuronet_core.PyGrafoDisperso.desde_csr(row_ptr, np.array([2, 1, 2])) is None
+        assert neuronet_core.PyGrafoDisperso.desde_csr(np.array([0, 5]), np.array([0])) is None
+        # int64 que se truncarían a un CSR válido al pasar a int32
+        columnas64 = np.array([1, 2, 2 + (1 << 32)], dtype=np.int64)
+        assert neuronet_core.PyGrafoDisperso.desde_csr(row_ptr.astype(np.int64), columnas64) is None
+        filas64 = np.array([0, 2, 3, 3 + (1 << 32)], dtype=np.int64)
+        assert neuronet_core.PyGrafoDisperso.desde_csr(filas64, columnas) is None
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestConsultasLote:
+    """Pruebas para las consultas por lote sobre arreglos de nodos"""
+    
+    def test_grados_coinciden_con_consultas_individuales(self, grafo):
+        """Los grados por lote igualan a las llamadas sueltas, -1 si el ID no existe"""
+        import numpy as np
+        
+        nodos = np.array([0, 5, -3, 17, grafo.get_num_nodos(), 2], dtype=np.int64)
+        salida = grafo.obtener_grados(nodos)
+        entrada = grafo.obtener_grados_entrada(list(nodos))
+        
+        assert salida.tolist() == [grafo.obtener_grado(int(v)) for v in nodos]
+        assert entrada.tolist() == [grafo.obtener_grado_entrada(int(v)) for v in nodos]
+        assert salida[2] == -1 and entrada[4] == -1
+    
+    def test_vecinos_lote(self, grafo):
+        """Cada tramo de valores es la lista de vecinos del nodo pedido"""
+        import numpy as np
+        
+        nodos = np.array([3, 99999, 0, 3, 42], dtype=np.int32)
+        offsets, valores = grafo.get_vecinos_lote(nodos)
+        
+        assert offsets.dtype == np.int64 and len(offsets) == len(nodos) + 1
+        for i, v in enumerate(nodos):
+            assert valores[offsets[i]:offsets[i + 1]].tolist() == grafo.get_vecinos(int(v))
+        assert grafo.get_vecinos_lote([])[0].tolist() == [0]
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestRecorridosIncrementales:
+    """Pruebas para los recorridos BFS/DFS por bloques"""
+    
+    def test_mismo_orden_que_recorrido_completo(self, grafo):
+        """Concatenar los bloques reproduce bfs() y dfs()"""
+        import numpy as np
+        
+        bloques = list(grafo.recorrer_bfs(0, 5, tam_bloque=7))
+        assert all(len(nodos) <= 7 for nodos, _ in bloques)
+        nodos = np.concatenate([n for n, _ in bloques]).tolist()
+        distancias = np.concatenate([d for _, d in bloques]).tolist()
+        assert list(zip(nodos, distancias)) == grafo.bfs(0, 5)
+        
+        for inicio in (0, 13):
+            iterador = grafo.recorrer_dfs(inicio, tam_bloque=10)
+            assert np.concatenate(list(iterador)).tolist() == grafo.dfs(inicio)
+            assert iterador.emitidos == len(grafo.dfs(inicio))
+        assert list(grafo.recorrer_dfs(-1)) == []
+    
+    def test_abandono_temprano_libera_el_grafo(self, grafo):
+        """Un iterador vivo impide recargar; close() lo libera"""
+        iterador = grafo.recorrer_dfs(0, tam_bloque=4)
+        assert len(next(iterador)) == 4
+        with pytest.raises(RuntimeError):
+            grafo.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+        iterador.close()
+        assert list(iterador) == []
+        assert grafo.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestDisposicionFuerzas:
+    """Pruebas para la disposición nativa de subgrafos"""
+    
+    def test_reproducible_y_validacion(self):
+        """Misma semilla, mismas coordenadas; parámetros inválidos dan None"""
+        import numpy as np
+        
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+        sub = g.extraer_subgrafo_bfs(0, 3)
+        pos = sub.disposicion_fuerzas(iteraciones=20, semilla=7)
+        
+        assert pos.shape == (sub.get_num_nodos(), 2) and np.isfinite(pos).all()
+        assert np.array_equal(pos, sub.disposicion_fuerzas(iteraciones=20, semilla=7))
+        assert sub.disposicion_fuerzas(iteraciones=-1) is None
+        with pytest.raises(ValueError):
+            sub.disposicion_fuerzas(posiciones=np.zeros((1, 2)))
+    
+    def test_malla_desplegada(self):
+        """Una malla queda extendida: esquinas opuestas lejos, vecinos cerca"""
+        import numpy as np
+        
+        lado = 20
+        idx = np.arange(lado * lado).reshape(lado, lado)
+        origenes = np.concatenate([idx[:, :-1].ravel(), idx[:-1, :].ravel()])
+        destinos = np.concatenate([idx[:, 1:].ravel(), idx[1:, :].ravel()])
+        g = neuronet_core.PyGrafoDisperso.desde_arrays(origenes, destinos)
+        pos = g.disposicion_fuerzas()
+        
+        arista = np.linalg.norm(pos[origenes] - pos[destinos], axis=1).mean()
+        assert np.linalg.norm(pos[0] - pos[-1]) > 10 * arista
+        
+        # Continuar desde un dibujo dado lo refina sin desarmarlo
+        ajustada = g.disposicion_fuerzas(iteraciones=10, posiciones=pos)
+        assert np.linalg.norm(ajustada[0] - ajustada[-1]) > 10 * arista
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestMuestreoSubgrafo:
+    """Pruebas para el muestreo de bolas BFS grandes"""
+    
+    @pytest.fixture
+    def grafo(self):
+        import numpy as np
+        rng = np.random.default_rng(3)
+        origenes = rng.integers(0, 5000, 40000)
+        destinos = rng.integers(0, 5000, 40000)
+        return neuronet_core.PyGrafoDisperso.desde_arrays(origenes, destinos)
+    
+    @pytest.mark.parametrize("estrategia", ["fuego", "caminata", "grado"])
+    def test_respeta_presupuestos(self, grafo, estrategia):
+        """La muestra cabe en el presupuesto, incluye el centro y es reproducible"""
+        import numpy as np
+        
+        m = grafo.muestrear_subgrafo(0, 4, max_nodos=300, max_aristas=500,
+                                     estrategia=estrategia, semilla=5)
+        nodos = m['nodos']
+        assert len(nodos) <= 300 and 0 in nodos
+        assert np.all(np.diff(nodos) > 0)
+        assert m['aristas_muestra'] <= 500
+        assert m['subgrafo'].get_num_aristas() == m['aristas_muestra']
+        assert m['podados_por_nivel'].sum() + len(nodos) == m['nodos_bola']
+        
+        otra = grafo.muestrear_subgrafo(0, 4, max_nodos=300, max_aristas=500,
+                                        estrategia=estrategia, semilla=5)
+        assert np.array_equal(nodos, otra['nodos'])
+    
+    def test_bola_completa_y_validacion(self):
+        """Una bola que cabe se devuelve entera; entradas inválidas se rechazan"""
+        import numpy as np
+        
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+        m = g.muestrear_subgrafo(0, 3)
+        nodos, distancias = next(g.recorrer_bfs(0, 3))
+        
+        assert np.array_equal(m['nodos'], np.sort(nodos))
+        assert m['ocultos'].sum() == 0 and m['podados_por_nivel'].sum() == 0
+        assert g.muestrear_subgrafo(-1, 3) is None
+        with pytest.raises(ValueError):
+            g.muestrear_subgrafo(0, 3, estrategia="desconocida")
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestGrafoExterno:
+    """Pruebas para el grafo semiexterno (aristas en disco)"""
+    
+    @pytest.mark.parametrize("usar_mmap", [True, False])
+    def test_equivale_a_grafo_en_memoria(self, tmp_path, usar_mmap):
+        """Con varias pasadas de conversión, las consultas coinciden con PyGrafoDisperso"""
+        import numpy as np
+        
+        lista = os.path.join(DATA_DIR, "test_1000.txt")
+        destino = str(tmp_path / "grafo.nnext")
+        assert neuronet_core.PyGrafoExterno.convertir(lista, destino, memoria_maxima=256)
+        e = neuronet_core.PyGrafoExterno()
+        assert e.abrir(destino, usar_mmap=usar_mmap)
+        assert e.usa_mmap == usar_mmap
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(lista)
+        
+        assert e.get_num_nodos() == g.get_num_nodos()
+        assert e.get_num_aristas() == g.get_num_aristas()
+        assert e.get_nodo_mayor_grado() == g.get_nodo_mayor_grado()
+        nodos = np.arange(-1, g.get_num_nodos() + 1)
+        assert np.array_equal(e.obtener_grados(nodos), g.obtener_grados(nodos))
+        assert np.array_equal(e.obtener_grados_entrada(nodos), g.obtener_grados_entrada(nodos))
+        for nodo in (0, 1, 50):
+            assert sorted(e.bfs(nodo, 3)) == sorted(g.bfs(nodo, 3))
+            assert e.dfs(nodo) == g.dfs(nodo)
+            assert e.get_vecinos(nodo) == g.get_vecinos(nodo)
+            assert sorted(e.get_aristas_subgrafo(nodo, 2)) == sorted(g.get_aristas_subgrafo(nodo, 2))
+    
+    def test_componentes_y_validacion(self, tmp_path):
+        """Componentes débiles etiquetadas por su menor ID; archivos inválidos se rechazan"""
+        lista = tmp_path / "aristas.txt"
+        lista.write_text("# componentes\n0 1\n2 1\n4 3\n6 6\n")
+        
+        e = neuronet_core.PyGrafoExterno()
+        assert e.cargar_datos(str(lista))
+        assert os.path.exists(str(lista) + ".nnext")
+        componentes, etiquetas = e.componentes_conexas()
+        assert componentes == 4
+        assert etiquetas.tolist() == [0, 0, 0, 3, 3, 5, 6]
+        
+        assert not e.abrir(str(lista))
+        assert not neuronet_core.PyGrafoExterno.convertir(str(tmp_path / "no_existe.txt"),
+                                                          str(tmp_path / "x.nnext"))
+
+    @pytest.mark.parametrize("usar_mmap", [True, False])
+    def test_vecinos_descartan_destinos_invalidos(self, tmp_path, usar_mmap):
+        """get_vecinos filtra los destinos fuera de rango como los recorridos"""
+        import struct
+        lista = tmp_path / "aristas.txt"
+        lista.write_text("0 1\n0 2\n2 1\n")
+        destino = tmp_path / "grafo.nnext"
+        assert neuronet_core.PyGrafoExterno.convertir(str(lista), str(destino))
+        datos = bytearray(destino.read_bytes())
+        offset_columnas = struct.unpack_from("<q", datos, 48)[0]
+        struct.pack_into("<i", datos, offset_columnas, 1000)
+        destino.write_bytes(bytes(datos))
+
+        e = neuronet_core.PyGrafoExterno()
+        assert e.abrir(str(destino), usar_mmap=usar_mmap)
+        assert e.get_vecinos(0) == [2]
+        assert e.get_vecinos(2) == [1]
+        assert sorted(e.bfs(0, 2)) == [(0, 0), (1, 2), (2, 1)]
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+@pytest.mark.skipif(sys.platform == 'win32', reason="grafo particionado solo en POSIX")
+class TestGrafoParticionado:
+    """Pruebas para el BFS distribuido entre procesos"""
+    
+    @pytest.mark.parametrize("esquema,particiones", [('1d', 4), ('2d', 4), ('2d', 6)])
+    def test_bfs_equivale_a_grafo_en_memoria(self, grafo, esquema, particiones):
+        """El BFS distribuido visita los mismos nodos con las mismas distancias"""
+        with grafo.particionar(particiones, esquema) as p:
+            assert p.num_particiones == particiones
+            for nodo in (0, 1, grafo.get_nodo_mayor_grado()[0]):
+                resultado = p.bfs(nodo, 4)
+                assert resultado == sorted(resultado, key=lambda t: (t[1], t[0]))
+                assert sorted(resultado) == sorted(grafo.bfs(nodo, 4))
+            estadisticas = p.estadisticas()
+            assert sum(estadisticas['aristas_por_particion']) == grafo.get_num_aristas()
+            assert sum(estadisticas['nodos_por_particion']) == grafo.get_num_nodos()
+            filas, columnas = estadisticas['malla']
+            assert filas * columnas == particiones
+        assert not p.activo
+    
+    def test_validacion(self, grafo):
+        """Parámetros inválidos y grafo cerrado"""
+        with pytest.raises(ValueError):
+            grafo.particionar(2, '3d')
+        assert grafo.particionar(0) is None
+        
+        p = grafo.particionar(2, '1d')
+        assert p.bfs(-1, 3) == []
+        p.cerrar()
+        p.cerrar()
+        assert p.num_particiones == 0
+        assert p.bfs(0, 3) == []
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestParticionGrafo:
+    """Pruebas para los particionadores y sus métricas"""
+    
+    @pytest.mark.parametrize("metodo", ['ldg', 'fennel', 'multinivel'])
+    def test_particion_de_nodos(self, grafo, metodo):
+        """Asignación válida, balance respetado y métricas iguales a evaluar_particion"""
+        import numpy as np
+        
+        n = grafo.get_num_nodos()
+        resultado = grafo.calcular_particion(4, metodo, desbalance=1.1, orden_aleatorio=True)
+        asignacion = resultado['asignacion']
+        metricas = resultado['metricas']
+        assert resultado['asignacion_aristas'] is None
+        assert asignacion.shape == (n,)
+        assert asignacion.min() >= 0 and asignacion.max() < 4
+        assert metricas['carga'].sum() == n
+        assert metricas['desbalance'] <= 1.1 + 4.0 / n
+        assert metricas['factor_replicacion'] >= 1.0
+        
+        evaluadas = grafo.evaluar_particion(asignacion, 4)
+        for clave in ('aristas_cortadas', 'nodos_frontera', 'factor_replicacion', 'desbalance'):
+            assert evaluadas[clave] == metricas[clave]
+        bloques = grafo.evaluar_particion(np.arange(n) * 4 // n)
+        assert metricas['aristas_cortadas'] <= bloques['aristas_cortadas']
+    
+    def test_hdrf_y_archivo(self, grafo, tmp_path):
+        """HDRF asigna cada arista sin cortarla y escribe la asignación de nodos"""
+        import numpy as np
+        
+        archivo = tmp_path / "particion.txt"
+        resultado = grafo.calcular_particion(4, 'hdrf', archivo=str(archivo))
+        aristas = resultado['asignacion_aristas']
+        metricas = resultado['metricas']
+        assert aristas.shape == (grafo.get_num_aristas(),)
+        assert metricas['aristas_cortadas'] == 0
+        assert metricas['carga'].sum() == grafo.get_num_aristas()
+        assert metricas['factor_replicacion'] >= 1.0
+        assert grafo.evaluar_particion(aristas, 4, por_aristas=True)['nodos_frontera'] == \
+            metricas['nodos_frontera']
+        guardada = np.loadtxt(str(archivo), dtype=np.int32)
+        assert np.array_equal(guardada, resultado['asignacion'])
+    
+    @pytest.mark.skipif(sys.platform == 'win32', reason="grafo particionado solo en POSIX")
+    def test_asignacion_en_grafo_particionado_y_validacion(self, grafo):
+        """El BFS distribuido acepta la asignación calculada; valores inválidos se rechazan"""
+        asignacion = grafo.calcular_particion(4, 'multinivel')['asignacion']
+        with grafo.particionar(4, '2d', asignacion=asignacion) as p:
+            assert sorted(p.bfs(0, 4)) == sorted(grafo.bfs(0, 4))
+            assert p.estadisticas()['nodos_por_particion'] == \
+                [int(c) for c in grafo.evaluar_particion(asignacion, 4)['carga']]
+        
+        with pytest.raises(ValueError):
+            grafo.calcular_particion(4, 'metis')
+        assert grafo.calcular_particion(0) is None
+        assert grafo.evaluar_particion([0, 1]) is None
+        assert grafo.particionar(2, '1d', asignacion=asignacion) is None
+
+    def test_grafo_vacio(self):
+        """Un grafo sin nodos se evalúa con métricas neutras y no se particiona"""
+        import numpy as np
+
+        vacio = neuronet_core.PyGrafoDisperso.desde_csr(np.zeros(1, dtype=np.int32),
+                                                         np.zeros(0, dtype=np.int32))
+        for por_aristas in (False, True):
+            metricas = vacio.evaluar_particion(np.zeros(0, dtype=np.int32), 3, por_aristas=por_aristas)
+            assert metricas['factor_replicacion'] == 1.0
+            assert metricas['desbalance'] == 1.0
+            assert metricas['carga'].sum() == 0
+        assert vacio.calcular_particion(3, 'multinivel') is None
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestMetricas:
+    """Pruebas para los contadores de instrumentación"""
+    
+    def test_contadores_de_bfs_y_dfs(self, grafo):
+        """Los contadores y el perfil por nivel cuadran con el recorrido"""
+        metricas = neuronet_core.PyGrafoDisperso.obtener_metricas(reiniciar=True)
+        if not metricas['activas']:
+            pytest.skip("Modulo compilado o ejecutado con NEURONET_METRICAS=0")
+        nodo = grafo.get_nodo_mayor_grado()[0]
+        resultado = grafo.bfs(nodo, 3)
+        grafo.dfs(nodo)
+        
+        metricas = neuronet_core.PyGrafoDisperso.obtener_metricas(reiniciar=True)
+        perfil = metricas['perfil_ultimo_bfs']
+        assert metricas['llamadas_bfs'] == 1
+        assert metricas['llamadas_dfs'] == 1
+        assert metricas['niveles_bfs'] == len(perfil['frontera'])
+        assert perfil['frontera'][0] == 1
+        assert perfil['aristas'][0] == grafo.obtener_grado(nodo)
+        assert metricas['grado_maximo_expandido'] == grafo.get_nodo_mayor_grado()[1]
+        assert metricas['frontera_maxima'] == perfil['frontera'].max()
+        assert metricas['nodos_visitados'] >= len(resultado)
+        assert metricas['bytes_reservados'] > 0
+        assert (perfil['segundos'] >= 0).all()
+        assert neuronet_core.PyGrafoDisperso.obtener_metricas()['llamadas_bfs'] == 0
+    
+    def test_desactivar(self, grafo):
+        """Con las métricas apagadas los contadores no cambian"""
+        neuronet_core.PyGrafoDisperso.activar_metricas(False)
+        try:
+            neuronet_core.PyGrafoDisperso.obtener_metricas(reiniciar=True)
+            grafo.bfs(0, 3)
+            metricas = neuronet_core.PyGrafoDisperso.obtener_metricas()
+            assert not metricas['activas']
+            assert metricas['llamadas_bfs'] == 0
+            assert metricas['aristas_exploradas'] == 0
+        finally:
+            neuronet_core.PyGrafoDisperso.activar_metricas(True)
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestMemoria:
+    """Pruebas para la contabilidad de memoria por categoría"""
+    
+    def test_carga_contabiliza_grafo_y_pico_temporal(self):
+        """El CSR cuenta como grafo y las aristas leídas como pico temporal"""
+        antes = neuronet_core.PyGrafoDisperso.obtener_memoria(reiniciar_picos=True)
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+        despues = neuronet_core.PyGrafoDisperso.obtener_memoria()
+        
+        n, m = g.get_num_nodos(), g.get_num_aristas()
+        grafo = despues['grafo']['actual'] - antes['grafo']['actual']
+        assert grafo >= 4 * (n + 1 + 2 * m)
+        assert grafo <= g.get_memoria_usada()
+        assert despues['cache']['actual'] - antes['cache']['actual'] >= 4 * n
+        assert despues['temporal']['pico'] - antes['temporal']['actual'] >= 8 * m
+        assert despues['temporal']['actual'] == antes['temporal']['actual']
+        assert despues['total_pico'] > despues['total']
+        
+        del g
+        final = neuronet_core.PyGrafoDisperso.obtener_memoria()
+        assert final['grafo']['actual'] == antes['grafo']['actual']
+    
+    def test_recorridos_liberan_sus_buferes(self):
+        """Los búferes del BFS suben el pico temporal y se liberan al terminar"""
+        g = neuronet_core.PyGrafoDisperso()
+        g.cargar_datos(os.path.join(DATA_DIR, "test_1000.txt"))
+        antes = neuronet_core.PyGrafoDisperso.obtener_memoria(reiniciar_picos=True)
+        g.bfs(0, 3)
+        g.dfs(0)
+        despues = neuronet_core.PyGrafoDisperso.obtener_memoria()
+        assert despues['temporal']['actual'] == antes['temporal']['actual']
+        assert despues['temporal']['pico'] - antes['temporal']['actual'] >= 4 * g.get_num_nodos()
+        if sys.platform.startswith('linux'):
+            assert despues['rss'] > 0
+            assert despues['rss_pico'] >= despues['rss']
+
+
+def _thp_disponible():
+    """True si el núcleo atiende madvise(MADV_HUGEPAGE)"""
+    try:
+        with open("/sys/kernel/mm/transparent_hugepage/enabled") as archivo:
+            return "[never]" not in archivo.read()
+    except OSError:
+        return False
+
+
+@pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
+class TestArenaMemoria:
+    """Pruebas para la memoria de trabajo reutilizable y las páginas grandes"""
+    
+    def test_recorridos_repetidos_reutilizan_la_arena(self, grafo):
+        """El segundo recorrido no pide memoria nueva y la retenida se puede soltar"""
+        nodo = grafo.get_nodo_mayor_grado()[0]
+        primero = grafo.bfs(nodo, 4)
+        grafo.dfs(nodo)
+        retenida = neuronet_core.PyGrafoDisperso.obtener_memoria()
+        assert grafo.bfs(nodo, 4) == primero
+        grafo.dfs(nodo)
+        despues = neuronet_core.PyGrafoDisperso.obtener_memoria()
+        assert despues['cache']['actual'] == retenida['cache']['actual']
+        assert despues['temporal']['actual'] == retenida['temporal']['actual']
+        
+        neuronet_core.PyGrafoDisperso.liberar_memoria_retenida()
+        liberada = neuronet_core.PyGrafoDisperso.obtener_memoria()
+        assert liberada['cache']['actual'] < retenida['cache']['actual']
+        assert grafo.bfs(nodo, 4) == primero
+
+    def test_reserva_de_vectores_no_duplica_el_pico(self):
+        """Con la reserva ya caliente, el espacio BFS no vuelve a contar en el pico"""
+        import numpy as np
+
+        n = 300000
+        origen = np.arange(n)
+        anillo = neuronet_core.PyGrafoDisperso.desde_arrays(origen, (origen + 1) % n)
+        anillo.extraer_subgrafo_bfs(5, 1)
+        picos = []
+        for _ in range(2):
+            antes = neuronet_core.PyGrafoDisperso.obtener_memoria(reiniciar_picos=True)
+            anillo.extraer_subgrafo_bfs(5, 1)
+            despues = neuronet_core.PyGrafoDisperso.obtener_memoria()
+            assert despues['total'] == antes['total']
+            picos.append(despues['total_pico'] - antes['total'])
+        assert picos[0] == picos[1]
+        assert picos[1] < 8 * n
+
+    def test_paginas_grandes_para_arreglos_csr(self):
+        """Los arreglos CSR grandes se mapean aparte, con páginas grandes transparentes en 'thp'"""
+        import numpy as np
+        with pytest.raises(ValueError):
+            neuronet_core.PyGrafoDisperso.configurar_paginas_grandes('enormes')
+        rng = np.random.default_rng(7)
+        src = rng.integers(0, 50000, 800000)
+        dst = rng.integers(0, 50000, 800000)
+        esperado = None
+        try:
+            for modo in ('explicitas', 'no', 'thp'):
+                if not neuronet_core.PyGrafoDisperso.configurar_paginas_grandes(modo):
+                    continue
+                antes = neuronet_core.PyGrafoDisperso.obtener_memoria()['paginas_grandes']
+                g = neuronet_core.PyGrafoDisperso.desde_arrays(src, dst)
+                memoria = neuronet_core.PyGrafoDisperso.obtener_memoria()['paginas_grandes']
+                assert memoria['modo'] == modo
+                resultado = g.bfs(0, 3)
+                esperado = esperado if esperado is not None else resultado
+                assert resultado == esperado
+                if modo == 'thp' and _thp_disponible():
+                    # Al menos el arreglo de destinos (4 bytes por arista) va en THP
+                    columnas = 4 * g.get_num_aristas()
+                    assert memoria['transparentes'] - antes['transparentes'] >= columnas
+                    del g
+                    liberado = neuronet_core.PyGrafoDisperso.obtener_memoria()['paginas_grandes']
+                    assert memoria['transparentes'] - liberado['transparentes'] >= columnas
+        finally:
+            neuronet_core.PyGrafoDisperso.configurar_paginas_grandes('thp')
+
+
 @pytest.mark.skipif(not CORE_DISPONIBLE, reason="neuronet_core no compilado")
 class TestRendimiento:
     """Pruebas de rendimiento básicas"""